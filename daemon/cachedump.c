@@ -778,6 +778,10 @@ print_dp_details(RES* ssl, struct worker* worker, struct delegpt* dp)
 			ri.srtt, ri.rttvar, rtt_notimeout(&ri),
 			tA, tAAAA, tother))
 			return;
+		if(rtt_p50(&ri) != -1)
+			if(!ssl_printf(ssl, ", p50 %d p95 %d", rtt_p50(&ri),
+				rtt_p95(&ri)))
+				return;
 		if(delay)
 			if(!ssl_printf(ssl, ", probedelay %d", delay))
 				return;
@@ -69,6 +69,7 @@
 #include "daemon/daemon.h"
 #include "daemon/worker.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "daemon/acl_list.h"
 #include "util/log.h"
 #include "util/config_file.h"
@@ -80,6 +81,7 @@
 #include "util/edns.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/cache/infra.h"
 #include "services/localzone.h"
 #include "services/view.h"
@@ -344,6 +346,40 @@ static int setup_acl_for_ports(struct acl_list* list,
 	return 1;
 }
 
+/** see if the string lists have the same strings, in the same order */
+static int
+strlist_equal(struct config_strlist* a, struct config_strlist* b)
+{
+	while(a && b) {
+		if(strcmp(a->str, b->str) != 0)
+			return 0;
+		a = a->next;
+		b = b->next;
+	}
+	return (a == NULL && b == NULL);
+}
+
+/** copy the string list, returns false on alloc failure */
+static int
+strlist_copy(struct config_strlist** to, struct config_strlist* from)
+{
+	struct config_strlist** tail = to;
+	*to = NULL;
+	for(; from; from = from->next) {
+		struct config_strlist* s = (struct config_strlist*)calloc(1,
+			sizeof(*s));
+		if(!s || !(s->str = strdup(from->str))) {
+			free(s);
+			config_delstrlist(*to);
+			*to = NULL;
+			return 0;
+		}
+		*tail = s;
+		tail = &s->next;
+	}
+	return 1;
+}
+
 int
 daemon_open_shared_ports(struct daemon* daemon)
 {
@@ -354,6 +390,7 @@ daemon_open_shared_ports(struct daemon* daemon)
 		size_t i;
 		struct listen_port* p0;
 		daemon->reuseport = 0;
+		daemon->doq_steer = 0;
 		/* free and close old ports */
 		if(daemon->ports != NULL) {
 			for(i=0; i<daemon->num_ports; i++)
@@ -425,6 +462,10 @@ daemon_open_shared_ports(struct daemon* daemon)
 					return 0;
 				}
 			}
+#ifdef HAVE_NGTCP2
+			daemon->doq_steer = listening_ports_doq_steer(
+				daemon->ports[0], (int)daemon->num_ports);
+#endif
 		}
 		config_del_strarray(resif, num_resif);
 		daemon->listening_port = daemon->cfg->port;
@@ -441,6 +482,31 @@ daemon_open_shared_ports(struct daemon* daemon)
 			return 0;
 		daemon->rc_port = daemon->cfg->control_port;
 	}
+	if(!daemon->cfg->metrics_enable && daemon->metrics_port) {
+		listening_ports_free(daemon->metrics_ports);
+		daemon->metrics_ports = NULL;
+		daemon->metrics_port = 0;
+		config_delstrlist(daemon->metrics_ifs);
+		daemon->metrics_ifs = NULL;
+	}
+	if(daemon->cfg->metrics_enable &&
+		(daemon->cfg->metrics_port != daemon->metrics_port ||
+		!strlist_equal(daemon->cfg->metrics_ifs.first,
+		daemon->metrics_ifs))) {
+		listening_ports_free(daemon->metrics_ports);
+		daemon->metrics_ports = NULL;
+		daemon->metrics_port = 0;
+		config_delstrlist(daemon->metrics_ifs);
+		if(!strlist_copy(&daemon->metrics_ifs,
+			daemon->cfg->metrics_ifs.first)) {
+			log_err("out of memory");
+			return 0;
+		}
+		if(!(daemon->metrics_ports=daemon_metrics_open_ports(
+			daemon->cfg)))
+			return 0;
+		daemon->metrics_port = daemon->cfg->metrics_port;
+	}
 	return 1;
 }
 
@@ -533,6 +599,62 @@ daemon_clear_allocs(struct daemon* daemon)
 	alloc_clear_special(&daemon->superalloc);
 }
 
+#ifdef HAVE_NGTCP2
+/**
+ * Create the doq connection tables. If the doq packets are steered to
+ * the threads, every worker has its own table, that holds the connections
+ * with its number in the connection ids. Otherwise the workers share
+ * one table.
+ * @param daemon: the daemon, with num set.
+ */
+static void
+daemon_create_doq_tables(struct daemon* daemon)
+{
+	int i;
+	if(!daemon->doq_steer || daemon->num != (int)daemon->num_ports) {
+		daemon->doq_table = doq_table_create(daemon->cfg,
+			daemon->rand, -1, 1);
+		if(!daemon->doq_table)
+			fatal_exit("could not create doq_table: out of memory");
+		return;
+	}
+	daemon->doq_tables = (struct doq_table**)calloc((size_t)daemon->num,
+		sizeof(struct doq_table*));
+	if(!daemon->doq_tables)
+		fatal_exit("could not create doq_table: out of memory");
+	for(i=0; i<daemon->num; i++) {
+		daemon->doq_tables[i] = doq_table_create(daemon->cfg,
+			daemon->rand, i, daemon->num);
+		if(!daemon->doq_tables[i])
+			fatal_exit("could not create doq_table: out of memory");
+		/* the same secret, so that the tokens and stateless resets
+		 * of a connection work on every thread */
+		if(i > 0)
+			memcpy(daemon->doq_tables[i]->static_secret,
+				daemon->doq_tables[0]->static_secret,
+				daemon->doq_tables[0]->static_secret_len);
+	}
+}
+
+/**
+ * Delete the doq connection tables.
+ * @param daemon: the daemon, with num still set.
+ */
+static void
+daemon_delete_doq_tables(struct daemon* daemon)
+{
+	int i;
+	doq_table_delete(daemon->doq_table);
+	daemon->doq_table = NULL;
+	if(!daemon->doq_tables)
+		return;
+	for(i=0; i<daemon->num; i++)
+		doq_table_delete(daemon->doq_tables[i]);
+	free(daemon->doq_tables);
+	daemon->doq_tables = NULL;
+}
+#endif /* HAVE_NGTCP2 */
+
 /**
  * Allocate empty worker structures. With backptr and thread-number,
  * from 0..numthread initialised. Used as user arguments to new threads.
@@ -558,12 +680,6 @@ daemon_create_workers(struct daemon* daemon)
 	numport = daemon_get_shufport(daemon, shufport);
 	verbose(VERB_ALGO, "total of %d outgoing ports available", numport);
 
-#ifdef HAVE_NGTCP2
-	daemon->doq_table = doq_table_create(daemon->cfg, daemon->rand);
-	if(!daemon->doq_table)
-		fatal_exit("could not create doq_table: out of memory");
-#endif
-	
 	daemon->num = (daemon->cfg->num_threads?daemon->cfg->num_threads:1);
 	if(daemon->reuseport && (int)daemon->num < (int)daemon->num_ports) {
 		log_warn("cannot reduce num-threads to %d because so-reuseport "
@@ -571,6 +687,9 @@ daemon_create_workers(struct daemon* daemon)
 			(int)daemon->num_ports);
 		daemon->num = (int)daemon->num_ports;
 	}
+#ifdef HAVE_NGTCP2
+	daemon_create_doq_tables(daemon);
+#endif
 	daemon->workers = (struct worker**)calloc((size_t)daemon->num, 
 		sizeof(struct worker*));
 	if(!daemon->workers)
@@ -606,6 +725,9 @@ daemon_create_workers(struct daemon* daemon)
 			daemon->worker_allocs[i] = alloc;
 		}
 	}
+	for(i=0; i<daemon->num; i++)
+		alloc_set_special_batch(daemon->worker_allocs[i],
+			daemon->cfg->rrset_alloc_batch);
 	free(shufport);
 }
 
@@ -878,6 +1000,7 @@ daemon_cleanup(struct daemon* daemon)
 	if(!daemon->reuse_cache || daemon->need_to_exit) {
 		slabhash_clear(&daemon->env->rrset_cache->table);
 		slabhash_clear(daemon->env->msg_cache);
+		deleg_cache_clear(daemon->env->deleg_cache);
 	}
 	daemon->old_num = daemon->num; /* save the current num */
 	forwards_delete(daemon->env->fwds);
@@ -894,16 +1017,27 @@ daemon_cleanup(struct daemon* daemon)
 		auth_zones_cleanup(daemon->env->auth_zones);
 	/* key cache is cleared by module deinit during next daemon_fork() */
 	daemon_remote_clear(daemon->rc);
+	daemon_metrics_clear(daemon->metrics);
+	/* the threads start new latency histograms */
+	server_latency_delete(daemon->latency_base);
+	daemon->latency_base = NULL;
+	memset(&daemon->stats_shared_cleared, 0,
+		sizeof(daemon->stats_shared_cleared));
 	for(i=0; i<daemon->num; i++)
 		worker_delete(daemon->workers[i]);
 	free(daemon->workers);
 	daemon->workers = NULL;
+	/* the queries that referred to them are deleted with the workers */
+	daemon_remote_fast_reload_cleanup(daemon->rc);
 	/* Unless we're trying to keep the cache, worker alloc_caches should be
 	 * cleared and freed here. We do this after deleting workers to
 	 * guarantee that the alloc caches are valid throughout the lifetime
 	 * of workers. */
 	if(!daemon->reuse_cache || daemon->need_to_exit)
 		daemon_clear_allocs(daemon);
+#ifdef HAVE_NGTCP2
+	daemon_delete_doq_tables(daemon);
+#endif
 	daemon->num = 0;
 #ifdef USE_DNSTAP
 	dt_delete(daemon->dtenv);
@@ -912,10 +1046,6 @@ daemon_cleanup(struct daemon* daemon)
 #ifdef USE_DNSCRYPT
 	dnsc_delete(daemon->dnscenv);
 	daemon->dnscenv = NULL;
-#endif
-#ifdef HAVE_NGTCP2
-	doq_table_delete(daemon->doq_table);
-	daemon->doq_table = NULL;
 #endif
 	daemon->cfg = NULL;
 }
@@ -930,12 +1060,17 @@ daemon_delete(struct daemon* daemon)
 	modstack_call_destartup(&daemon->mods, daemon->env);
 	modstack_free(&daemon->mods);
 	daemon_remote_delete(daemon->rc);
+	daemon_metrics_delete(daemon->metrics);
+	server_latency_delete(daemon->latency_base);
 	for(i = 0; i < daemon->num_ports; i++)
 		listening_ports_free(daemon->ports[i]);
 	free(daemon->ports);
 	listening_ports_free(daemon->rc_ports);
+	listening_ports_free(daemon->metrics_ports);
+	config_delstrlist(daemon->metrics_ifs);
 	if(daemon->env) {
 		slabhash_delete(daemon->env->msg_cache);
+		deleg_cache_delete(daemon->env->deleg_cache);
 		rrset_cache_delete(daemon->env->rrset_cache);
 		infra_delete(daemon->env->infra_cache);
 		edns_known_options_delete(daemon->env);
@@ -1009,6 +1144,7 @@ daemon_delete(struct daemon* daemon)
 void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 {
 	int new_num = cfg->num_threads?cfg->num_threads:1;
+	struct rrset_cache* old_rrset;
 
         daemon->cfg = cfg;
 	config_apply(cfg);
@@ -1041,6 +1177,7 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 		log_warn("cannot reuse caches due to critical config change");
 		slabhash_clear(&daemon->env->rrset_cache->table);
 		slabhash_clear(daemon->env->msg_cache);
+		deleg_cache_clear(daemon->env->deleg_cache);
 		daemon_clear_allocs(daemon);
 	}
 
@@ -1055,9 +1192,18 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 			fatal_exit("malloc failure updating config settings");
 		}
 	}
+	old_rrset = daemon->env->rrset_cache;
 	if((daemon->env->rrset_cache = rrset_cache_adjust(
 		daemon->env->rrset_cache, cfg, &daemon->superalloc)) == 0)
 		fatal_exit("malloc failure updating config settings");
+	if(daemon->env->rrset_cache != old_rrset) {
+		/* the references are to the rrset keys of the old cache */
+		deleg_cache_delete(daemon->env->deleg_cache);
+		daemon->env->deleg_cache = NULL;
+	}
+	if((daemon->env->deleg_cache = deleg_cache_adjust(
+		daemon->env->deleg_cache, cfg)) == 0 && cfg->deleg_cache_size)
+		fatal_exit("malloc failure updating config settings");
 	if((daemon->env->infra_cache = infra_adjust(daemon->env->infra_cache,
 		cfg))==0)
 		fatal_exit("malloc failure updating config settings");
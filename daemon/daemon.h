@@ -45,6 +45,7 @@
 #include "util/locks.h"
 #include "util/alloc.h"
 #include "services/modstack.h"
+#include "libunbound/unbound.h"
 struct config_file;
 struct worker;
 struct listen_port;
@@ -56,6 +57,8 @@ struct local_zones;
 struct views;
 struct ub_randstate;
 struct daemon_remote;
+struct daemon_metrics;
+struct server_latency;
 struct respip_set;
 struct shm_main_info;
 struct doq_table;
@@ -80,6 +83,8 @@ struct daemon {
 	struct config_file* cfg;
 	/** the chroot dir in use, NULL if none */
 	char* chroot;
+	/** the config file name, read by the fast reload */
+	const char* cfgfile;
 	/** pidfile that is used */
 	char* pidfile;
 	/** port number that has ports opened. */
@@ -91,12 +96,22 @@ struct daemon {
 	size_t num_ports;
 	/** reuseport is enabled if true */
 	int reuseport;
+	/** the doq packets are steered to the thread by connection id */
+	int doq_steer;
 	/** port number for remote that has ports opened. */
 	int rc_port;
 	/** listening ports for remote control */
 	struct listen_port* rc_ports;
 	/** remote control connections management (for first worker) */
 	struct daemon_remote* rc;
+	/** port number for metrics that has ports opened. */
+	int metrics_port;
+	/** listening ports for the metrics listener */
+	struct listen_port* metrics_ports;
+	/** the metrics-interface list that the metrics ports are for */
+	struct config_strlist* metrics_ifs;
+	/** metrics listener connections management (for first worker) */
+	struct daemon_metrics* metrics;
 	/** ssl context for listening to dnstcp over ssl, and connecting ssl */
 	void* listen_sslctx, *connect_sslctx;
 	/** num threads allocated */
@@ -129,6 +144,12 @@ struct daemon {
 	struct local_zones* local_zones;
 	/** last time of statistics printout */
 	struct timeval time_last_stat;
+	/** baseline of the latency histograms at the last statistics reset,
+	 * or NULL */
+	struct server_latency* latency_base;
+	/** the shared counters, like rrset bogus, that were reset by the
+	 * statistics reads, added up, for the totals since start */
+	struct ub_server_stats stats_shared_cleared;
 	/** time when daemon started */
 	struct timeval time_boot;
 	/** views structure containing view tree */
@@ -148,8 +169,12 @@ struct daemon {
 	/** the dnscrypt environment */
 	struct dnsc_env* dnscenv;
 #endif
-	/** the doq connection table */
+	/** the doq connection table, shared by the workers, or NULL if
+	 * they have their own table */
 	struct doq_table* doq_table;
+	/** the doq connection tables per worker, array of size num, if
+	 * the doq packets are steered to the worker. Or NULL. */
+	struct doq_table** doq_tables;
 	/** reuse existing cache on reload if other conditions allow it. */
 	int reuse_cache;
 	/** the EDNS cookie secrets from the cookie-secret-file */
@@ -0,0 +1,1018 @@
+/*
+ * daemon/metrics.c - serve statistics over HTTP for the unbound daemon.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the metrics listener for the daemon. HTTP requests
+ * for /metrics are answered with the statistics in OpenMetrics text
+ * format. The connections are handled nonblocking on the first thread.
+ */
+#include "config.h"
+#include "daemon/metrics.h"
+#include "daemon/worker.h"
+#include "daemon/daemon.h"
+#include "daemon/stats.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/netevent.h"
+#include "util/timehist.h"
+#include "util/timeval_func.h"
+#include "util/fptr_wlist.h"
+#include "util/storage/slabhash.h"
+#include "services/listen_dnsport.h"
+#include "services/modstack.h"
+#include "services/outside_network.h"
+#include "services/cache/rrset.h"
+#include "services/rpz.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/parseutil.h"
+#include "sldns/wire2str.h"
+#ifdef USE_DNSCRYPT
+#include "dnscrypt/dnscrypt.h"
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+
+/** the content type of the OpenMetrics text format */
+#define METRICS_CONTENT_TYPE \
+	"application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+struct daemon_metrics*
+daemon_metrics_create(struct config_file* ATTR_UNUSED(cfg))
+{
+	struct daemon_metrics* m = (struct daemon_metrics*)calloc(1,
+		sizeof(*m));
+	if(!m) {
+		log_err("out of memory in daemon_metrics_create");
+		return NULL;
+	}
+	m->max_active = METRICS_MAX_ACTIVE;
+	return m;
+}
+
+/** delete a busy metrics connection */
+static void
+metrics_state_delete(struct metrics_state* s)
+{
+	comm_point_delete(s->c);
+	sldns_buffer_free(s->buf);
+	free(s);
+}
+
+void daemon_metrics_clear(struct daemon_metrics* m)
+{
+	struct metrics_state* p, *np;
+	if(!m) return;
+	/* but do not close the ports */
+	listen_list_delete(m->accept_list);
+	m->accept_list = NULL;
+	/* do close these sockets */
+	p = m->busy_list;
+	while(p) {
+		np = p->next;
+		metrics_state_delete(p);
+		p = np;
+	}
+	m->busy_list = NULL;
+	m->active = 0;
+	m->worker = NULL;
+}
+
+void daemon_metrics_delete(struct daemon_metrics* m)
+{
+	if(!m) return;
+	daemon_metrics_clear(m);
+	free(m);
+}
+
+/**
+ * Add and open a new metrics port
+ * @param ip: ip str
+ * @param nr: port nr
+ * @param list: list head
+ * @param noproto_is_err: if lack of protocol support is an error.
+ * @param cfg: config with socket options.
+ * @return false on failure.
+ */
+static int
+metrics_add_open(const char* ip, int nr, struct listen_port** list,
+	int noproto_is_err, struct config_file* cfg)
+{
+	struct addrinfo hints;
+	struct addrinfo* res;
+	struct listen_port* n;
+	int noproto = 0;
+	int fd, r;
+	char port[15];
+	snprintf(port, sizeof(port), "%d", nr);
+	port[sizeof(port)-1]=0;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST;
+	if((r = getaddrinfo(ip, port, &hints, &res)) != 0 || !res) {
+		log_err("metrics interface %s:%s getaddrinfo: %s %s",
+			ip, port, gai_strerror(r),
+#ifdef EAI_SYSTEM
+			r==EAI_SYSTEM?(char*)strerror(errno):""
+#else
+			""
+#endif
+		);
+		return 0;
+	}
+	fd = create_tcp_accept_sock(res, 1, &noproto, 0,
+		cfg->ip_transparent, 0, 0, cfg->ip_freebind,
+		cfg->use_systemd, cfg->ip_dscp, "metrics");
+	freeaddrinfo(res);
+	if(fd == -1 && noproto) {
+		if(!noproto_is_err)
+			return 1; /* return success, but do nothing */
+		log_err("cannot open metrics interface %s %d : "
+			"protocol not supported", ip, nr);
+		return 0;
+	}
+	if(fd == -1) {
+		log_err("cannot open metrics interface %s %d", ip, nr);
+		return 0;
+	}
+	n = (struct listen_port*)calloc(1, sizeof(*n));
+	if(!n) {
+		sock_close(fd);
+		log_err("out of memory");
+		return 0;
+	}
+	n->next = *list;
+	*list = n;
+	n->fd = fd;
+	return 1;
+}
+
+struct listen_port* daemon_metrics_open_ports(struct config_file* cfg)
+{
+	struct listen_port* l = NULL;
+	log_assert(cfg->metrics_enable && cfg->metrics_port);
+	if(cfg->metrics_ifs.first) {
+		struct config_strlist* p;
+		for(p = cfg->metrics_ifs.first; p; p = p->next) {
+			if(!metrics_add_open(p->str, cfg->metrics_port, &l, 1,
+				cfg)) {
+				listening_ports_free(l);
+				return NULL;
+			}
+		}
+	} else {
+		/* defaults */
+		if(cfg->do_ip6 && !metrics_add_open("::1", cfg->metrics_port,
+			&l, 0, cfg)) {
+			listening_ports_free(l);
+			return NULL;
+		}
+		if(cfg->do_ip4 && !metrics_add_open("127.0.0.1",
+			cfg->metrics_port, &l, 1, cfg)) {
+			listening_ports_free(l);
+			return NULL;
+		}
+	}
+	return l;
+}
+
+int daemon_metrics_open_accept(struct daemon_metrics* m,
+	struct listen_port* ports, struct worker* worker)
+{
+	struct listen_port* p;
+	m->worker = worker;
+	for(p = ports; p; p = p->next) {
+		struct listen_list* n = (struct listen_list*)malloc(
+			sizeof(*n));
+		if(!n) {
+			log_err("out of memory");
+			return 0;
+		}
+		n->next = m->accept_list;
+		m->accept_list = n;
+		n->com = comm_point_create_raw(worker->base, p->fd, 0,
+			&metrics_accept_callback, m);
+		if(!n->com) {
+			log_err("could not create metrics accept comm point");
+			return 0;
+		}
+		/* keep this port open, its fd is kept in the portlist */
+		n->com->do_not_close = 1;
+	}
+	return 1;
+}
+
+void daemon_metrics_stop_accept(struct daemon_metrics* m)
+{
+	struct listen_list* p;
+	if(!m) return;
+	for(p=m->accept_list; p; p=p->next) {
+		comm_point_stop_listening(p->com);
+	}
+}
+
+void daemon_metrics_start_accept(struct daemon_metrics* m)
+{
+	struct listen_list* p;
+	if(!m) return;
+	for(p=m->accept_list; p; p=p->next) {
+		comm_point_start_listening(p->com, -1, -1);
+	}
+}
+
+int metrics_accept_callback(struct comm_point* c, void* arg, int err,
+	struct comm_reply* ATTR_UNUSED(rep))
+{
+	struct daemon_metrics* m = (struct daemon_metrics*)arg;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	int newfd;
+	struct metrics_state* n;
+	if(err != NETEVENT_NOERROR) {
+		log_err("error %d on metrics_accept_callback", err);
+		return 0;
+	}
+	newfd = comm_point_perform_accept(c, &addr, &addrlen);
+	if(newfd == -1)
+		return 0;
+	if(m->active >= m->max_active) {
+		log_warn("drop incoming metrics connection: too many "
+			"connections");
+	close_exit:
+		sock_close(newfd);
+		return 0;
+	}
+	n = (struct metrics_state*)calloc(1, sizeof(*n));
+	if(!n) {
+		log_err("out of memory");
+		goto close_exit;
+	}
+	n->buf = sldns_buffer_new(METRICS_REQUEST_MAX);
+	if(!n->buf) {
+		log_err("out of memory");
+		free(n);
+		goto close_exit;
+	}
+	n->c = comm_point_create_raw(m->worker->base, newfd, 0,
+		&metrics_http_callback, n);
+	if(!n->c) {
+		log_err("out of memory");
+		sldns_buffer_free(n->buf);
+		free(n);
+		goto close_exit;
+	}
+	log_addr(VERB_QUERY, "new metrics connection from", &addr, addrlen);
+	n->c->do_not_close = 0;
+	comm_point_stop_listening(n->c);
+	comm_point_start_listening(n->c, -1, METRICS_TCP_TIMEOUT);
+	n->m = m;
+	n->next = m->busy_list;
+	m->busy_list = n;
+	m->active ++;
+	return 0;
+}
+
+/** remove a connection from the busy list and delete it */
+static void
+metrics_clean_point(struct daemon_metrics* m, struct metrics_state* s)
+{
+	struct metrics_state** pp = &m->busy_list;
+	while(*pp) {
+		if(*pp == s) {
+			*pp = s->next;
+			break;
+		}
+		pp = &(*pp)->next;
+	}
+	m->active --;
+	metrics_state_delete(s);
+}
+
+/** print to the buffer, that is grown as needed */
+static int metrics_printf(sldns_buffer* buf, const char* format, ...)
+	ATTR_FORMAT(printf, 2, 3);
+
+/** print to the buffer, that is grown as needed */
+static int
+metrics_printf(sldns_buffer* buf, const char* format, ...)
+{
+	char line[1024];
+	va_list args;
+	int r;
+	va_start(args, format);
+	r = vsnprintf(line, sizeof(line), format, args);
+	va_end(args);
+	if(r < 0 || (size_t)r >= sizeof(line))
+		return 0;
+	if(!sldns_buffer_reserve(buf, (size_t)r))
+		return 0;
+	sldns_buffer_write(buf, line, (size_t)r);
+	return 1;
+}
+
+/** print the type and help lines of a metric family */
+static int
+metrics_family(sldns_buffer* buf, const char* name, const char* type,
+	const char* help)
+{
+	return metrics_printf(buf, "# TYPE unbound_%s %s\n"
+		"# HELP unbound_%s %s\n", name, type, name, help);
+}
+
+/** print a counter, family and value */
+static int
+metrics_counter(sldns_buffer* buf, const char* name, const char* help,
+	long long val)
+{
+	if(!metrics_family(buf, name, "counter", help))
+		return 0;
+	return metrics_printf(buf, "unbound_%s_total %llu\n", name,
+		(unsigned long long)val);
+}
+
+/** print a gauge, family and value */
+static int
+metrics_gauge(sldns_buffer* buf, const char* name, const char* help,
+	long long val)
+{
+	if(!metrics_family(buf, name, "gauge", help))
+		return 0;
+	return metrics_printf(buf, "unbound_%s %llu\n", name,
+		(unsigned long long)val);
+}
+
+/** print a gauge with a floating point value */
+static int
+metrics_gauge_d(sldns_buffer* buf, const char* name, const char* help,
+	double val)
+{
+	if(!metrics_family(buf, name, "gauge", help))
+		return 0;
+	return metrics_printf(buf, "unbound_%s %.6f\n", name, val);
+}
+
+/** print one labeled value of a counter family */
+static int
+metrics_label(sldns_buffer* buf, const char* name, const char* label,
+	const char* value, long long val)
+{
+	return metrics_printf(buf, "unbound_%s_total{%s=\"%s\"} %llu\n",
+		name, label, value, (unsigned long long)val);
+}
+
+/** print the response time histogram */
+static int
+metrics_hist(sldns_buffer* buf, struct ub_stats_info* s)
+{
+	struct timehist* hist;
+	size_t i;
+	unsigned long long cumul = 0;
+	if(!metrics_family(buf, "response_time_seconds", "histogram",
+		"Time to resolve queries that needed recursion."))
+		return 0;
+	hist = timehist_setup();
+	if(!hist)
+		return 0;
+	timehist_import(hist, s->svr.hist, NUM_BUCKETS_HIST);
+	/* the last bucket also has the larger values, it is +Inf */
+	for(i=0; i+1<hist->num; i++) {
+		cumul += (unsigned long long)hist->buckets[i].count;
+		if(!metrics_printf(buf, "unbound_response_time_seconds_bucket"
+			"{le=\"%d.%6.6d\"} %llu\n",
+			(int)hist->buckets[i].upper.tv_sec,
+			(int)hist->buckets[i].upper.tv_usec, cumul)) {
+			timehist_delete(hist);
+			return 0;
+		}
+	}
+	cumul += (unsigned long long)hist->buckets[hist->num-1].count;
+	timehist_delete(hist);
+	if(!metrics_printf(buf, "unbound_response_time_seconds_bucket"
+		"{le=\"+Inf\"} %llu\n", cumul))
+		return 0;
+	if(!metrics_printf(buf, "unbound_response_time_seconds_count %llu\n",
+		cumul))
+		return 0;
+	return metrics_printf(buf, "unbound_response_time_seconds_sum "
+		ARG_LL "d.%6.6d\n", s->mesh_replies_sum_wait_sec,
+		(int)s->mesh_replies_sum_wait_usec);
+}
+
+/** print one labeled latency histogram as the quantiles of a summary */
+static int
+metrics_summary(sldns_buffer* buf, const char* name, const char* label,
+	const char* value, struct lathist* h, int inhibit_zero)
+{
+	static const char* qs[] = {"0.5", "0.9", "0.99", "0.999"};
+	size_t i;
+	if(inhibit_zero && h->count == 0)
+		return 1;
+	for(i=0; i<sizeof(qs)/sizeof(qs[0]); i++) {
+		if(!metrics_printf(buf, "unbound_%s{%s=\"%s\",quantile=\"%s\"} "
+			"%.6f\n", name, label, value, qs[i],
+			lathist_quantile(h, atof(qs[i]))))
+			return 0;
+	}
+	if(!metrics_printf(buf, "unbound_%s_count{%s=\"%s\"} %llu\n", name,
+		label, value, (unsigned long long)h->count))
+		return 0;
+	return metrics_printf(buf, "unbound_%s_sum{%s=\"%s\"} %.6f\n", name,
+		label, value, (double)h->sum/1000000.);
+}
+
+/** print the latency histograms, statistics-latency */
+static int
+metrics_latency(sldns_buffer* buf, struct worker* worker)
+{
+	struct server_latency* lat;
+	int i, inhibit_zero = worker->env.cfg->stat_inhibit_zero;
+	char a[64], nm[80];
+	const sldns_lookup_table* lt;
+	if(!(lat = server_stats_latency_totals(worker)))
+		return 0;
+	if(!metrics_family(buf, "response_latency_seconds", "summary",
+		"Response time to clients, by answer source.") ||
+	   !metrics_summary(buf, "response_latency_seconds", "source",
+		"cache", &lat->client.cache, 0) ||
+	   !metrics_summary(buf, "response_latency_seconds", "source",
+		"recursion", &lat->client.recursion, 0))
+		goto fail;
+	if(!metrics_family(buf, "response_latency_qtype_seconds", "summary",
+		"Response time to clients, by query type."))
+		goto fail;
+	for(i=0; i<LATENCY_NUM_QTYPE; i++) {
+		if(!metrics_summary(buf, "response_latency_qtype_seconds",
+			"qtype", (i==LATENCY_NUM_QTYPE-1?"other":
+			sldns_rr_descript(latency_qtype_type(i))->_name),
+			&lat->client.qtype[i], inhibit_zero))
+			goto fail;
+	}
+	if(!metrics_family(buf, "response_latency_rcode_seconds", "summary",
+		"Response time to clients, by rcode of the answer."))
+		goto fail;
+	for(i=0; i<LATENCY_NUM_RCODE; i++) {
+		lt = sldns_lookup_by_id(sldns_rcodes, i);
+		if(!metrics_summary(buf, "response_latency_rcode_seconds",
+			"rcode", (i==LATENCY_NUM_RCODE-1 || !lt || !lt->name?
+			"other":lt->name), &lat->client.rcode[i],
+			inhibit_zero))
+			goto fail;
+	}
+	if(!metrics_family(buf, "upstream_rtt_seconds", "summary",
+		"Round trip time of UDP queries to upstream servers."))
+		goto fail;
+	for(i=0; i<lat->num_upstream; i++) {
+		addr_to_str(&lat->upstream[i].addr, lat->upstream[i].addrlen,
+			a, sizeof(a));
+		snprintf(nm, sizeof(nm), "%s@%d", a, (int)ntohs(
+			((struct sockaddr_in*)&lat->upstream[i].addr)->sin_port));
+		if(!metrics_summary(buf, "upstream_rtt_seconds", "upstream",
+			nm, &lat->upstream[i].hist, inhibit_zero))
+			goto fail;
+	}
+	if(!metrics_summary(buf, "upstream_rtt_seconds", "upstream", "other",
+		&lat->upstream[UPSTREAM_LATENCY_NUM].hist, inhibit_zero))
+		goto fail;
+	server_latency_delete(lat);
+	return 1;
+fail:
+	server_latency_delete(lat);
+	return 0;
+}
+
+/** print the memory usage */
+static int
+metrics_mem(sldns_buffer* buf, struct worker* worker, struct ub_stats_info* s)
+{
+	struct daemon* daemon = worker->daemon;
+	if(!metrics_family(buf, "memory_caches_bytes", "gauge",
+		"Memory in use by the caches."))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_caches_bytes{cache=\"%s\"} "
+		"%llu\n", "message", (unsigned long long)slabhash_get_mem(
+		daemon->env->msg_cache)))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_caches_bytes{cache=\"%s\"} "
+		"%llu\n", "rrset", (unsigned long long)slabhash_get_mem(
+		&daemon->env->rrset_cache->table)))
+		return 0;
+#ifdef USE_DNSCRYPT
+	if(daemon->dnscenv) {
+		if(!metrics_printf(buf, "unbound_memory_caches_bytes{cache="
+			"\"%s\"} %llu\n", "dnscrypt_shared_secret",
+			(unsigned long long)slabhash_get_mem(
+			daemon->dnscenv->shared_secrets_cache)))
+			return 0;
+		if(!metrics_printf(buf, "unbound_memory_caches_bytes{cache="
+			"\"%s\"} %llu\n", "dnscrypt_nonce",
+			(unsigned long long)slabhash_get_mem(
+			daemon->dnscenv->nonces_cache)))
+			return 0;
+	}
+#endif /* USE_DNSCRYPT */
+	if(!metrics_family(buf, "memory_modules_bytes", "gauge",
+		"Memory in use by the modules."))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_modules_bytes{module=\"%s\"} "
+		"%llu\n", "iterator", (unsigned long long)mod_get_mem(
+		&worker->env, "iterator")))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_modules_bytes{module=\"%s\"} "
+		"%llu\n", "validator", (unsigned long long)mod_get_mem(
+		&worker->env, "validator")))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_modules_bytes{module=\"%s\"} "
+		"%llu\n", "respip", (unsigned long long)mod_get_mem(
+		&worker->env, "respip")))
+		return 0;
+#ifdef CLIENT_SUBNET
+	if(!metrics_printf(buf, "unbound_memory_modules_bytes{module=\"%s\"} "
+		"%llu\n", "subnet", (unsigned long long)mod_get_mem(
+		&worker->env, "subnetcache")))
+		return 0;
+#endif /* CLIENT_SUBNET */
+#ifdef USE_IPSECMOD
+	if(!metrics_printf(buf, "unbound_memory_modules_bytes{module=\"%s\"} "
+		"%llu\n", "ipsecmod", (unsigned long long)mod_get_mem(
+		&worker->env, "ipsecmod")))
+		return 0;
+#endif /* USE_IPSECMOD */
+	if(!metrics_family(buf, "memory_buffers_bytes", "gauge",
+		"Memory in use by the connection buffers."))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_buffers_bytes{buffer=\"%s\"} "
+		"%llu\n", "streamwait",
+		(unsigned long long)s->svr.mem_stream_wait))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_buffers_bytes{buffer=\"%s\"} "
+		"%llu\n", "http_query",
+		(unsigned long long)s->svr.mem_http2_query_buffer))
+		return 0;
+	if(!metrics_printf(buf, "unbound_memory_buffers_bytes{buffer=\"%s\"} "
+		"%llu\n", "http_response",
+		(unsigned long long)s->svr.mem_http2_response_buffer))
+		return 0;
+	return 1;
+}
+
+/** print the extended statistics */
+static int
+metrics_ext(sldns_buffer* buf, struct ub_stats_info* s, int inhibit_zero)
+{
+	int i;
+	char nm[32];
+	const sldns_rr_descriptor* desc;
+	const sldns_lookup_table* lt;
+	if(!metrics_family(buf, "query_types", "counter",
+		"Queries by query type."))
+		return 0;
+	for(i=0; i<UB_STATS_QTYPE_NUM; i++) {
+		if(inhibit_zero && s->svr.qtype[i] == 0)
+			continue;
+		desc = sldns_rr_descript((uint16_t)i);
+		if(desc && desc->_name)
+			snprintf(nm, sizeof(nm), "%s", desc->_name);
+		else if(s->svr.qtype[i] == 0)
+			continue;
+		else	sldns_wire2str_type_buf((uint16_t)i, nm, sizeof(nm));
+		if(!metrics_label(buf, "query_types", "type", nm,
+			s->svr.qtype[i]))
+			return 0;
+	}
+	if(!metrics_label(buf, "query_types", "type", "other",
+		s->svr.qtype_big))
+		return 0;
+	if(!metrics_family(buf, "query_classes", "counter",
+		"Queries by query class."))
+		return 0;
+	for(i=0; i<UB_STATS_QCLASS_NUM; i++) {
+		if(inhibit_zero && s->svr.qclass[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_rr_classes, i);
+		if(lt && lt->name)
+			snprintf(nm, sizeof(nm), "%s", lt->name);
+		else if(s->svr.qclass[i] == 0)
+			continue;
+		else	snprintf(nm, sizeof(nm), "CLASS%d", i);
+		if(!metrics_label(buf, "query_classes", "class", nm,
+			s->svr.qclass[i]))
+			return 0;
+	}
+	if(!metrics_label(buf, "query_classes", "class", "other",
+		s->svr.qclass_big))
+		return 0;
+	if(!metrics_family(buf, "query_opcodes", "counter",
+		"Queries by opcode."))
+		return 0;
+	for(i=0; i<UB_STATS_OPCODE_NUM; i++) {
+		if(inhibit_zero && s->svr.qopcode[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_opcodes, i);
+		if(lt && lt->name)
+			snprintf(nm, sizeof(nm), "%s", lt->name);
+		else	snprintf(nm, sizeof(nm), "OPCODE%d", i);
+		if(!metrics_label(buf, "query_opcodes", "opcode", nm,
+			s->svr.qopcode[i]))
+			return 0;
+	}
+	if(!metrics_family(buf, "query_transport", "counter",
+		"Queries by transport of the incoming query."))
+		return 0;
+	if(!metrics_label(buf, "query_transport", "transport", "tcp",
+		s->svr.qtcp) ||
+	   !metrics_label(buf, "query_transport", "transport", "tls",
+		s->svr.qtls) ||
+	   !metrics_label(buf, "query_transport", "transport", "tls_resume",
+		s->svr.qtls_resume) ||
+	   !metrics_label(buf, "query_transport", "transport", "https",
+		s->svr.qhttps) ||
+	   !metrics_label(buf, "query_transport", "transport", "quic",
+		s->svr.qquic) ||
+	   !metrics_label(buf, "query_transport", "transport", "ipv6",
+		s->svr.qipv6))
+		return 0;
+	if(!metrics_family(buf, "query_outgoing", "counter",
+		"Queries sent to upstream servers, by transport."))
+		return 0;
+	if(!metrics_label(buf, "query_outgoing", "transport", "tcp",
+		s->svr.qtcp_outgoing) ||
+	   !metrics_label(buf, "query_outgoing", "transport", "udp",
+		s->svr.qudp_outgoing))
+		return 0;
+	if(!metrics_family(buf, "upstream_tls_handshakes", "counter",
+		"TLS connections to upstream servers, by handshake type."))
+		return 0;
+	if(!metrics_label(buf, "upstream_tls_handshakes", "type", "resume",
+		s->svr.qtls_outgoing_resume) ||
+	   !metrics_label(buf, "upstream_tls_handshakes", "type", "full",
+		s->svr.qtls_outgoing_full))
+		return 0;
+	if(!metrics_family(buf, "query_flags", "counter",
+		"Queries that had the header flag set."))
+		return 0;
+	if(!metrics_label(buf, "query_flags", "flag", "QR", s->svr.qbit_QR) ||
+	   !metrics_label(buf, "query_flags", "flag", "AA", s->svr.qbit_AA) ||
+	   !metrics_label(buf, "query_flags", "flag", "TC", s->svr.qbit_TC) ||
+	   !metrics_label(buf, "query_flags", "flag", "RD", s->svr.qbit_RD) ||
+	   !metrics_label(buf, "query_flags", "flag", "RA", s->svr.qbit_RA) ||
+	   !metrics_label(buf, "query_flags", "flag", "Z", s->svr.qbit_Z) ||
+	   !metrics_label(buf, "query_flags", "flag", "AD", s->svr.qbit_AD) ||
+	   !metrics_label(buf, "query_flags", "flag", "CD", s->svr.qbit_CD))
+		return 0;
+	if(!metrics_family(buf, "query_edns", "counter",
+		"Queries with EDNS, and with the EDNS DO bit."))
+		return 0;
+	if(!metrics_label(buf, "query_edns", "edns", "present",
+		s->svr.qEDNS) ||
+	   !metrics_label(buf, "query_edns", "edns", "DO", s->svr.qEDNS_DO))
+		return 0;
+	if(!metrics_family(buf, "answer_rcodes", "counter",
+		"Answers by return code."))
+		return 0;
+	for(i=0; i<UB_STATS_RCODE_NUM; i++) {
+		if(inhibit_zero && s->svr.ans_rcode[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_rcodes, i);
+		if(lt && lt->name)
+			snprintf(nm, sizeof(nm), "%s", lt->name);
+		else	snprintf(nm, sizeof(nm), "RCODE%d", i);
+		if(!metrics_label(buf, "answer_rcodes", "rcode", nm,
+			s->svr.ans_rcode[i]))
+			return 0;
+	}
+	if(!metrics_label(buf, "answer_rcodes", "rcode", "nodata",
+		s->svr.ans_rcode_nodata))
+		return 0;
+	if(!metrics_family(buf, "rpz_actions", "counter",
+		"Answers changed by response policy zone actions."))
+		return 0;
+	for(i=0; i<UB_STATS_RPZ_ACTION_NUM; i++) {
+		if(i == RPZ_NO_OVERRIDE_ACTION)
+			continue;
+		if(inhibit_zero && s->svr.rpz_action[i] == 0)
+			continue;
+		if(!metrics_label(buf, "rpz_actions", "action",
+			rpz_action_to_string(i), s->svr.rpz_action[i]))
+			return 0;
+	}
+	if(!metrics_counter(buf, "answers_secure",
+		"Answers that were secure.", s->svr.ans_secure) ||
+	   !metrics_counter(buf, "answers_bogus",
+		"Answers that were bogus.", s->svr.ans_bogus) ||
+	   !metrics_counter(buf, "rrset_bogus",
+		"RRsets marked bogus by the validator.", s->svr.rrset_bogus) ||
+	   !metrics_counter(buf, "queries_ratelimited",
+		"Queries to upstream that were ratelimited.",
+		s->svr.queries_ratelimited) ||
+	   !metrics_counter(buf, "queries_hedged",
+		"Hedged queries to upstream, sent because a reply was slow.",
+		s->svr.queries_hedged) ||
+	   !metrics_counter(buf, "unwanted_replies",
+		"Replies that were unwanted or unsolicited.",
+		s->svr.unwanted_replies) ||
+	   !metrics_counter(buf, "unwanted_queries",
+		"Queries that were refused or dropped.",
+		s->svr.unwanted_queries))
+		return 0;
+	if(!metrics_family(buf, "cache_count", "gauge",
+		"Number of items in the caches."))
+		return 0;
+	if(!metrics_printf(buf, "unbound_cache_count{cache=\"%s\"} %llu\n",
+		"message", (unsigned long long)s->svr.msg_cache_count) ||
+	   !metrics_printf(buf, "unbound_cache_count{cache=\"%s\"} %llu\n",
+		"rrset", (unsigned long long)s->svr.rrset_cache_count) ||
+	   !metrics_printf(buf, "unbound_cache_count{cache=\"%s\"} %llu\n",
+		"infra", (unsigned long long)s->svr.infra_cache_count) ||
+	   !metrics_printf(buf, "unbound_cache_count{cache=\"%s\"} %llu\n",
+		"key", (unsigned long long)s->svr.key_cache_count))
+		return 0;
+	if(!metrics_gauge(buf, "tcp_usage",
+		"Number of incoming TCP connections in use.",
+		s->svr.tcp_accept_usage))
+		return 0;
+	return 1;
+}
+
+int
+metrics_print(struct worker* worker, sldns_buffer* buf)
+{
+	struct daemon* daemon = worker->daemon;
+	struct ub_stats_info total;
+	struct ub_stats_info s;
+	struct timeval up;
+	int i;
+	memset(&total, 0, sizeof(total));
+	if(!metrics_family(buf, "thread_queries", "counter",
+		"Queries received, by thread."))
+		return 0;
+	for(i=0; i<daemon->num; i++) {
+		/* does not interrupt the other threads, the totals since
+		 * start, that are not reset by unbound-control stats */
+		server_stats_obtain_totals(worker, daemon->workers[i], &s);
+		if(!metrics_printf(buf, "unbound_thread_queries_total"
+			"{thread=\"%d\"} %llu\n", i,
+			(unsigned long long)s.svr.num_queries))
+			return 0;
+		if(i == 0)
+			total = s;
+		else	server_stats_add(&total, &s);
+	}
+	total.mesh_time_median /= (double)daemon->num;
+	timeval_subtract(&up, worker->env.now_tv, &daemon->time_boot);
+
+	if(!metrics_counter(buf, "queries", "Queries received.",
+		total.svr.num_queries) ||
+	   !metrics_counter(buf, "queries_ip_ratelimited",
+		"Queries dropped by ip ratelimiting.",
+		total.svr.num_queries_ip_ratelimited) ||
+	   !metrics_counter(buf, "queries_timed_out",
+		"Queries dropped because they waited too long in the "
+		"socket buffer.", total.svr.num_queries_timed_out) ||
+	   !metrics_counter(buf, "cache_hits",
+		"Queries answered from the cache.",
+		total.svr.num_queries - total.svr.num_queries_missed_cache) ||
+	   !metrics_counter(buf, "cache_misses",
+		"Queries that needed recursion.",
+		total.svr.num_queries_missed_cache) ||
+	   !metrics_counter(buf, "prefetches",
+		"Cache prefetches performed.",
+		total.svr.num_queries_prefetch) ||
+	   !metrics_counter(buf, "expired",
+		"Answers that were served from expired records.",
+		total.svr.ans_expired) ||
+	   !metrics_counter(buf, "recursive_replies",
+		"Replies sent to queries that needed recursion.",
+		total.mesh_replies_sent) ||
+	   !metrics_counter(buf, "request_list_exceeded",
+		"Queries dropped because the request list was full.",
+		total.mesh_dropped) ||
+	   !metrics_counter(buf, "request_list_overwritten",
+		"Old queries in the request list that were replaced.",
+		total.mesh_jostled))
+		return 0;
+	if(!metrics_family(buf, "queries_cookie", "counter",
+		"Queries with a DNS Cookie, by cookie state."))
+		return 0;
+	if(!metrics_label(buf, "queries_cookie", "state", "valid",
+		total.svr.num_queries_cookie_valid) ||
+	   !metrics_label(buf, "queries_cookie", "state", "client",
+		total.svr.num_queries_cookie_client) ||
+	   !metrics_label(buf, "queries_cookie", "state", "invalid",
+		total.svr.num_queries_cookie_invalid))
+		return 0;
+	if(!metrics_gauge(buf, "request_list_current_all",
+		"Queries in the request list, also internal ones.",
+		total.mesh_num_states) ||
+	   !metrics_gauge(buf, "request_list_current_user",
+		"Queries in the request list from clients.",
+		total.mesh_num_reply_states) ||
+	   !metrics_gauge_d(buf, "recursion_time_median_seconds",
+		"Median time for recursive queries.",
+		total.mesh_time_median) ||
+	   !metrics_gauge_d(buf, "query_queue_time_max_seconds",
+		"Max time a query waited in the socket buffer.",
+		(double)total.svr.max_query_time_us/1000000.) ||
+	   !metrics_gauge_d(buf, "uptime_seconds",
+		"Time since the server started.",
+		(double)up.tv_sec + (double)up.tv_usec/1000000.))
+		return 0;
+	if(!metrics_hist(buf, &total))
+		return 0;
+	if(!metrics_mem(buf, worker, &total))
+		return 0;
+	if(daemon->cfg->stat_extended) {
+		if(!metrics_ext(buf, &total, daemon->cfg->stat_inhibit_zero))
+			return 0;
+	}
+	if(daemon->cfg->stat_latency) {
+		if(!metrics_latency(buf, worker))
+			return 0;
+	}
+	return metrics_printf(buf, "# EOF\n");
+}
+
+/** create the response for the request in the buffer */
+static int
+metrics_respond(struct metrics_state* s)
+{
+	sldns_buffer* body;
+	const char* status = "200 OK";
+	char* req = (char*)sldns_buffer_begin(s->buf);
+	char* path, *end;
+	int head = 0;
+	/* the request line, GET /metrics HTTP/1.1 */
+	if(strncmp(req, "GET ", 4) == 0) {
+		path = req+4;
+	} else if(strncmp(req, "HEAD ", 5) == 0) {
+		path = req+5;
+		head = 1;
+	} else {
+		path = NULL;
+		status = "405 Method Not Allowed";
+	}
+	if(path) {
+		end = path + strcspn(path, " ?\r\n");
+		if((size_t)(end-path) != strlen("/metrics") ||
+			strncmp(path, "/metrics", (size_t)(end-path)) != 0)
+			status = "404 Not Found";
+	}
+	if(!(body = sldns_buffer_new(65536)))
+		return 0;
+	if(strcmp(status, "200 OK") == 0) {
+		if(!metrics_print(s->m->worker, body)) {
+			sldns_buffer_free(body);
+			return 0;
+		}
+	} else {
+		if(!metrics_printf(body, "%s\n", status)) {
+			sldns_buffer_free(body);
+			return 0;
+		}
+	}
+	sldns_buffer_flip(body);
+	sldns_buffer_clear(s->buf);
+	if(!metrics_printf(s->buf, "HTTP/1.1 %s\r\n"
+		"Content-Type: %s\r\n"
+		"Content-Length: %u\r\n"
+		"Connection: close\r\n"
+		"\r\n", status, (strcmp(status, "200 OK") == 0?
+		METRICS_CONTENT_TYPE:"text/plain"),
+		(unsigned)sldns_buffer_limit(body))) {
+		sldns_buffer_free(body);
+		return 0;
+	}
+	if(!head) {
+		if(!sldns_buffer_reserve(s->buf, sldns_buffer_limit(body))) {
+			sldns_buffer_free(body);
+			return 0;
+		}
+		sldns_buffer_write(s->buf, sldns_buffer_begin(body),
+			sldns_buffer_limit(body));
+	}
+	sldns_buffer_free(body);
+	sldns_buffer_flip(s->buf);
+	return 1;
+}
+
+/** read the request, returns false on failure or close */
+static int
+metrics_read(struct metrics_state* s)
+{
+	ssize_t r;
+	char* req;
+	if(sldns_buffer_remaining(s->buf) <= 1) {
+		verbose(VERB_QUERY, "metrics request too long");
+		return 0;
+	}
+	/* keep a zero at the end, for string functions */
+	r = recv(s->c->fd, (void*)sldns_buffer_current(s->buf),
+		sldns_buffer_remaining(s->buf)-1, 0);
+	if(r == 0)
+		return 0;
+	if(r == -1) {
+#ifndef USE_WINSOCK
+		if(errno == EINTR || errno == EAGAIN)
+			return 1;
+		verbose(VERB_QUERY, "metrics recv: %s", strerror(errno));
+#else
+		if(WSAGetLastError() == WSAEINPROGRESS ||
+			WSAGetLastError() == WSAEWOULDBLOCK)
+			return 1;
+		verbose(VERB_QUERY, "metrics recv: %s",
+			wsa_strerror(WSAGetLastError()));
+#endif
+		return 0;
+	}
+	sldns_buffer_skip(s->buf, r);
+	*sldns_buffer_current(s->buf) = 0;
+	req = (char*)sldns_buffer_begin(s->buf);
+	if(!strstr(req, "\r\n\r\n") && !strstr(req, "\n\n"))
+		return 1; /* wait for the rest of the headers */
+	if(!metrics_respond(s)) {
+		log_err("out of memory creating the metrics response");
+		return 0;
+	}
+	s->writing = 1;
+	comm_point_listen_for_rw(s->c, 0, 1);
+	return 1;
+}
+
+/** write the response, returns false when done or on failure */
+static int
+metrics_write(struct metrics_state* s)
+{
+	ssize_t r = send(s->c->fd, (void*)sldns_buffer_current(s->buf),
+		sldns_buffer_remaining(s->buf), 0);
+	if(r == -1) {
+#ifndef USE_WINSOCK
+		if(errno == EINTR || errno == EAGAIN)
+			return 1;
+		verbose(VERB_QUERY, "metrics send: %s", strerror(errno));
+#else
+		if(WSAGetLastError() == WSAEINPROGRESS ||
+			WSAGetLastError() == WSAEWOULDBLOCK)
+			return 1;
+		verbose(VERB_QUERY, "metrics send: %s",
+			wsa_strerror(WSAGetLastError()));
+#endif
+		return 0;
+	}
+	sldns_buffer_skip(s->buf, r);
+	return sldns_buffer_remaining(s->buf) > 0;
+}
+
+int metrics_http_callback(struct comm_point* c, void* arg, int err,
+	struct comm_reply* ATTR_UNUSED(rep))
+{
+	struct metrics_state* s = (struct metrics_state*)arg;
+	int more;
+	log_assert(s->c == c);
+	if(err != NETEVENT_NOERROR) {
+		if(err == NETEVENT_TIMEOUT)
+			verbose(VERB_QUERY, "metrics connection timed out");
+		metrics_clean_point(s->m, s);
+		return 0;
+	}
+	if(s->writing)
+		more = metrics_write(s);
+	else	more = metrics_read(s);
+	if(!more)
+		metrics_clean_point(s->m, s);
+	return 0;
+}
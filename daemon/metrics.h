@@ -0,0 +1,155 @@
+/*
+ * daemon/metrics.h - serve statistics over HTTP for the unbound daemon.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the metrics listener for the daemon. It serves the
+ * statistics counters over plain HTTP in the OpenMetrics text format, so
+ * that monitoring systems can scrape them without unbound-control.
+ * The listener runs on the first thread, like the remote control, and
+ * reads the statistics of the other threads without interrupting them.
+ */
+
+#ifndef DAEMON_METRICS_H
+#define DAEMON_METRICS_H
+struct config_file;
+struct listen_list;
+struct listen_port;
+struct worker;
+struct comm_reply;
+struct comm_point;
+struct sldns_buffer;
+struct daemon_metrics;
+
+/** number of milliseconds timeout on a metrics HTTP connection */
+#define METRICS_TCP_TIMEOUT 10000
+/** max length of the HTTP request, the metrics request is small */
+#define METRICS_REQUEST_MAX 4096
+/** max number of metrics connections that are serviced at the same time */
+#define METRICS_MAX_ACTIVE 10
+
+/**
+ * A busy metrics HTTP connection.
+ */
+struct metrics_state {
+	/** the next item in list */
+	struct metrics_state* next;
+	/** the commpoint */
+	struct comm_point* c;
+	/** the buffer with the request, and then with the response */
+	struct sldns_buffer* buf;
+	/** if the response is being written */
+	int writing;
+	/** the metrics state this is part of */
+	struct daemon_metrics* m;
+};
+
+/**
+ * The metrics listener state. Created for the first thread.
+ */
+struct daemon_metrics {
+	/** the worker for this metrics listener */
+	struct worker* worker;
+	/** commpoints for accepting metrics connections */
+	struct listen_list* accept_list;
+	/** number of active commpoints that are serving metrics */
+	int active;
+	/** max active commpoints */
+	int max_active;
+	/** current commpoints busy; should be a short list, malloced */
+	struct metrics_state* busy_list;
+};
+
+/**
+ * Create new metrics listener state for the daemon.
+ * @param cfg: config file.
+ * @return new state, or NULL on failure.
+ */
+struct daemon_metrics* daemon_metrics_create(struct config_file* cfg);
+
+/**
+ * Metrics listener state to delete.
+ * @param m: state to delete.
+ */
+void daemon_metrics_delete(struct daemon_metrics* m);
+
+/**
+ * Metrics listener state to clear up. Busy and accept points are closed.
+ * Does not delete the state itself.
+ * @param m: state to clear.
+ */
+void daemon_metrics_clear(struct daemon_metrics* m);
+
+/**
+ * Open and create listening ports for the metrics listener.
+ * @param cfg: config options.
+ * @return list of ports or NULL on failure.
+ *	can be freed with listening_ports_free().
+ */
+struct listen_port* daemon_metrics_open_ports(struct config_file* cfg);
+
+/**
+ * Setup comm points for accepting metrics connections.
+ * @param m: state
+ * @param ports: already opened ports.
+ * @param worker: worker with communication base.
+ * @return false on error.
+ */
+int daemon_metrics_open_accept(struct daemon_metrics* m,
+	struct listen_port* ports, struct worker* worker);
+
+/**
+ * Stop accept handlers for TCP (until enabled again)
+ * @param m: state
+ */
+void daemon_metrics_stop_accept(struct daemon_metrics* m);
+
+/**
+ * Start accept handlers for TCP (after stopped)
+ * @param m: state
+ */
+void daemon_metrics_start_accept(struct daemon_metrics* m);
+
+/**
+ * Print the statistics in OpenMetrics text format.
+ * The statistics of the threads are not reset.
+ * @param worker: the first worker, with the daemon.
+ * @param buf: buffer to append to, it is grown as needed.
+ * @return false on alloc failure.
+ */
+int metrics_print(struct worker* worker, struct sldns_buffer* buf);
+
+#endif /* DAEMON_METRICS_H */
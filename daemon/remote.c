@@ -59,19 +59,24 @@
 #include "daemon/daemon.h"
 #include "daemon/stats.h"
 #include "daemon/cachedump.h"
+#include "daemon/acl_list.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
 #include "util/module.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/cache/infra.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
 #include "services/authzone.h"
 #include "services/rpz.h"
+#include "services/view.h"
+#include "respip/respip.h"
 #include "util/storage/slabhash.h"
 #include "util/fptr_wlist.h"
+#include "util/tube.h"
 #include "util/data/dname.h"
 #include "validator/validator.h"
 #include "validator/val_kcache.h"
@@ -89,6 +94,7 @@
 #include "sldns/sbuffer.h"
 #include "util/timeval_func.h"
 #include "util/edns.h"
+#include "util/topk.h"
 #ifdef USE_CACHEDB
 #include "cachedb/cachedb.h"
 #endif
@@ -115,6 +121,72 @@
 #define MAX_CMD_STRLINE 1024
 #define MAX_STDIN_STRLINE 2048
 
+/**
+ * The structures that the fast reload constructs from the new config.
+ * After the swap, it holds the structures that were replaced.
+ */
+struct fast_reload_construct {
+	/** next in the list of retired structures */
+	struct fast_reload_construct* next;
+	/** the new config. After the swap it holds the config lists that
+	 * the replaced structures were built from. */
+	struct config_file* cfg;
+	/** views */
+	struct views* views;
+	/** access control list */
+	struct acl_list* acl;
+	/** local zones */
+	struct local_zones* local_zones;
+	/** forward zones */
+	struct iter_forwards* fwds;
+	/** stub zones and root hints */
+	struct iter_hints* hints;
+	/** response ip set */
+	struct respip_set* respip_set;
+	/** if response ip is used, by the global set or a view */
+	int use_response_ip;
+	/** after the swap, the count of the queries in progress that
+	 * refer to the replaced structures */
+	struct mesh_retired retired;
+	/** the remote control state with the list of retired structures */
+	struct daemon_remote* rc;
+};
+
+/**
+ * Fast reload in progress. The thread reads the config and constructs
+ * the structures, the remote control thread swaps them in.
+ */
+struct fast_reload_thread {
+	/** the thread */
+	ub_thread_type tid;
+	/** the thread number, for the log */
+	int thread_num;
+	/** the remote control worker */
+	struct worker* worker;
+	/** the config file to read */
+	const char* cfgfile;
+	/** the chroot that the config file is read with */
+	const char* chroot;
+	/** the remote control connection that waits for the result */
+	struct rc_state* client;
+	/** if the result is printed with the timing */
+	int verbose;
+	/** the constructed structures, NULL after the swap */
+	struct fast_reload_construct* ct;
+	/** if the construction succeeded, written by the thread */
+	int ok;
+	/** error string if it failed, written by the thread */
+	char err[256];
+	/** the time of the start, the config read and the construction */
+	struct timeval time_start, time_read, time_construct;
+};
+
+/**
+ * Stop the fast reload that is in progress, wait for its thread.
+ * @param rc: the remote control state.
+ */
+static void fast_reload_thread_stop(struct daemon_remote* rc);
+
 static int
 remote_setup_ctx(struct daemon_remote* rc, struct config_file* cfg)
 {
@@ -176,6 +248,10 @@ daemon_remote_create(struct config_file* cfg)
 		return NULL;
 	}
 	rc->max_active = 10;
+	lock_basic_init(&rc->fast_reload_gate);
+	lock_basic_init(&rc->fast_reload_retired_lock);
+	lock_protect(&rc->fast_reload_retired_lock, &rc->fast_reload_retired,
+		sizeof(rc->fast_reload_retired));
 
 	if(!cfg->remote_control_enable) {
 		rc->ctx = NULL;
@@ -204,6 +280,8 @@ void daemon_remote_clear(struct daemon_remote* rc)
 {
 	struct rc_state* p, *np;
 	if(!rc) return;
+	/* the client connection of the fast reload is in the busy list */
+	fast_reload_thread_stop(rc);
 	/* but do not close the ports */
 	listen_list_delete(rc->accept_list);
 	rc->accept_list = NULL;
@@ -226,6 +304,10 @@ void daemon_remote_delete(struct daemon_remote* rc)
 {
 	if(!rc) return;
 	daemon_remote_clear(rc);
+	daemon_remote_fast_reload_cleanup(rc);
+	tube_delete(rc->fast_reload_ack);
+	lock_basic_destroy(&rc->fast_reload_gate);
+	lock_basic_destroy(&rc->fast_reload_retired_lock);
 	if(rc->ctx) {
 		SSL_CTX_free(rc->ctx);
 	}
@@ -806,7 +888,8 @@ print_mem(RES* ssl, struct worker* worker, struct daemon* daemon,
     size_t dynlib = 0;
 #endif /* WITH_DYNLIBMODULE */
 	msg = slabhash_get_mem(daemon->env->msg_cache);
-	rrset = slabhash_get_mem(&daemon->env->rrset_cache->table);
+	rrset = slabhash_get_mem(&daemon->env->rrset_cache->table)
+		+ deleg_cache_get_mem(daemon->env->deleg_cache);
 	val = mod_get_mem(&worker->env, "validator");
 	iter = mod_get_mem(&worker->env, "iterator");
 	respip = mod_get_mem(&worker->env, "respip");
@@ -996,6 +1079,10 @@ print_ext(RES* ssl, struct ub_stats_info* s, int inhibit_zero)
 		(unsigned long)s->svr.qtls)) return 0;
 	if(!ssl_printf(ssl, "num.query.tls.resume"SQ"%lu\n",
 		(unsigned long)s->svr.qtls_resume)) return 0;
+	if(!ssl_printf(ssl, "num.query.tlsout.resume"SQ"%lu\n",
+		(unsigned long)s->svr.qtls_outgoing_resume)) return 0;
+	if(!ssl_printf(ssl, "num.query.tlsout.full"SQ"%lu\n",
+		(unsigned long)s->svr.qtls_outgoing_full)) return 0;
 	if(!ssl_printf(ssl, "num.query.ipv6"SQ"%lu\n",
 		(unsigned long)s->svr.qipv6)) return 0;
 	if(!ssl_printf(ssl, "num.query.https"SQ"%lu\n",
@@ -1047,6 +1134,8 @@ print_ext(RES* ssl, struct ub_stats_info* s, int inhibit_zero)
 	/* iteration */
 	if(!ssl_printf(ssl, "num.query.ratelimited"SQ"%lu\n",
 		(unsigned long)s->svr.queries_ratelimited)) return 0;
+	if(!ssl_printf(ssl, "num.query.hedged"SQ"%lu\n",
+		(unsigned long)s->svr.queries_hedged)) return 0;
 	/* validation */
 	if(!ssl_printf(ssl, "num.answer.secure"SQ"%lu\n",
 		(unsigned long)s->svr.ans_secure)) return 0;
@@ -1114,6 +1203,85 @@ print_ext(RES* ssl, struct ub_stats_info* s, int inhibit_zero)
 	return 1;
 }
 
+/** print the quantiles of one latency histogram */
+static int
+print_lathist(RES* ssl, const char* nm, struct lathist* h, int inhibit_zero)
+{
+	if(inhibit_zero && h->count == 0)
+		return 1;
+	if(!ssl_printf(ssl, "latency.%s.count"SQ"%lu\n", nm,
+		(unsigned long)h->count)) return 0;
+	if(!ssl_printf(ssl, "latency.%s.avg"SQ"%.6f\n", nm,
+		(h->count?(double)h->sum/(double)h->count/1000000.:0.)))
+		return 0;
+	if(!ssl_printf(ssl, "latency.%s.p50"SQ"%.6f\n", nm,
+		lathist_quantile(h, 0.50))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p90"SQ"%.6f\n", nm,
+		lathist_quantile(h, 0.90))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p99"SQ"%.6f\n", nm,
+		lathist_quantile(h, 0.99))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p999"SQ"%.6f\n", nm,
+		lathist_quantile(h, 0.999))) return 0;
+	return 1;
+}
+
+/** print the latency histograms, statistics-latency */
+static int
+print_latency(RES* ssl, struct worker* worker, int reset)
+{
+	struct server_latency* lat;
+	int i, inhibit_zero = worker->env.cfg->stat_inhibit_zero;
+	char nm[128], a[64];
+	const sldns_rr_descriptor* desc;
+	const sldns_lookup_table* lt;
+	lat = server_stats_latency(worker, reset);
+	if(!lat) {
+		log_err("out of memory");
+		return 0;
+	}
+	if(!print_lathist(ssl, "cache", &lat->client.cache, 0) ||
+		!print_lathist(ssl, "recursion", &lat->client.recursion, 0))
+		goto fail;
+	for(i=0; i<LATENCY_NUM_QTYPE; i++) {
+		if(i == LATENCY_NUM_QTYPE-1) {
+			snprintf(nm, sizeof(nm), "qtype.other");
+		} else {
+			desc = sldns_rr_descript(latency_qtype_type(i));
+			snprintf(nm, sizeof(nm), "qtype.%s", desc->_name);
+		}
+		if(!print_lathist(ssl, nm, &lat->client.qtype[i],
+			inhibit_zero))
+			goto fail;
+	}
+	for(i=0; i<LATENCY_NUM_RCODE; i++) {
+		lt = sldns_lookup_by_id(sldns_rcodes, i);
+		if(i == LATENCY_NUM_RCODE-1 || !lt || !lt->name)
+			snprintf(nm, sizeof(nm), "rcode.other");
+		else	snprintf(nm, sizeof(nm), "rcode.%s", lt->name);
+		if(!print_lathist(ssl, nm, &lat->client.rcode[i],
+			inhibit_zero))
+			goto fail;
+	}
+	for(i=0; i<lat->num_upstream; i++) {
+		addr_to_str(&lat->upstream[i].addr, lat->upstream[i].addrlen,
+			a, sizeof(a));
+		snprintf(nm, sizeof(nm), "upstream.%s@%d", a,
+			(int)ntohs(((struct sockaddr_in*)&lat->upstream[i].addr)
+			->sin_port));
+		if(!print_lathist(ssl, nm, &lat->upstream[i].hist,
+			inhibit_zero))
+			goto fail;
+	}
+	if(!print_lathist(ssl, "upstream.other",
+		&lat->upstream[UPSTREAM_LATENCY_NUM].hist, inhibit_zero))
+		goto fail;
+	server_latency_delete(lat);
+	return 1;
+fail:
+	server_latency_delete(lat);
+	return 0;
+}
+
 /** do the stats command */
 static void
 do_stats(RES* ssl, struct worker* worker, int reset)
@@ -1147,6 +1315,10 @@ do_stats(RES* ssl, struct worker* worker, int reset)
 		if(!print_ext(ssl, &total, daemon->cfg->stat_inhibit_zero))
 			return;
 	}
+	if(daemon->cfg->stat_latency) {
+		if(!print_latency(ssl, worker, reset))
+			return;
+	}
 }
 
 /** parse commandline argument domain name */
@@ -2630,7 +2802,7 @@ static void
 do_dump_requestlist(RES* ssl, struct worker* worker)
 {
 	struct mesh_area* mesh;
-	struct mesh_state* m;
+	struct mesh_state* l, *m, **arr;
 	int num = 0;
 	char buf[257];
 	char timebuf[32];
@@ -2642,9 +2814,13 @@ do_dump_requestlist(RES* ssl, struct worker* worker)
 	/* show worker mesh contents */
 	mesh = worker->env.mesh;
 	if(!mesh) return;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
-		char* t = sldns_wire2str_type(m->s.qinfo.qtype);
-		char* c = sldns_wire2str_class(m->s.qinfo.qclass);
+	/* sorted by query name, without memory in the list order */
+	arr = mesh_all_sorted(mesh);
+	for(l = mesh->all_first; l; l = l->all_next) {
+		char* t, *c;
+		m = arr?arr[num]:l;
+		t = sldns_wire2str_type(m->s.qinfo.qtype);
+		c = sldns_wire2str_class(m->s.qinfo.qclass);
 		dname_str(m->s.qinfo.qname, buf);
 		get_mesh_age(m, timebuf, sizeof(timebuf), &worker->env);
 		get_mesh_status(mesh, m, statbuf, sizeof(statbuf));
@@ -2653,12 +2829,14 @@ do_dump_requestlist(RES* ssl, struct worker* worker)
 			statbuf)) {
 			free(t);
 			free(c);
+			free(arr);
 			return;
 		}
 		num++;
 		free(t);
 		free(c);
 	}
+	free(arr);
 }
 
 /** structure for argument data for dump infra host */
@@ -2707,13 +2885,14 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 	if(!ssl_printf(a->ssl, "%s %s ttl %lu ping %d var %d rtt %d rto %d "
 		"tA %d tAAAA %d tother %d "
 		"ednsknown %d edns %d delay %d lame dnssec %d rec %d A %d "
-		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
+		"other %d p50 %d p95 %d\n", ip_str, name,
+		(unsigned long)(d->ttl - a->now),
 		d->rtt.srtt, d->rtt.rttvar, rtt_notimeout(&d->rtt), d->rtt.rto,
 		d->timeout_A, d->timeout_AAAA, d->timeout_other,
 		(int)d->edns_lame_known, (int)d->edns_version,
 		(int)(a->now<d->probedelay?(d->probedelay - a->now):0),
 		(int)d->isdnsseclame, (int)d->rec_lame, (int)d->lame_type_A,
-		(int)d->lame_other)) {
+		(int)d->lame_other, rtt_p50(&d->rtt), rtt_p95(&d->rtt))) {
 		a->ssl_failed = 1;
 		return;
 	}
@@ -3412,6 +3591,645 @@ do_print_cookie_secrets(RES* ssl, struct worker* worker) {
 	explicit_bzero(secret_hex, sizeof(secret_hex));
 }
 
+/** the workers that have heavy hitter sketches that can be read */
+static int
+top_num_workers(struct worker* worker)
+{
+#ifndef THREADS_DISABLED
+	return worker->daemon->num;
+#else
+	/* the other processes are not in our memory */
+	(void)worker;
+	return 1;
+#endif
+}
+
+/** get the worker with the heavy hitter sketches to read */
+static struct worker*
+top_worker(struct worker* worker, int i)
+{
+#ifndef THREADS_DISABLED
+	return worker->daemon->workers[i];
+#else
+	(void)i;
+	return worker;
+#endif
+}
+
+/** print a heavy hitter key */
+static void
+top_key_str(enum topk_kind kind, struct topk_entry* e, char* buf,
+	size_t len)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	char a[64];
+	uint16_t port;
+	memset(&addr, 0, sizeof(addr));
+	switch(kind) {
+	case topk_client:
+		if(e->key[0] == 6) {
+			struct sockaddr_in6* sa6 = (struct sockaddr_in6*)&addr;
+			sa6->sin6_family = AF_INET6;
+			memmove(&sa6->sin6_addr, e->key+1, e->keylen-1);
+			addrlen = (socklen_t)sizeof(*sa6);
+		} else {
+			struct sockaddr_in* sa = (struct sockaddr_in*)&addr;
+			sa->sin_family = AF_INET;
+			memmove(&sa->sin_addr, e->key+1, e->keylen-1);
+			addrlen = (socklen_t)sizeof(*sa);
+		}
+		addr_to_str(&addr, addrlen, a, sizeof(a));
+		snprintf(buf, len, "%s/%d", a, (e->key[0]==6?
+			TOPK_CLIENT_PREFIX6:TOPK_CLIENT_PREFIX4));
+		return;
+	case topk_qname:
+	case topk_zone:
+		dname_str(e->key, buf);
+		return;
+	case topk_upstream:
+	case topk_servfail:
+		memmove(&port, e->key+1, 2);
+		if(e->key[0] == 6) {
+			struct sockaddr_in6* sa6 = (struct sockaddr_in6*)&addr;
+			sa6->sin6_family = AF_INET6;
+			memmove(&sa6->sin6_addr, e->key+3, INET6_SIZE);
+			addrlen = (socklen_t)sizeof(*sa6);
+		} else {
+			struct sockaddr_in* sa = (struct sockaddr_in*)&addr;
+			sa->sin_family = AF_INET;
+			memmove(&sa->sin_addr, e->key+3, INET_SIZE);
+			addrlen = (socklen_t)sizeof(*sa);
+		}
+		addr_to_str(&addr, addrlen, a, sizeof(a));
+		snprintf(buf, len, "%s@%d", a, (int)ntohs(port));
+		return;
+	default:
+		break;
+	}
+	snprintf(buf, len, "unknown");
+}
+
+/** print the heavy hitters of one kind, merged over the threads */
+static int
+top_print_kind(RES* ssl, struct worker* worker, enum topk_kind kind, int n)
+{
+	int i, num = top_num_workers(worker), cnt;
+	struct topk* total;
+	struct topk_entry** list;
+	char buf[LDNS_MAX_DOMAINLEN+64];
+	/* large enough that the union of the threads does not evict */
+	total = topk_create(worker->env.cfg->stat_top_size*num);
+	if(!total) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return 0;
+	}
+	for(i=0; i<num; i++) {
+		struct topk_set* top = top_worker(worker, i)->top;
+		if(!top)
+			continue;
+		lock_basic_lock(&top->lock);
+		topk_merge(total, top->t[kind]);
+		lock_basic_unlock(&top->lock);
+	}
+	list = (struct topk_entry**)calloc((size_t)total->num+1,
+		sizeof(*list));
+	if(!list) {
+		topk_delete(total);
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return 0;
+	}
+	cnt = topk_sorted(total, list);
+	for(i=0; i<cnt && i<n; i++) {
+		top_key_str(kind, list[i], buf, sizeof(buf));
+		if(!ssl_printf(ssl, "%s %d %s " ARG_LL "d error " ARG_LL "d\n",
+			topk_kind_name(kind), i+1, buf, list[i]->count,
+			list[i]->error)) {
+			free(list);
+			topk_delete(total);
+			return 0;
+		}
+	}
+	free(list);
+	topk_delete(total);
+	return 1;
+}
+
+/** do the top command, print the heavy hitters */
+static void
+do_top(RES* ssl, struct worker* worker, char* arg)
+{
+	int k, n = 10, kind = -1;
+	if(!worker->top) {
+		(void)ssl_printf(ssl, "error statistics-top-size is not "
+			"enabled\n");
+		return;
+	}
+	/* top [client|qname|zone|upstream|servfail] [number] */
+	if(*arg && !isdigit((unsigned char)*arg)) {
+		for(k=0; k<TOPK_NUM; k++) {
+			size_t l = strlen(topk_kind_name(k));
+			if(strncmp(arg, topk_kind_name(k), l) == 0 &&
+				(arg[l] == 0 || arg[l] == ' ' ||
+				arg[l] == '\t')) {
+				kind = k;
+				arg = skipwhite(arg+l);
+				break;
+			}
+		}
+		if(kind == -1) {
+			(void)ssl_printf(ssl, "error unknown kind, use client, "
+				"qname, zone, upstream or servfail\n");
+			return;
+		}
+	}
+	if(*arg) {
+		n = atoi(arg);
+		if(n <= 0) {
+			(void)ssl_printf(ssl, "error expected a number\n");
+			return;
+		}
+	}
+	for(k=0; k<TOPK_NUM; k++) {
+		if(kind != -1 && k != kind)
+			continue;
+		if(!top_print_kind(ssl, worker, k, n))
+			return;
+	}
+}
+
+/** do the top_clear command, clear the heavy hitter counts */
+static void
+do_top_clear(RES* ssl, struct worker* worker)
+{
+	int i, k, num = top_num_workers(worker);
+	if(!worker->top) {
+		(void)ssl_printf(ssl, "error statistics-top-size is not "
+			"enabled\n");
+		return;
+	}
+	for(i=0; i<num; i++) {
+		struct topk_set* top = top_worker(worker, i)->top;
+		if(!top)
+			continue;
+		lock_basic_lock(&top->lock);
+		for(k=0; k<TOPK_NUM; k++)
+			topk_clear(top->t[k]);
+		lock_basic_unlock(&top->lock);
+	}
+	send_ok(ssl);
+}
+
+/** delete the structures of a fast reload */
+static void
+fr_construct_delete(struct fast_reload_construct* ct)
+{
+	if(!ct)
+		return;
+	forwards_delete(ct->fwds);
+	hints_delete(ct->hints);
+	local_zones_delete(ct->local_zones);
+	respip_set_delete(ct->respip_set);
+	acl_list_delete(ct->acl);
+	views_delete(ct->views);
+	config_delete(ct->cfg);
+	lock_basic_destroy(&ct->retired.lock);
+	free(ct);
+}
+
+/** delete a list of fast reload structures */
+static void
+fr_construct_delete_list(struct fast_reload_construct* ct)
+{
+	struct fast_reload_construct* next;
+	while(ct) {
+		next = ct->next;
+		fr_construct_delete(ct);
+		ct = next;
+	}
+}
+
+void
+daemon_remote_fast_reload_cleanup(struct daemon_remote* rc)
+{
+	struct fast_reload_construct* list;
+	if(!rc)
+		return;
+	/* the queries released them when they were deleted, this is
+	 * what is left if the workers were not deleted */
+	lock_basic_lock(&rc->fast_reload_retired_lock);
+	list = rc->fast_reload_retired;
+	rc->fast_reload_retired = NULL;
+	lock_basic_unlock(&rc->fast_reload_retired_lock);
+	fr_construct_delete_list(list);
+}
+
+void
+remote_fast_reload_retired_delete(void* arg)
+{
+	struct fast_reload_construct* ct = (struct fast_reload_construct*)arg;
+	struct daemon_remote* rc = ct->rc;
+	struct fast_reload_construct** pp;
+	/* called by the thread that deleted the last query that referred
+	 * to the structures */
+	lock_basic_lock(&rc->fast_reload_retired_lock);
+	for(pp = &rc->fast_reload_retired; *pp; pp = &(*pp)->next) {
+		if(*pp == ct) {
+			*pp = ct->next;
+			break;
+		}
+	}
+	lock_basic_unlock(&rc->fast_reload_retired_lock);
+	verbose(VERB_ALGO, "fast reload: deleted the old structures, no "
+		"queries use them");
+	fr_construct_delete(ct);
+}
+
+/** set the error string of the fast reload */
+static int
+fr_error(struct fast_reload_thread* fr, const char* str)
+{
+	snprintf(fr->err, sizeof(fr->err), "%s", str);
+	return 0;
+}
+
+#ifndef THREADS_DISABLED
+/** see if the tags in the configs are the same, the tag bitmaps of the
+ * structures that are not rebuilt use the numbers of the tags. */
+static int
+fr_tags_equal(struct config_file* a, struct config_file* b)
+{
+	int i;
+	if(a->num_tags != b->num_tags)
+		return 0;
+	for(i=0; i<a->num_tags; i++) {
+		if(strcmp(a->tagname[i], b->tagname[i]) != 0)
+			return 0;
+	}
+	return 1;
+}
+
+/** read the config file and construct the structures, in the fast
+ * reload thread. */
+static int
+fr_construct(struct fast_reload_thread* fr)
+{
+	struct fast_reload_construct* ct = fr->ct;
+	int have_view_respip_cfg = 0;
+	if(!(ct->cfg = config_create()))
+		return fr_error(fr, "out of memory");
+	if(!config_read(ct->cfg, fr->cfgfile, fr->chroot))
+		return fr_error(fr, "could not read config file, see the log");
+	if(gettimeofday(&fr->time_read, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	if(!fr_tags_equal(fr->worker->daemon->cfg, ct->cfg))
+		return fr_error(fr, "define-tag changed, use reload");
+
+	if(!(ct->views = views_create()) ||
+		!views_apply_cfg(ct->views, ct->cfg))
+		return fr_error(fr, "could not set up views");
+	if(!(ct->acl = acl_list_create()) ||
+		!acl_list_apply_cfg(ct->acl, ct->cfg, ct->views))
+		return fr_error(fr, "could not set up access control list");
+	if(!(ct->local_zones = local_zones_create()) ||
+		!local_zones_apply_cfg(ct->local_zones, ct->cfg))
+		return fr_error(fr, "could not set up local zones");
+	if(!(ct->fwds = forwards_create()) ||
+		!forwards_apply_cfg(ct->fwds, ct->cfg))
+		return fr_error(fr, "could not set forward zones");
+	if(!(ct->hints = hints_create()) ||
+		!hints_apply_cfg(ct->hints, ct->cfg))
+		return fr_error(fr, "could not set root or stub hints");
+	if(!(ct->respip_set = respip_set_create()) ||
+		!respip_global_apply_cfg(ct->respip_set, ct->cfg))
+		return fr_error(fr, "could not set up response IP set");
+	if(!respip_views_apply_cfg(ct->views, ct->cfg, &have_view_respip_cfg))
+		return fr_error(fr, "could not set up per-view response IP sets");
+	ct->use_response_ip = !respip_set_is_empty(ct->respip_set) ||
+		have_view_respip_cfg;
+	/* like at the start, the module stack is not changed by the
+	 * fast reload */
+	if(ct->use_response_ip &&
+		modstack_find(&fr->worker->daemon->mods, "respip") < 0)
+		return fr_error(fr, "response-ip options require respip module");
+	return 1;
+}
+
+/** the fast reload thread, constructs the structures and then tells the
+ * remote control thread that they are ready */
+static void*
+fast_reload_thread_main(void* arg)
+{
+	struct fast_reload_thread* fr = (struct fast_reload_thread*)arg;
+	log_thread_set(&fr->thread_num);
+	ub_thread_blocksigs();
+	verbose(VERB_ALGO, "fast reload: read %s", fr->cfgfile);
+	fr->ok = fr_construct(fr);
+	if(gettimeofday(&fr->time_construct, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	worker_send_cmd(fr->worker, worker_cmd_fast_reload_done);
+	return NULL;
+}
+#endif /* THREADS_DISABLED */
+
+static void
+fast_reload_thread_stop(struct daemon_remote* rc)
+{
+	struct fast_reload_thread* fr = rc->fast_reload;
+	if(!fr)
+		return;
+	ub_thread_join(fr->tid);
+	fr_construct_delete(fr->ct);
+	free(fr);
+	rc->fast_reload = NULL;
+}
+
+/** make the queries in progress that refer to the client info, with the
+ * access control list and views of that moment, refer to the retired
+ * structures. The queries that already refer to the structures of an
+ * earlier fast reload keep those. All the worker threads are paused.
+ * @return the number of queries. */
+static size_t
+fr_client_info_retire(struct daemon* daemon, struct mesh_retired* r)
+{
+	size_t num = 0;
+	int i;
+	struct mesh_state* m;
+	for(i=0; i<daemon->num; i++) {
+		for(m = daemon->workers[i]->env.mesh->all_first; m;
+			m = m->all_next) {
+			if(m->s.client_info && !m->retired) {
+				m->retired = r;
+				num++;
+			}
+		}
+	}
+	return num;
+}
+
+/** swap a config item between the config in use and the new config */
+#define FR_CFG_SWAP(cfg, ncfg, item) do { \
+		uint8_t fr_tmp[sizeof((cfg)->item)]; \
+		memmove(fr_tmp, &(cfg)->item, sizeof(fr_tmp)); \
+		memmove(&(cfg)->item, &(ncfg)->item, sizeof(fr_tmp)); \
+		memmove(&(ncfg)->item, fr_tmp, sizeof(fr_tmp)); \
+	} while(0)
+
+/** swap the structures in use with the new ones. All the worker
+ * threads are paused. */
+static void
+fr_swap(struct daemon* daemon, struct fast_reload_construct* ct)
+{
+	struct config_file* cfg = daemon->cfg, *ncfg = ct->cfg;
+	struct views* views = daemon->views;
+	struct acl_list* acl = daemon->acl;
+	struct local_zones* local_zones = daemon->local_zones;
+	struct iter_forwards* fwds = daemon->env->fwds;
+	struct iter_hints* hints = daemon->env->hints;
+	struct respip_set* respip_set = daemon->respip_set;
+	int use_response_ip = daemon->use_response_ip;
+	struct acl_addr* node;
+	int i;
+
+	daemon->views = ct->views;
+	daemon->acl = ct->acl;
+	daemon->local_zones = ct->local_zones;
+	daemon->env->fwds = ct->fwds;
+	daemon->env->hints = ct->hints;
+	daemon->respip_set = ct->respip_set;
+	daemon->use_response_ip = ct->use_response_ip;
+	ct->views = views;
+	ct->acl = acl;
+	ct->local_zones = local_zones;
+	ct->fwds = fwds;
+	ct->hints = hints;
+	ct->respip_set = respip_set;
+	ct->use_response_ip = use_response_ip;
+	for(i=0; i<daemon->num; i++) {
+		daemon->workers[i]->env.fwds = daemon->env->fwds;
+		daemon->workers[i]->env.hints = daemon->env->hints;
+		daemon->workers[i]->env.mesh->use_response_ip =
+			daemon->use_response_ip;
+	}
+
+	/* the interface access control is not rebuilt, it is attached
+	 * to the listening ports, point it to the new views */
+	RBTREE_FOR(node, struct acl_addr*, &daemon->acl_interface->tree) {
+		struct view* v;
+		if(!node->view)
+			continue;
+		v = views_find_view(daemon->views, node->view->name, 0);
+		if(v)
+			lock_rw_unlock(&v->lock);
+		node->view = v;
+	}
+
+	/* the config lists that the structures are built from, so that
+	 * they are deleted together with the structures */
+	FR_CFG_SWAP(cfg, ncfg, local_zones);
+	FR_CFG_SWAP(cfg, ncfg, local_zones_nodefault);
+#ifdef USE_IPSET
+	FR_CFG_SWAP(cfg, ncfg, local_zones_ipset);
+#endif
+	FR_CFG_SWAP(cfg, ncfg, local_zones_disable_default);
+	FR_CFG_SWAP(cfg, ncfg, local_data);
+	FR_CFG_SWAP(cfg, ncfg, local_zone_overrides);
+	FR_CFG_SWAP(cfg, ncfg, local_zone_tags);
+	FR_CFG_SWAP(cfg, ncfg, unblock_lan_zones);
+	FR_CFG_SWAP(cfg, ncfg, insecure_lan_zones);
+	FR_CFG_SWAP(cfg, ncfg, views);
+	FR_CFG_SWAP(cfg, ncfg, acls);
+	FR_CFG_SWAP(cfg, ncfg, acl_view);
+	FR_CFG_SWAP(cfg, ncfg, acl_tags);
+	FR_CFG_SWAP(cfg, ncfg, acl_tag_actions);
+	FR_CFG_SWAP(cfg, ncfg, acl_tag_datas);
+	FR_CFG_SWAP(cfg, ncfg, forwards);
+	FR_CFG_SWAP(cfg, ncfg, stubs);
+	FR_CFG_SWAP(cfg, ncfg, root_hints);
+	FR_CFG_SWAP(cfg, ncfg, respip_tags);
+	FR_CFG_SWAP(cfg, ncfg, respip_actions);
+	FR_CFG_SWAP(cfg, ncfg, respip_data);
+}
+
+/** pause the other worker threads, swap the structures and resume.
+ * @return false if the threads could not be paused. */
+static int
+fr_pause_and_swap(struct daemon_remote* rc, struct fast_reload_thread* fr,
+	struct timeval* paused, struct timeval* resumed)
+{
+	struct daemon* daemon = fr->worker->daemon;
+	struct fast_reload_construct* ct = fr->ct;
+	uint8_t* msg;
+	uint32_t len;
+	size_t in_use;
+	int i;
+	/* the paused threads wait on the gate. One thread after the other
+	 * so there is one writer on the acknowledgement tube. */
+	if(gettimeofday(paused, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	lock_basic_lock(&rc->fast_reload_gate);
+	for(i=1; i<daemon->num; i++) {
+		worker_send_cmd(daemon->workers[i],
+			worker_cmd_fast_reload_pause);
+		if(!tube_read_msg(rc->fast_reload_ack, &msg, &len, 0)) {
+			lock_basic_unlock(&rc->fast_reload_gate);
+			(void)fr_error(fr, "could not pause the threads");
+			return 0;
+		}
+		free(msg);
+	}
+	/* every thread is in between events now */
+	fr_swap(daemon, ct);
+	fr->ct = NULL;
+	in_use = fr_client_info_retire(daemon, &ct->retired);
+	if(in_use) {
+		/* the queries keep pointers to the access control list,
+		 * views and response ip set of the reload before. The
+		 * last of them deletes the structures, they are in the
+		 * list before the threads resume. */
+		lock_basic_lock(&ct->retired.lock);
+		ct->retired.refs = in_use;
+		lock_basic_unlock(&ct->retired.lock);
+		lock_basic_lock(&rc->fast_reload_retired_lock);
+		ct->next = rc->fast_reload_retired;
+		rc->fast_reload_retired = ct;
+		lock_basic_unlock(&rc->fast_reload_retired_lock);
+	}
+	lock_basic_unlock(&rc->fast_reload_gate);
+	if(gettimeofday(resumed, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+
+	if(in_use) {
+		verbose(VERB_ALGO, "fast reload: keep the old structures, "
+			"%u queries use them", (unsigned)in_use);
+	} else {
+		fr_construct_delete(ct);
+	}
+	return 1;
+}
+
+/** print the time between two timestamps */
+static int
+fr_print_time(RES* ssl, const char* desc, struct timeval* start,
+	struct timeval* end)
+{
+	struct timeval d;
+	timeval_subtract(&d, end, start);
+	return ssl_printf(ssl, "%s " ARG_LL "d.%6.6d seconds\n", desc,
+		(long long)d.tv_sec, (int)d.tv_usec);
+}
+
+void
+daemon_remote_fast_reload_done(struct worker* worker)
+{
+	struct daemon_remote* rc = worker->daemon->rc;
+	struct fast_reload_thread* fr = rc->fast_reload;
+	struct timeval paused, resumed;
+	RES res;
+	if(!fr)
+		return;
+	ub_thread_join(fr->tid);
+	if(fr->ok && fr_pause_and_swap(rc, fr, &paused, &resumed)) {
+		verbose(VERB_OPS, "fast reload of %s completed", fr->cfgfile);
+	} else {
+		fr->ok = 0;
+		log_err("fast reload failed: %s", fr->err);
+	}
+
+	res.ssl = fr->client->ssl;
+	res.fd = fr->client->c->fd;
+	if(!fr->ok) {
+		(void)ssl_printf(&res, "error %s\n", fr->err);
+	} else if(!fr->verbose || (fr_print_time(&res, "read config",
+		&fr->time_start, &fr->time_read) &&
+		fr_print_time(&res, "construct", &fr->time_read,
+		&fr->time_construct) &&
+		fr_print_time(&res, "threads paused", &paused, &resumed))) {
+		send_ok(&res);
+	}
+	clean_point(rc, fr->client);
+	fr->client = NULL;
+	fr_construct_delete(fr->ct);
+	free(fr);
+	rc->fast_reload = NULL;
+}
+
+void
+daemon_remote_fast_reload_pause(struct worker* worker)
+{
+	struct daemon_remote* rc = worker->daemon->rc;
+	uint8_t c = 0;
+	if(!tube_write_msg(rc->fast_reload_ack, &c, sizeof(c), 0))
+		log_err("fast reload: could not acknowledge pause");
+	/* wait until the remote control thread swapped the structures */
+	lock_basic_lock(&rc->fast_reload_gate);
+	lock_basic_unlock(&rc->fast_reload_gate);
+}
+
+/** do the fast_reload command */
+static void
+do_fast_reload(RES* ssl, struct worker* worker, struct daemon_remote* rc,
+	char* arg)
+{
+#ifndef THREADS_DISABLED
+	struct fast_reload_thread* fr;
+	struct rc_state* s;
+	if(rc->fast_reload) {
+		(void)ssl_printf(ssl, "error a fast reload is in progress\n");
+		return;
+	}
+	if(!worker->daemon->cfgfile) {
+		(void)ssl_printf(ssl, "error no config file to read\n");
+		return;
+	}
+	/* the connection waits for the result, find it */
+	for(s = rc->busy_list; s; s = s->next) {
+		if(s->c->fd == ssl->fd)
+			break;
+	}
+	if(!s) {
+		(void)ssl_printf(ssl, "error no remote control state\n");
+		return;
+	}
+	if(!rc->fast_reload_ack && !(rc->fast_reload_ack = tube_create())) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	fr = (struct fast_reload_thread*)calloc(1, sizeof(*fr));
+	if(!fr || !(fr->ct = (struct fast_reload_construct*)calloc(1,
+		sizeof(*fr->ct)))) {
+		free(fr);
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	lock_basic_init(&fr->ct->retired.lock);
+	lock_protect(&fr->ct->retired.lock, &fr->ct->retired.refs,
+		sizeof(fr->ct->retired.refs));
+	fr->ct->retired.del = &remote_fast_reload_retired_delete;
+	fr->ct->retired.arg = fr->ct;
+	fr->ct->rc = rc;
+	fr->verbose = (strcmp(arg, "+v") == 0);
+	fr->thread_num = worker->daemon->num;
+	fr->worker = worker;
+	fr->cfgfile = worker->daemon->cfgfile;
+	fr->chroot = worker->daemon->chroot;
+	fr->client = s;
+	if(gettimeofday(&fr->time_start, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	/* the result is printed when the thread is done, the connection
+	 * is not closed when this command returns */
+	comm_point_stop_listening(s->c);
+	rc->fast_reload = fr;
+	ub_thread_create(&fr->tid, fast_reload_thread_main, fr);
+#else
+	(void)worker;
+	(void)rc;
+	(void)arg;
+	(void)ssl_printf(ssl, "error fast_reload is not supported in "
+		"multi-process operation\n");
+#endif
+}
+
 /** check for name with end-of-string, space or tab after it */
 static int
 cmdcmp(char* p, const char* cmd, size_t len)
@@ -3435,6 +4253,9 @@ execute_cmd(struct daemon_remote* rc, RES* ssl, char* cmd,
 	} else if(cmdcmp(p, "reload", 6)) {
 		do_reload(ssl, worker, 0);
 		return;
+	} else if(cmdcmp(p, "fast_reload", 11)) {
+		do_fast_reload(ssl, worker, rc, skipwhite(p+11));
+		return;
 	} else if(cmdcmp(p, "stats_noreset", 13)) {
 		do_stats(ssl, worker, 0);
 		return;
@@ -3444,6 +4265,12 @@ execute_cmd(struct daemon_remote* rc, RES* ssl, char* cmd,
 	} else if(cmdcmp(p, "status", 6)) {
 		do_status(ssl, worker);
 		return;
+	} else if(cmdcmp(p, "top_clear", 9)) {
+		do_top_clear(ssl, worker);
+		return;
+	} else if(cmdcmp(p, "top", 3)) {
+		do_top(ssl, worker, skipwhite(p+3));
+		return;
 	} else if(cmdcmp(p, "dump_cache", 10)) {
 #ifdef THREADS_DISABLED
 		if(worker->daemon->num > 1) {
@@ -3786,6 +4613,10 @@ int remote_control_callback(struct comm_point* c, void* arg, int err,
 	handle_req(rc, s, &res);
 
 	verbose(VERB_ALGO, "remote control operation completed");
+	if(rc->fast_reload && rc->fast_reload->client == s) {
+		/* the fast reload prints the result when it is done */
+		return 0;
+	}
 	clean_point(rc, s);
 	return 0;
 }
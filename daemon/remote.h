@@ -48,6 +48,7 @@
 #ifdef HAVE_OPENSSL_SSL_H
 #include <openssl/ssl.h>
 #endif
+#include "util/locks.h"
 struct config_file;
 struct listen_list;
 struct listen_port;
@@ -55,6 +56,9 @@ struct worker;
 struct comm_reply;
 struct comm_point;
 struct daemon_remote;
+struct fast_reload_thread;
+struct fast_reload_construct;
+struct tube;
 
 /** number of milliseconds timeout on incoming remote control handshake */
 #define REMOTE_CONTROL_TCP_TIMEOUT 120000
@@ -103,6 +107,19 @@ struct daemon_remote {
 	/** the SSL context for creating new SSL streams */
 	SSL_CTX* ctx;
 #endif
+	/** the fast reload that is in progress, or NULL */
+	struct fast_reload_thread* fast_reload;
+	/** the structures that a fast reload replaced, but that queries
+	 * in progress can still refer to, list. The last of those queries
+	 * removes them from the list and deletes them. */
+	struct fast_reload_construct* fast_reload_retired;
+	/** lock on the retired list, the worker threads remove from it */
+	lock_basic_type fast_reload_retired_lock;
+	/** the worker threads wait on this lock while the fast reload
+	 * swaps the structures. */
+	lock_basic_type fast_reload_gate;
+	/** the worker threads acknowledge the fast reload pause on this */
+	struct tube* fast_reload_ack;
 };
 
 /**
@@ -174,6 +191,28 @@ void daemon_remote_start_accept(struct daemon_remote* rc);
  */
 void daemon_remote_exec(struct worker* worker);
 
+/**
+ * Pause this worker thread for the fast reload. Acknowledges the pause
+ * and waits until the remote control thread has swapped the structures.
+ * @param worker: this worker (not the remote worker).
+ */
+void daemon_remote_fast_reload_pause(struct worker* worker);
+
+/**
+ * The fast reload thread has constructed the new structures, swap them
+ * in and report the result to the remote control connection.
+ * @param worker: this worker (the remote worker).
+ */
+void daemon_remote_fast_reload_done(struct worker* worker);
+
+/**
+ * Delete the structures that fast reloads have replaced, that are left.
+ * The queries that refer to them delete them when the last is deleted.
+ * Call when the workers, and the queries that refer to them, are deleted.
+ * @param rc: state.
+ */
+void daemon_remote_fast_reload_cleanup(struct daemon_remote* rc);
+
 #ifdef HAVE_SSL
 /** 
  * Print fixed line of text over ssl connection in blocking mode
@@ -96,18 +96,18 @@ void server_stats_init(struct ub_server_stats* stats, struct config_file* cfg)
 void server_stats_querymiss(struct ub_server_stats* stats, struct worker* worker)
 {
 	stats->num_queries_missed_cache++;
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if((long long)worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = (long long)worker->env.mesh->all.count;
+	stats->sum_query_list_size += worker->env.mesh->all_count;
+	if((long long)worker->env.mesh->all_count > stats->max_query_list_size)
+		stats->max_query_list_size = (long long)worker->env.mesh->all_count;
 }
 
 void server_stats_prefetch(struct ub_server_stats* stats, struct worker* worker)
 {
 	stats->num_queries_prefetch++;
 	/* changes the query list size so account that, like a querymiss */
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if((long long)worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = (long long)worker->env.mesh->all.count;
+	stats->sum_query_list_size += worker->env.mesh->all_count;
+	if((long long)worker->env.mesh->all_count > stats->max_query_list_size)
+		stats->max_query_list_size = (long long)worker->env.mesh->all_count;
 }
 
 void server_stats_log(struct ub_server_stats* stats, struct worker* worker,
@@ -202,6 +202,24 @@ get_rrset_bogus(struct worker* worker, int reset)
 	return r;
 }
 
+/** get number of hedged queries from iterator */
+static size_t
+get_queries_hedged(struct worker* worker, int reset)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "iterator");
+	struct iter_env* ie;
+	size_t r;
+	if(m == -1)
+		return 0;
+	ie = (struct iter_env*)worker->env.modinfo[m];
+	lock_basic_lock(&ie->hedge_lock);
+	r = ie->num_queries_hedged;
+	if(reset && !worker->env.cfg->stat_cumulative)
+		ie->num_queries_hedged = 0;
+	lock_basic_unlock(&ie->hedge_lock);
+	return r;
+}
+
 /** get number of ratelimited queries from iterator */
 static size_t
 get_queries_ratelimit(struct worker* worker, int reset)
@@ -253,14 +271,18 @@ get_dnscrypt_replay(struct worker* worker, int reset)
 }
 #endif /* USE_DNSCRYPT */
 
-void
-server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
+/**
+ * Compile the values that are owned by the worker. This does not alter
+ * the worker, so it can be called from another thread.
+ */
+static void
+server_stats_compile_worker(struct worker* worker, struct ub_stats_info* s)
 {
 	int i;
 	struct listen_list* lp;
 
 	s->svr = worker->stats;
-	s->mesh_num_states = (long long)worker->env.mesh->all.count;
+	s->mesh_num_states = (long long)worker->env.mesh->all_count;
 	s->mesh_num_reply_states = (long long)worker->env.mesh->num_reply_states;
 	s->mesh_jostled = (long long)worker->env.mesh->stats_jostled;
 	s->mesh_dropped = (long long)worker->env.mesh->stats_dropped;
@@ -285,13 +307,58 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	s->svr.unwanted_replies = (long long)worker->back->unwanted_replies;
 	s->svr.qtcp_outgoing = (long long)worker->back->num_tcp_outgoing;
 	s->svr.qudp_outgoing = (long long)worker->back->num_udp_outgoing;
+	s->svr.qtls_outgoing_resume = (long long)worker->back->num_tls_resume;
+	s->svr.qtls_outgoing_full = (long long)worker->back->num_tls_full;
+#ifdef USE_CACHEDB
+	s->svr.num_query_cachedb = (long long)worker->env.mesh->ans_cachedb;
+#else
+	s->svr.num_query_cachedb = 0;
+#endif
 
+	/* get tcp accept usage */
+	s->svr.tcp_accept_usage = 0;
+	for(lp = worker->front->cps; lp; lp = lp->next) {
+		if(lp->com->type == comm_tcp_accept)
+			s->svr.tcp_accept_usage += (long long)lp->com->cur_tcp_count;
+	}
+}
+
+/** add the counters that are reset by server_stats_compile_shared */
+static void
+server_stats_add_shared(struct ub_server_stats* total,
+	struct ub_server_stats* a)
+{
+	total->rrset_bogus += a->rrset_bogus;
+	total->queries_ratelimited += a->queries_ratelimited;
+	total->queries_hedged += a->queries_hedged;
+	total->num_query_dnscrypt_secret_missed_cache +=
+		a->num_query_dnscrypt_secret_missed_cache;
+	total->num_query_dnscrypt_replay += a->num_query_dnscrypt_replay;
+	total->num_query_authzone_up += a->num_query_authzone_up;
+	total->num_query_authzone_down += a->num_query_authzone_down;
+	total->num_neg_cache_noerror += a->num_neg_cache_noerror;
+	total->num_neg_cache_nxdomain += a->num_neg_cache_nxdomain;
+	total->num_query_subnet += a->num_query_subnet;
+	total->num_query_subnet_cache += a->num_query_subnet_cache;
+}
+
+/**
+ * Compile the values that are shared between threads, and protected
+ * by their own locks. Those are reset here, if reset is true.
+ */
+static void
+server_stats_compile_shared(struct worker* worker, struct ub_stats_info* s,
+	int reset)
+{
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = (long long)get_rrset_bogus(worker, reset);
 
 	/* get and reset iterator query ratelimit number */
 	s->svr.queries_ratelimited = (long long)get_queries_ratelimit(worker, reset);
 
+	/* get and reset iterator hedged query number */
+	s->svr.queries_hedged = (long long)get_queries_hedged(worker, reset);
+
 	/* get cache sizes */
 	get_slabhash_stats(worker->env.msg_cache,
 		&s->svr.msg_cache_count, &s->svr.msg_cache_max_collisions);
@@ -349,6 +416,12 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 #ifdef HAVE_NGTCP2
 	s->svr.mem_quic = (long long)doq_table_quic_size_get(
 		worker->daemon->doq_table);
+	if(worker->daemon->doq_tables) {
+		int i;
+		for(i=0; i<worker->daemon->num; i++)
+			s->svr.mem_quic += (long long)doq_table_quic_size_get(
+				worker->daemon->doq_tables[i]);
+	}
 #else
 	s->svr.mem_quic = 0;
 #endif /* HAVE_NGTCP2 */
@@ -362,39 +435,212 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	s->svr.num_query_subnet = 0;
 	s->svr.num_query_subnet_cache = 0;
 #endif
-#ifdef USE_CACHEDB
-	s->svr.num_query_cachedb = (long long)worker->env.mesh->ans_cachedb;
-#else
-	s->svr.num_query_cachedb = 0;
-#endif
-
-	/* get tcp accept usage */
-	s->svr.tcp_accept_usage = 0;
-	for(lp = worker->front->cps; lp; lp = lp->next) {
-		if(lp->com->type == comm_tcp_accept)
-			s->svr.tcp_accept_usage += (long long)lp->com->cur_tcp_count;
+	if(reset && !worker->env.cfg->stat_cumulative) {
+		/* keep the counts that were reset, for the totals */
+		server_stats_add_shared(&worker->daemon->stats_shared_cleared,
+			&s->svr);
 	}
+}
+
+void
+server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
+{
+	server_stats_compile_worker(worker, s);
+	server_stats_compile_shared(worker, s, reset);
 
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		worker_stats_clear(worker);
 	}
 }
 
-void server_stats_obtain(struct worker* worker, struct worker* who,
-	struct ub_stats_info* s, int reset)
+/** add or subtract counter */
+#define STATS_SUB(x) s->x += sign*b->x
+
+/**
+ * Add (sign 1) or subtract (sign -1) the values that count up until the
+ * worker clears its stats. Gauges, like the cache sizes, and the max values
+ * are not changed.
+ */
+static void
+server_stats_add_counters(struct ub_stats_info* s, struct ub_stats_info* b,
+	long long sign)
+{
+	int i;
+	STATS_SUB(svr.num_queries);
+	STATS_SUB(svr.num_queries_ip_ratelimited);
+	STATS_SUB(svr.num_queries_cookie_valid);
+	STATS_SUB(svr.num_queries_cookie_client);
+	STATS_SUB(svr.num_queries_cookie_invalid);
+	STATS_SUB(svr.num_queries_missed_cache);
+	STATS_SUB(svr.num_queries_prefetch);
+	STATS_SUB(svr.num_queries_timed_out);
+	STATS_SUB(svr.sum_query_list_size);
+	STATS_SUB(svr.ans_expired);
+	STATS_SUB(svr.num_query_dnscrypt_crypted);
+	STATS_SUB(svr.num_query_dnscrypt_cert);
+	STATS_SUB(svr.num_query_dnscrypt_cleartext);
+	STATS_SUB(svr.num_query_dnscrypt_crypted_malformed);
+	STATS_SUB(svr.qtype_big);
+	STATS_SUB(svr.qclass_big);
+	STATS_SUB(svr.qtcp);
+	STATS_SUB(svr.qtcp_outgoing);
+	STATS_SUB(svr.qudp_outgoing);
+	STATS_SUB(svr.qtls_outgoing_resume);
+	STATS_SUB(svr.qtls_outgoing_full);
+	STATS_SUB(svr.qtls);
+	STATS_SUB(svr.qtls_resume);
+	STATS_SUB(svr.qhttps);
+	STATS_SUB(svr.qquic);
+	STATS_SUB(svr.qipv6);
+	STATS_SUB(svr.qbit_QR);
+	STATS_SUB(svr.qbit_AA);
+	STATS_SUB(svr.qbit_TC);
+	STATS_SUB(svr.qbit_RD);
+	STATS_SUB(svr.qbit_RA);
+	STATS_SUB(svr.qbit_Z);
+	STATS_SUB(svr.qbit_AD);
+	STATS_SUB(svr.qbit_CD);
+	STATS_SUB(svr.qEDNS);
+	STATS_SUB(svr.qEDNS_DO);
+	STATS_SUB(svr.ans_rcode_nodata);
+	STATS_SUB(svr.ans_secure);
+	STATS_SUB(svr.ans_bogus);
+	STATS_SUB(svr.unwanted_replies);
+	STATS_SUB(svr.unwanted_queries);
+	STATS_SUB(svr.num_query_cachedb);
+	for(i=0; i<UB_STATS_QTYPE_NUM; i++)
+		STATS_SUB(svr.qtype[i]);
+	for(i=0; i<UB_STATS_QCLASS_NUM; i++)
+		STATS_SUB(svr.qclass[i]);
+	for(i=0; i<UB_STATS_OPCODE_NUM; i++)
+		STATS_SUB(svr.qopcode[i]);
+	for(i=0; i<UB_STATS_RCODE_NUM; i++)
+		STATS_SUB(svr.ans_rcode[i]);
+	for(i=0; i<NUM_BUCKETS_HIST; i++)
+		STATS_SUB(svr.hist[i]);
+	for(i=0; i<UB_STATS_RPZ_ACTION_NUM; i++)
+		STATS_SUB(svr.rpz_action[i]);
+	STATS_SUB(mesh_jostled);
+	STATS_SUB(mesh_dropped);
+	STATS_SUB(mesh_replies_sent);
+	STATS_SUB(mesh_replies_sum_wait_sec);
+	STATS_SUB(mesh_replies_sum_wait_usec);
+	if(s->mesh_replies_sum_wait_usec < 0) {
+		s->mesh_replies_sum_wait_usec += 1000000;
+		s->mesh_replies_sum_wait_sec--;
+	} else if(s->mesh_replies_sum_wait_usec >= 1000000) {
+		s->mesh_replies_sum_wait_usec -= 1000000;
+		s->mesh_replies_sum_wait_sec++;
+	}
+}
+#undef STATS_SUB
+
+/** compute the median from the (subtracted) histogram values */
+static double
+stats_hist_median(long long* array)
+{
+	double m;
+	struct timehist* hist = timehist_setup();
+	if(!hist)
+		return 0.;
+	timehist_import(hist, array, NUM_BUCKETS_HIST);
+	m = timehist_quartile(hist, 0.50);
+	timehist_delete(hist);
+	return m;
+}
+
+void
+server_stats_keep_cleared(struct worker* worker)
+{
+	struct ub_stats_info s;
+	server_stats_compile_worker(worker, &s);
+	server_stats_add_counters(&worker->stats_cleared, &s, 1);
+}
+
+#ifdef STATS_LOCKFREE
+/**
+ * Copy the values that another worker owns. The worker is not interrupted,
+ * and it does not have to wait for it.
+ * @param who: the worker to read, this runs in another thread.
+ * @param s: stats block to fill in.
+ * @param cleared: if not NULL, the counters the worker cleared are copied.
+ * @return the number of clears of the worker at the time of the copy.
+ */
+static unsigned int
+server_stats_copy(struct worker* who, struct ub_stats_info* s,
+	struct ub_stats_info* cleared)
+{
+	unsigned int seq, clears = 0;
+	/* copy the counters, retry if the worker cleared them or updated
+	 * the histogram during the copy, that itself is short */
+	for(;;) {
+		seq = ub_seq_read_begin(&who->stats_seq);
+		if(!(seq&1)) {
+			clears = who->stats_clears;
+			server_stats_compile_worker(who, s);
+			if(cleared)
+				*cleared = who->stats_cleared;
+		}
+		if(!ub_seq_read_retry(&who->stats_seq, seq))
+			break;
+		/* the worker is in its short update, wait for it */
+		ub_cpu_relax();
+	}
+	return clears;
+}
+
+/**
+ * Read the stats of another worker, without sending it a command.
+ * @param who: the worker to read, this runs in another thread.
+ * @param s: stats block to fill in.
+ * @param reset: if the stats are to be reset, done with the baseline.
+ */
+static void
+server_stats_read(struct worker* who, struct ub_stats_info* s, int reset)
+{
+	unsigned int clears;
+	int reset_base = (reset && !who->env.cfg->stat_cumulative);
+	struct ub_stats_info raw;
+	clears = server_stats_copy(who, s, NULL);
+	if(reset_base)
+		raw = *s;
+	if(who->stats_base_clears == clears) {
+		/* no clear by the worker since the baseline was taken */
+		server_stats_add_counters(s, &who->stats_base, -1);
+		s->mesh_time_median = stats_hist_median(s->svr.hist);
+	}
+	if(reset_base) {
+		who->stats_base = raw;
+		who->stats_base_clears = clears;
+		who->stats_reset_max = 1;
+	}
+	server_stats_compile_shared(who, s, reset);
+}
+
+void server_stats_reset_max(struct worker* worker)
+{
+	worker->stats_reset_max = 0;
+	worker->stats.max_query_time_us = 0;
+	worker->stats.max_query_list_size = 0;
+}
+#else /* STATS_LOCKFREE */
+
+/**
+ * Obtain the stats of another worker, that is a process, over its tube.
+ * @param worker: the executing worker.
+ * @param who: the worker to send the command to.
+ * @param s: stats block to fill in.
+ * @param cmd: the stats command to send.
+ */
+static void
+server_stats_tube_obtain(struct worker* worker, struct worker* who,
+	struct ub_stats_info* s, enum worker_commands cmd)
 {
 	uint8_t *reply = NULL;
 	uint32_t len = 0;
-	if(worker == who) {
-		/* just fill it in */
-		server_stats_compile(worker, s, reset);
-		return;
-	}
 	/* communicate over tube */
 	verbose(VERB_ALGO, "write stats cmd");
-	if(reset)
-		worker_send_cmd(who, worker_cmd_stats);
-	else 	worker_send_cmd(who, worker_cmd_stats_noreset);
+	worker_send_cmd(who, cmd);
 	verbose(VERB_ALGO, "wait for stats reply");
 	if(tube_wait_timeout(worker->cmd, STATS_THREAD_WAIT) == 0) {
 #if defined(HAVE_PTHREAD) && defined(SIZEOF_PTHREAD_T) && defined(SIZEOF_UNSIGNED_LONG)
@@ -433,6 +679,183 @@ void server_stats_obtain(struct worker* worker, struct worker* who,
 	memcpy(s, reply, (size_t)len);
 	free(reply);
 }
+#endif /* STATS_LOCKFREE */
+
+void server_stats_obtain(struct worker* worker, struct worker* who,
+	struct ub_stats_info* s, int reset)
+{
+	if(worker == who) {
+		/* just fill it in */
+		server_stats_compile(worker, s, reset);
+		return;
+	}
+#ifdef STATS_LOCKFREE
+	server_stats_read(who, s, reset);
+#else
+	server_stats_tube_obtain(worker, who, s, (reset?worker_cmd_stats:
+		worker_cmd_stats_noreset));
+#endif
+}
+
+void server_stats_obtain_totals(struct worker* worker, struct worker* who,
+	struct ub_stats_info* s)
+{
+	struct ub_stats_info cleared;
+	if(worker == who) {
+		server_stats_compile_worker(worker, s);
+		cleared = worker->stats_cleared;
+	} else {
+#ifdef STATS_LOCKFREE
+		(void)server_stats_copy(who, s, &cleared);
+#else
+		server_stats_tube_obtain(worker, who, s,
+			worker_cmd_stats_totals);
+		return;
+#endif
+	}
+	server_stats_add_counters(s, &cleared, 1);
+	s->mesh_time_median = stats_hist_median(s->svr.hist);
+	server_stats_compile_shared(who, s, 0);
+	server_stats_add_shared(&s->svr, &who->daemon->stats_shared_cleared);
+}
+
+/** create empty merged latency histograms */
+static struct server_latency*
+server_latency_create(void)
+{
+	struct server_latency* lat = (struct server_latency*)calloc(1,
+		sizeof(*lat));
+	if(!lat)
+		return NULL;
+	lat->upstream = (struct upstream_latency*)calloc(
+		UPSTREAM_LATENCY_NUM+1, sizeof(struct upstream_latency));
+	if(!lat->upstream) {
+		free(lat);
+		return NULL;
+	}
+	return lat;
+}
+
+void server_latency_delete(struct server_latency* lat)
+{
+	if(!lat)
+		return;
+	free(lat->upstream);
+	free(lat);
+}
+
+/** find the merged entry for an upstream address, or the other entry */
+static struct upstream_latency*
+server_latency_upstream(struct server_latency* lat,
+	struct sockaddr_storage* addr, socklen_t addrlen, int add)
+{
+	int i;
+	for(i=0; i<lat->num_upstream; i++) {
+		if(sockaddr_cmp(addr, addrlen, &lat->upstream[i].addr,
+			lat->upstream[i].addrlen) == 0)
+			return &lat->upstream[i];
+	}
+	if(!add || lat->num_upstream >= UPSTREAM_LATENCY_NUM)
+		return NULL;
+	i = lat->num_upstream++;
+	memcpy(&lat->upstream[i].addr, addr, addrlen);
+	lat->upstream[i].addrlen = addrlen;
+	lat->upstream[i].used = 1;
+	return &lat->upstream[i];
+}
+
+/** add the latency histograms of a worker to the merged total */
+static void
+server_latency_add_worker(struct server_latency* lat, struct worker* who)
+{
+	struct upstream_latency* up, *to;
+	int i;
+	if(who->env.mesh && who->env.mesh->latency)
+		latency_client_add(&lat->client, who->env.mesh->latency);
+	if(!who->back || !who->back->latency)
+		return;
+	up = who->back->latency;
+	for(i=0; i<UPSTREAM_LATENCY_NUM; i++) {
+		if(!up[i].used)
+			continue;
+#ifdef HAVE_UB_MEMORY_BARRIER
+		/* the address was written before the used flag */
+		ub_read_barrier();
+#endif
+		to = server_latency_upstream(lat, &up[i].addr, up[i].addrlen,
+			1);
+		if(!to)
+			to = &lat->upstream[UPSTREAM_LATENCY_NUM];
+		lathist_add(&to->hist, &up[i].hist);
+	}
+	lathist_add(&lat->upstream[UPSTREAM_LATENCY_NUM].hist,
+		&up[UPSTREAM_LATENCY_NUM].hist);
+}
+
+/** subtract the baseline from the merged latency histograms */
+static void
+server_latency_subtract(struct server_latency* lat,
+	struct server_latency* base)
+{
+	struct upstream_latency* to;
+	int i;
+	latency_client_subtract(&lat->client, &base->client);
+	for(i=0; i<base->num_upstream; i++) {
+		to = server_latency_upstream(lat, &base->upstream[i].addr,
+			base->upstream[i].addrlen, 0);
+		if(to)
+			lathist_subtract(&to->hist, &base->upstream[i].hist);
+	}
+	lathist_subtract(&lat->upstream[UPSTREAM_LATENCY_NUM].hist,
+		&base->upstream[UPSTREAM_LATENCY_NUM].hist);
+}
+
+struct server_latency*
+server_stats_latency_totals(struct worker* worker)
+{
+	struct server_latency* lat = server_latency_create();
+	if(!lat)
+		return NULL;
+#ifdef STATS_LOCKFREE
+	{
+		int i;
+		for(i=0; i<worker->daemon->num; i++)
+			server_latency_add_worker(lat,
+				worker->daemon->workers[i]);
+	}
+#else
+	server_latency_add_worker(lat, worker);
+#endif
+	return lat;
+}
+
+struct server_latency*
+server_stats_latency(struct worker* worker, int reset)
+{
+	struct daemon* daemon = worker->daemon;
+	struct server_latency* lat = server_stats_latency_totals(worker);
+	struct server_latency* raw = NULL;
+	if(!lat)
+		return NULL;
+	if(reset && !worker->env.cfg->stat_cumulative) {
+		/* keep the counts as the new baseline */
+		raw = server_latency_create();
+		if(raw) {
+			raw->client = lat->client;
+			raw->num_upstream = lat->num_upstream;
+			memcpy(raw->upstream, lat->upstream,
+				sizeof(struct upstream_latency)*
+				(UPSTREAM_LATENCY_NUM+1));
+		}
+	}
+	if(daemon->latency_base)
+		server_latency_subtract(lat, daemon->latency_base);
+	if(raw) {
+		server_latency_delete(daemon->latency_base);
+		daemon->latency_base = raw;
+	}
+	return lat;
+}
 
 void server_stats_reply(struct worker* worker, int reset)
 {
@@ -444,6 +867,16 @@ void server_stats_reply(struct worker* worker, int reset)
 		fatal_exit("could not write stat values over cmd channel");
 }
 
+void server_stats_reply_totals(struct worker* worker)
+{
+	struct ub_stats_info s;
+	server_stats_obtain_totals(worker, worker, &s);
+	verbose(VERB_ALGO, "write stats totals replymsg");
+	if(!tube_write_msg(worker->daemon->workers[0]->cmd,
+		(uint8_t*)&s, sizeof(s), 0))
+		fatal_exit("could not write stat values over cmd channel");
+}
+
 void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 {
 	total->svr.num_queries += a->svr.num_queries;
@@ -477,6 +910,8 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.qtcp += a->svr.qtcp;
 		total->svr.qtcp_outgoing += a->svr.qtcp_outgoing;
 		total->svr.qudp_outgoing += a->svr.qudp_outgoing;
+		total->svr.qtls_outgoing_resume += a->svr.qtls_outgoing_resume;
+		total->svr.qtls_outgoing_full += a->svr.qtls_outgoing_full;
 		total->svr.qtls += a->svr.qtls;
 		total->svr.qtls_resume += a->svr.qtls_resume;
 		total->svr.qhttps += a->svr.qhttps;
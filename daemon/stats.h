@@ -43,16 +43,37 @@
 #ifndef DAEMON_STATS_H
 #define DAEMON_STATS_H
 #include "util/timehist.h"
+#include "util/locks.h"
 struct worker;
 struct config_file;
 struct comm_point;
 struct comm_reply;
 struct edns_data;
 struct sldns_buffer;
+struct upstream_latency;
 
 /* stats struct */
 #include "libunbound/unbound.h"
 
+#if !defined(THREADS_DISABLED) && defined(HAVE_UB_MEMORY_BARRIER)
+/**
+ * The statistics of other threads are read directly from their memory.
+ * The counters only go up, until the worker clears them. The clear and
+ * the update of the reply time histogram are guarded by a sequence
+ * counter, so the reader copies those whole, without sending a command
+ * over the worker's tube. The worker only pays for a release store of
+ * the sequence, the reader does the retries. The other counters are
+ * outside of the sequence, they are read while the worker increments
+ * them. Together they are not a snapshot of one moment. A 64 bit
+ * counter, long long, can be read torn on a 32 bit platform, with one
+ * half before and one half after the carry of an increment; on 64 bit
+ * platforms each value is whole and it does not go down between reads.
+ * Resets by the reader are done by keeping a baseline. If the threads
+ * are processes (no shared memory), the tube command is used.
+ */
+#define STATS_LOCKFREE 1
+#endif
+
 /** 
  * Initialize server stats to 0.
  * @param stats: what to init (this is alloced by the caller).
@@ -71,7 +92,9 @@ void server_stats_log(struct ub_server_stats* stats, struct worker* worker,
 	int threadnum);
 
 /**
- * Obtain the stats info for a given thread. Uses pipe to communicate.
+ * Obtain the stats info for a given thread. With STATS_LOCKFREE the
+ * values are read from the thread, and that thread is not interrupted.
+ * Otherwise, uses pipe to communicate.
  * @param worker: the worker that is executing (the first worker).
  * @param who: on who to get the statistics info.
  * @param s: the stats block to fill in.
@@ -80,6 +103,25 @@ void server_stats_log(struct ub_server_stats* stats, struct worker* worker,
 void server_stats_obtain(struct worker* worker, struct worker* who,
 	struct ub_stats_info* s, int reset);
 
+/**
+ * Obtain the stats info for a given thread, with the counters as totals
+ * since the start of the server. Those are not reset by unbound-control
+ * stats, flush_stats or the statistics-interval, so they only go up.
+ * The gauges, like the cache sizes, are the current values.
+ * @param worker: the worker that is executing (the first worker).
+ * @param who: on who to get the statistics info.
+ * @param s: the stats block to fill in.
+ */
+void server_stats_obtain_totals(struct worker* worker, struct worker* who,
+	struct ub_stats_info* s);
+
+/**
+ * Add the counters of the worker to its totals of cleared counters,
+ * called by the worker before it clears its statistics.
+ * @param worker: the worker.
+ */
+void server_stats_keep_cleared(struct worker* worker);
+
 /**
  * Compile stats into structure for this thread worker.
  * Also clears the statistics counters (if that is set by config file).
@@ -91,6 +133,55 @@ void server_stats_obtain(struct worker* worker, struct worker* who,
 void server_stats_compile(struct worker* worker, struct ub_stats_info* s, 
 	int reset);
 
+/**
+ * Zero the max values in the stats of the worker, because the stats
+ * reader has reset the statistics. Called by the worker itself.
+ * @param worker: the worker.
+ */
+#ifdef STATS_LOCKFREE
+void server_stats_reset_max(struct worker* worker);
+#endif
+
+/**
+ * The latency histograms of all the threads, merged.
+ */
+struct server_latency {
+	/** the response times to clients */
+	struct latency_client client;
+	/** number of upstream addresses in the upstream array */
+	int num_upstream;
+	/** the upstream round trip times, num_upstream entries, and after
+	 * that one entry (with used=0) for the addresses that did not fit */
+	struct upstream_latency* upstream;
+};
+
+/**
+ * Obtain the latency histograms, as counts since the start, they are not
+ * changed by the statistics resets. For the metrics.
+ * @param worker: the worker that is executing (the first worker).
+ * @return malloced merged histograms, or NULL on failure.
+ */
+struct server_latency* server_stats_latency_totals(struct worker* worker);
+
+/**
+ * Obtain the latency histograms, for statistics-latency. The histograms
+ * of the threads are read without interrupting them, and merged. If the
+ * threads are processes, only the histograms of the executing worker
+ * are available.
+ * @param worker: the worker that is executing (the first worker).
+ * @param reset: if true, depending on config stats are reset, this
+ *	keeps a baseline of the counts.
+ * @return malloced merged histograms, or NULL on failure.
+ */
+struct server_latency* server_stats_latency(struct worker* worker,
+	int reset);
+
+/**
+ * Delete merged latency histograms.
+ * @param lat: to delete, can be NULL.
+ */
+void server_latency_delete(struct server_latency* lat);
+
 /**
  * Send stats over comm tube in reply to query cmd
  * @param worker: this worker.
@@ -99,6 +190,12 @@ void server_stats_compile(struct worker* worker, struct ub_stats_info* s,
  */
 void server_stats_reply(struct worker* worker, int reset);
 
+/**
+ * Send the stats totals over comm tube in reply to query cmd.
+ * @param worker: this worker.
+ */
+void server_stats_reply_totals(struct worker* worker);
+
 /**
  * Addup stat blocks.
  * @param total: sum of the two entries.
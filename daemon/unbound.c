@@ -48,6 +48,7 @@
 #include "util/log.h"
 #include "daemon/daemon.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "util/config_file.h"
 #include "util/storage/slabhash.h"
 #include "services/listen_dnsport.h"
@@ -198,6 +199,7 @@ checkrlimits(struct config_file* cfg)
 	size_t avail;
 	struct rlimit rlim;
 	size_t memsize_expect = cfg->msg_cache_size + cfg->rrset_cache_size
+		+ cfg->deleg_cache_size
 		+ (cfg->do_tcp?cfg->stream_wait_size:0)
 		+ (cfg->ip_ratelimit?cfg->ip_ratelimit_size:0)
 		+ (cfg->ratelimit?cfg->ratelimit_size:0)
@@ -488,6 +490,9 @@ perform_setup(struct daemon* daemon, struct config_file* cfg, int debug_mode,
 	w_config_adjust_directory(cfg);
 #endif
 
+	if(!(daemon->metrics = daemon_metrics_create(cfg)))
+		fatal_exit("could not set up metrics");
+
 	/* read ssl keys while superuser and outside chroot */
 #ifdef HAVE_SSL
 	if(!(daemon->rc = daemon_remote_create(cfg)))
@@ -725,6 +730,7 @@ run_daemon(const char* cfgfile, int cmdline_verbose, int debug_mode, int need_pi
 			fatal_exit("could not open ports");
 		if(!done_setup) { 
 			perform_setup(daemon, cfg, debug_mode, &cfgfile, need_pidfile);
+			daemon->cfgfile = cfgfile;
 			done_setup = 1; 
 		} else {
 			/* reopen log after HUP to facilitate log rotation */
@@ -46,6 +46,7 @@
 #include "daemon/worker.h"
 #include "daemon/daemon.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "daemon/acl_list.h"
 #include "util/netevent.h"
 #include "util/config_file.h"
@@ -56,6 +57,7 @@
 #include "services/outside_network.h"
 #include "services/outbound_list.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/cache/infra.h"
 #include "services/cache/dns.h"
 #include "services/authzone.h"
@@ -70,6 +72,7 @@
 #include "util/tube.h"
 #include "util/edns.h"
 #include "util/timeval_func.h"
+#include "util/topk.h"
 #include "iterator/iter_fwd.h"
 #include "iterator/iter_hints.h"
 #include "iterator/iter_utils.h"
@@ -132,7 +135,8 @@ worker_mem_report(struct worker* ATTR_UNUSED(worker),
 	front = listen_get_mem(worker->front);
 	back = outnet_get_mem(worker->back);
 	msg = slabhash_get_mem(worker->env.msg_cache);
-	rrset = slabhash_get_mem(&worker->env.rrset_cache->table);
+	rrset = slabhash_get_mem(&worker->env.rrset_cache->table)
+		+ deleg_cache_get_mem(worker->env.deleg_cache);
 	infra = infra_get_mem(worker->env.infra_cache);
 	mesh = mesh_get_mem(worker->env.mesh);
 	ac = alloc_get_mem(worker->alloc);
@@ -301,6 +305,70 @@ struct check_request_result {
 	int checked;
 	int value;
 };
+/**
+ * Count the query in the heavy hitter sketches, by client address
+ * prefix, query name and zone.
+ * @param top: the sketches of the worker.
+ * @param qinfo: the query.
+ * @param repinfo: reply info with the client address.
+ */
+static void
+worker_top_count(struct topk_set* top, struct query_info* qinfo,
+	struct comm_reply* repinfo)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1], key[1+INET6_SIZE];
+	uint8_t* zone = nm;
+	size_t keylen, zonelen, nmlen = qinfo->qname_len;
+	int labs;
+	if(addr_is_ip6(&repinfo->client_addr, repinfo->client_addrlen)) {
+		key[0] = 6;
+		memmove(key+1, &((struct sockaddr_in6*)&repinfo->client_addr)
+			->sin6_addr, TOPK_CLIENT_PREFIX6/8);
+		keylen = 1+TOPK_CLIENT_PREFIX6/8;
+	} else {
+		key[0] = 4;
+		memmove(key+1, &((struct sockaddr_in*)&repinfo->client_addr)
+			->sin_addr, TOPK_CLIENT_PREFIX4/8);
+		keylen = 1+TOPK_CLIENT_PREFIX4/8;
+	}
+	if(nmlen > sizeof(nm))
+		nmlen = sizeof(nm);
+	memmove(nm, qinfo->qname, nmlen);
+	query_dname_tolower(nm);
+	/* the zone is the last two labels, the root label is counted too */
+	zonelen = nmlen;
+	labs = dname_count_labels(nm);
+	if(labs > 3)
+		dname_remove_labels(&zone, &zonelen, labs-3);
+	lock_basic_lock(&top->lock);
+	topk_insert(top->t[topk_client], key, keylen);
+	topk_insert(top->t[topk_qname], nm, nmlen);
+	topk_insert(top->t[topk_zone], zone, zonelen);
+	lock_basic_unlock(&top->lock);
+}
+
+/**
+ * Add the response time of a query that is answered directly, without
+ * recursion, to the latency histograms. The time is taken now, because
+ * the event time does not advance during the callback.
+ * @param worker: the worker.
+ * @param c: the commpoint with the reply in its buffer.
+ * @param qtype: the query type.
+ */
+static void
+worker_latency_direct(struct worker* worker, struct comm_point* c,
+	uint16_t qtype)
+{
+	struct timeval now, duration;
+	if(gettimeofday(&now, NULL) < 0)
+		return;
+	timeval_subtract(&duration, &now, (timeval_isset(&c->recv_tv)?
+		&c->recv_tv:worker->env.now_tv));
+	latency_client_insert(worker->env.mesh->latency, &duration, qtype,
+		(int)FLAGS_GET_RCODE(sldns_buffer_read_u16_at(c->buffer, 2)),
+		0);
+}
+
 /** check request sanity.
  * @param pkt: the wire packet to examine for sanity.
  * @param worker: parameters for checking.
@@ -402,10 +470,22 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 		verbose(VERB_ALGO, "got control cmd stats_noreset");
 		server_stats_reply(worker, 0);
 		break;
+	case worker_cmd_stats_totals:
+		verbose(VERB_ALGO, "got control cmd stats_totals");
+		server_stats_reply_totals(worker);
+		break;
 	case worker_cmd_remote:
 		verbose(VERB_ALGO, "got control cmd remote");
 		daemon_remote_exec(worker);
 		break;
+	case worker_cmd_fast_reload_pause:
+		verbose(VERB_ALGO, "got control cmd fast_reload_pause");
+		daemon_remote_fast_reload_pause(worker);
+		break;
+	case worker_cmd_fast_reload_done:
+		verbose(VERB_ALGO, "got control cmd fast_reload_done");
+		daemon_remote_fast_reload_done(worker);
+		break;
 	default:
 		log_err("bad command %d", (int)cmd);
 		break;
@@ -1392,6 +1472,10 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		verbose(VERB_ALGO, "handle request called with err=%d", error);
 		return 0;
 	}
+#ifdef STATS_LOCKFREE
+	if(worker->stats_reset_max)
+		server_stats_reset_max(worker);
+#endif
 
 	if (worker->env.cfg->sock_queue_timeout && timeval_isset(&c->recv_tv)) {
 		timeval_subtract(&wait_time, worker->env.now_tv, &c->recv_tv);
@@ -1408,7 +1492,8 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 
 #ifdef USE_DNSCRYPT
 	repinfo->max_udp_size = worker->daemon->cfg->max_udp_size;
-	if(!dnsc_handle_curved_request(worker->daemon->dnscenv, repinfo)) {
+	if(!dnsc_handle_curved_request(worker->daemon->dnscenv,
+		worker->dnsc_cache, repinfo)) {
 		worker->stats.num_query_dnscrypt_crypted_malformed++;
 		return 0;
 	}
@@ -1689,6 +1774,8 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	if(worker->stats.extended)
 		server_stats_insquery(&worker->stats, c, qinfo.qtype,
 			qinfo.qclass, &edns, repinfo);
+	if(worker->top)
+		worker_top_count(worker->top, &qinfo, repinfo);
 	if(c->type != comm_udp)
 		edns.udp_size = 65535; /* max size for TCP replies */
 	if(qinfo.qclass == LDNS_RR_CLASS_CH && answer_chaos(worker, &qinfo,
@@ -1940,6 +2027,8 @@ send_reply_rc:
 		worker->stats.ans_expired++;
 	}
 	server_stats_insrcode(&worker->stats, c->buffer);
+	if(worker->env.mesh->latency)
+		worker_latency_direct(worker, c, qinfo.qtype);
 	if(worker->stats.extended) {
 		if(is_secure_answer) worker->stats.ans_secure++;
 	}
@@ -2152,6 +2241,11 @@ worker_init(struct worker* worker, struct config_file *cfg,
 			worker_delete(worker);
 			return 0;
 		}
+		if(!daemon_metrics_open_accept(worker->daemon->metrics,
+			worker->daemon->metrics_ports, worker)) {
+			worker_delete(worker);
+			return 0;
+		}
 #ifdef UB_ON_WINDOWS
 		wsvc_setup_worker(worker);
 #endif /* UB_ON_WINDOWS */
@@ -2174,7 +2268,9 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		cfg->harden_large_queries, cfg->http_max_streams,
 		cfg->http_endpoint, cfg->http_notls_downstream,
 		worker->daemon->tcl, worker->daemon->listen_sslctx,
-		dtenv, worker->daemon->doq_table, worker->env.rnd,
+		dtenv, (worker->daemon->doq_tables?
+		worker->daemon->doq_tables[worker->thread_num]:
+		worker->daemon->doq_table), worker->env.rnd,
 		cfg->ssl_service_key, cfg->ssl_service_pem, cfg,
 		worker_handle_request, worker);
 	if(!worker->front) {
@@ -2200,6 +2296,28 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	if(cfg->stat_latency && !outnet_latency_setup(worker->back)) {
+		log_err("could not create latency histograms");
+		worker_delete(worker);
+		return 0;
+	}
+	if(cfg->stat_top_size > 0) {
+		if(!(worker->top = topk_set_create(cfg->stat_top_size))) {
+			log_err("could not create heavy hitter sketches");
+			worker_delete(worker);
+			return 0;
+		}
+		worker->back->top = worker->top;
+	}
+#ifdef USE_DNSCRYPT
+	if(worker->daemon->dnscenv) {
+		if(!(worker->dnsc_cache = dnsc_thread_cache_create())) {
+			log_err("could not create dnscrypt shared secret cache");
+			worker_delete(worker);
+			return 0;
+		}
+	}
+#endif
 	iterator_set_ip46_support(&worker->daemon->mods, worker->daemon->env,
 		worker->back);
 	/* start listening to commands */
@@ -2252,6 +2370,10 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+#ifdef STATS_LOCKFREE
+	/* the histogram updates are guarded by the stats sequence */
+	worker->env.mesh->stats_seq = &worker->stats_seq;
+#endif
 	/* Pass on daemon variables that we would need in the mesh area */
 	worker->env.mesh->use_response_ip = worker->daemon->use_response_ip;
 	worker->env.mesh->use_rpz = worker->daemon->use_rpz;
@@ -2341,6 +2463,10 @@ worker_delete(struct worker* worker)
 	sldns_buffer_free(worker->env.scratch_buffer);
 	listen_delete(worker->front);
 	outside_network_delete(worker->back);
+	topk_set_delete(worker->top);
+#ifdef USE_DNSCRYPT
+	dnsc_thread_cache_delete(worker->dnsc_cache);
+#endif
 	comm_signal_delete(worker->comsig);
 	tube_delete(worker->cmd);
 	comm_timer_delete(worker->stat_timer);
@@ -2399,31 +2525,47 @@ worker_alloc_cleanup(void* arg)
 	struct worker* worker = (struct worker*)arg;
 	slabhash_clear(&worker->env.rrset_cache->table);
 	slabhash_clear(worker->env.msg_cache);
+	deleg_cache_clear(worker->env.deleg_cache);
 }
 
 void worker_stats_clear(struct worker* worker)
 {
+#ifdef STATS_LOCKFREE
+	/* odd sequence number, lockless readers retry their copy */
+	ub_seq_write_begin(&worker->stats_seq);
+#endif
+	server_stats_keep_cleared(worker);
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
+	worker->back->num_tls_resume = 0;
+	worker->back->num_tls_full = 0;
 	worker->back->num_udp_outgoing = 0;
+#ifdef STATS_LOCKFREE
+	worker->stats_clears++;
+	ub_seq_write_end(&worker->stats_seq);
+#endif
 }
 
 void worker_start_accept(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
 	listen_start_accept(worker->front);
-	if(worker->thread_num == 0)
+	if(worker->thread_num == 0) {
 		daemon_remote_start_accept(worker->daemon->rc);
+		daemon_metrics_start_accept(worker->daemon->metrics);
+	}
 }
 
 void worker_stop_accept(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
 	listen_stop_accept(worker->front);
-	if(worker->thread_num == 0)
+	if(worker->thread_num == 0) {
 		daemon_remote_stop_accept(worker->daemon->rc);
+		daemon_metrics_stop_accept(worker->daemon->metrics);
+	}
 }
 
 /* --- fake callbacks for fptr_wlist to work --- */
@@ -62,6 +62,7 @@ struct regional;
 struct tube;
 struct daemon_remote;
 struct query_info;
+struct topk_set;
 
 /** worker commands */
 enum worker_commands {
@@ -71,8 +72,14 @@ enum worker_commands {
 	worker_cmd_stats,
 	/** obtain statistics without statsclear */
 	worker_cmd_stats_noreset,
+	/** obtain the statistics totals since start */
+	worker_cmd_stats_totals,
 	/** execute remote control command */
-	worker_cmd_remote
+	worker_cmd_remote,
+	/** pause for the fast reload to swap the structures */
+	worker_cmd_fast_reload_pause,
+	/** the fast reload thread has constructed the structures */
+	worker_cmd_fast_reload_done
 };
 
 /**
@@ -121,8 +128,33 @@ struct worker {
 	struct alloc_cache *alloc;
 	/** per thread statistics */
 	struct ub_server_stats stats;
+	/** sequence number for the statistics, odd while the worker clears
+	 * them or updates the reply time histogram. Other threads read the
+	 * stats lockless, and retry if it changed during their copy. */
+	volatile unsigned int stats_seq;
+	/** number of times the worker cleared its statistics */
+	volatile unsigned int stats_clears;
+	/** the counters that the worker cleared, added up. With the current
+	 * counters they are the totals since start. Written by the worker
+	 * while it clears, when stats_seq is odd. */
+	struct ub_stats_info stats_cleared;
+	/** set by the stats reader on reset, the worker then zeroes the
+	 * max values in the stats, the other values use the baseline. */
+	volatile int stats_reset_max;
+	/** the stats baseline, the counters at the last reset by the
+	 * reader. Written by the stats reader thread only. */
+	struct ub_stats_info stats_base;
+	/** the stats_clears value that the baseline belongs to. If the
+	 * worker cleared its stats since then, the baseline is not used. */
+	unsigned int stats_base_clears;
 	/** thread scratch regional */
 	struct regional* scratchpad;
+	/** heavy hitter sketches, NULL if statistics-top-size is 0 */
+	struct topk_set* top;
+#ifdef USE_DNSCRYPT
+	/** shared secret cache of this thread, NULL if no dnscrypt */
+	struct dnsc_thread_cache* dnsc_cache;
+#endif
 
 	/** module environment passed to modules, changed for this thread */
 	struct module_env env;
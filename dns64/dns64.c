@@ -556,6 +556,62 @@ dns64_always_synth_for_qname(struct module_qstate* qstate, int id)
 	return (node != NULL);
 }
 
+static void dns64_adjust_a(int id, struct module_qstate* super,
+	struct reply_info* rep);
+
+/**
+ * Synthesize the AAAA answer from an A answer in the message cache, so that
+ * repeated DNS64 lookups do not need an A sub-query. Only answers that need
+ * no more validation are used, others go through the sub-query.
+ *
+ * \param qstate The AAAA query.
+ * \param id     This module's instance ID.
+ *
+ * \return true if the answer has been synthesized in the return_msg.
+ */
+static int
+dns64_synth_from_cache(struct module_qstate* qstate, int id)
+{
+	struct dns64_qstate* iq = (struct dns64_qstate*)qstate->minfo[id];
+	struct query_info qinfo;
+	struct dns_msg* msg, *orig = qstate->return_msg;
+
+	if(qstate->no_cache_lookup || (qstate->query_flags & BIT_CD))
+		return 0;
+	qinfo = qstate->qinfo;
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	msg = dns_cache_lookup(qstate->env, qinfo.qname, qinfo.qname_len,
+		qinfo.qtype, qinfo.qclass, qstate->query_flags, qstate->region,
+		qstate->env->scratch, 1, NULL, 0);
+	if(!msg || FLAGS_GET_RCODE(msg->rep->flags) != LDNS_RCODE_NOERROR ||
+		!reply_find_answer_rrset(&qinfo, msg->rep))
+		return 0;
+	if(msg->rep->security == sec_status_bogus ||
+		(qstate->env->need_to_validate &&
+		msg->rep->security == sec_status_unchecked))
+		return 0;
+
+	verbose(VERB_ALGO, "dns64: synthesize from cached A record");
+	qstate->return_msg = NULL;
+	dns64_adjust_a(id, qstate, msg->rep);
+	if(!qstate->return_msg || !qstate->return_msg->rep ||
+		qstate->return_msg->rep->rrset_count != msg->rep->rrset_count) {
+		qstate->return_msg = orig;
+		return 0;
+	}
+	qstate->return_rcode = LDNS_RCODE_NOERROR;
+	if(iq)
+		iq->state = DNS64_SUBQUERY_FINISHED;
+
+	/* Store the generated response in cache. */
+	if((!iq || !iq->started_no_cache_store) &&
+		!dns_cache_store(qstate->env, &qstate->qinfo,
+		qstate->return_msg->rep, 0, qstate->prefetch_leeway, 0, NULL,
+		qstate->query_flags, qstate->qstarttime))
+		log_err("out of memory");
+	return 1;
+}
+
 /**
  * Handles the "pass" event for a query. This event is received when a new query
  * is received by this module. The query may have been generated internally by
@@ -591,6 +647,8 @@ handle_event_pass(struct module_qstate* qstate, int id)
 			&& !(qstate->query_flags & BIT_CD))))) {
 		if(synth_qname)
 			verbose(VERB_ALGO, "dns64: ignore-aaaa and synthesize anyway");
+		if(dns64_synth_from_cache(qstate, id))
+			return module_finished;
 		return generate_type_A_query(qstate, id);
 	}
 
@@ -648,6 +706,8 @@ handle_event_moddone(struct module_qstate* qstate, int id)
 		(synth_qname=dns64_always_synth_for_qname(qstate, id)))) {
 		if(synth_qname)
 			verbose(VERB_ALGO, "dns64: ignore-aaaa and synthesize anyway");
+		if(dns64_synth_from_cache(qstate, id))
+			return module_finished;
 		return generate_type_A_query(qstate, id);
 	}
 
@@ -808,18 +868,18 @@ dns64_synth_aaaa_data(const struct ub_packed_rrset_key* fk,
 }
 
 /**
- * Synthesize an AAAA RR set from an A sub-query's answer and add it to the
- * original empty response.
+ * Synthesize an AAAA RR set from an A answer and add it to the original
+ * empty response.
  *
  * \param id     This module's instance ID.
  * \param super  Original AAAA query.
- * \param qstate A query.
+ * \param rep    Answer to the A query, from the sub-query or the cache.
  */
 static void
-dns64_adjust_a(int id, struct module_qstate* super, struct module_qstate* qstate)
+dns64_adjust_a(int id, struct module_qstate* super, struct reply_info* rep)
 {
 	struct dns64_env* dns64_env = (struct dns64_env*)super->env->modinfo[id];
-	struct reply_info *rep, *cp;
+	struct reply_info *cp;
 	size_t i, s;
 	struct packed_rrset_data* fd, *dd;
 	struct ub_packed_rrset_key* fk, *dk;
@@ -827,8 +887,7 @@ dns64_adjust_a(int id, struct module_qstate* super, struct module_qstate* qstate
 	verbose(VERB_ALGO, "converting A answers to AAAA answers");
 
 	log_assert(super->region);
-	log_assert(qstate->return_msg);
-	log_assert(qstate->return_msg->rep);
+	log_assert(rep);
 
 	/* If dns64-synthall is enabled, return_msg is not initialized */
 	if(!super->return_msg) {
@@ -840,8 +899,6 @@ dns64_adjust_a(int id, struct module_qstate* super, struct module_qstate* qstate
 		super->return_msg->qinfo = super->qinfo;
 	}
 
-	rep = qstate->return_msg->rep;
-
 	/*
 	 * Build the actual reply.
 	 */
@@ -999,7 +1056,7 @@ dns64_inform_super(struct module_qstate* qstate, int id,
 
 	/* Generate a response suitable for the original query. */
 	if (qstate->qinfo.qtype == LDNS_RR_TYPE_A) {
-		dns64_adjust_a(id, super, qstate);
+		dns64_adjust_a(id, super, qstate->return_msg->rep);
 	} else {
 		log_assert(qstate->qinfo.qtype == LDNS_RR_TYPE_PTR);
 		dns64_adjust_ptr(qstate, super);
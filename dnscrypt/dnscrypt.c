@@ -42,16 +42,6 @@
     crypto_box_HALF_NONCEBYTES)
 
 
-/**
- * Shared secret cache key length.
- * secret key.
- * 1 byte: ES_VERSION[1]
- * 32 bytes: client crypto_box_PUBLICKEYBYTES
- * 32 bytes: server crypto_box_SECRETKEYBYTES
- */
-#define DNSCRYPT_SHARED_SECRET_KEY_LENGTH \
-    (1 + crypto_box_PUBLICKEYBYTES + crypto_box_SECRETKEYBYTES)
-
 
 struct shared_secret_cache_key {
     /** the hash table key */
@@ -61,6 +51,22 @@ struct shared_secret_cache_key {
 };
 
 
+/** An entry in the per thread shared secret cache. */
+struct dnsc_thread_secret {
+    /** the key, like the shared secret cache key */
+    uint8_t key[DNSCRYPT_SHARED_SECRET_KEY_LENGTH];
+    /** the shared secret */
+    uint8_t nmkey[crypto_box_BEFORENMBYTES];
+    /** if the entry is in use */
+    int used;
+};
+
+/** The per thread shared secret cache, direct mapped on the key hash. */
+struct dnsc_thread_cache {
+    /** the entries */
+    struct dnsc_thread_secret secrets[DNSC_THREAD_SECRETS];
+};
+
 struct nonce_cache_key {
     /** the nonce used by the client */
     uint8_t nonce[crypto_box_HALF_NONCEBYTES];
@@ -147,6 +153,37 @@ dnsc_shared_secrets_lookup(struct slabhash* cache,
     return slabhash_lookup(cache, hash, key, 0);
 }
 
+int
+dnsc_thread_secret_lookup(struct dnsc_thread_cache* tc,
+                          uint8_t key[DNSCRYPT_SHARED_SECRET_KEY_LENGTH],
+                          uint32_t hash,
+                          uint8_t nmkey[crypto_box_BEFORENMBYTES])
+{
+    struct dnsc_thread_secret* s;
+    if(!tc)
+        return 0;
+    s = &tc->secrets[hash & (DNSC_THREAD_SECRETS-1)];
+    if(!s->used || memcmp(s->key, key, DNSCRYPT_SHARED_SECRET_KEY_LENGTH) != 0)
+        return 0;
+    memcpy(nmkey, s->nmkey, crypto_box_BEFORENMBYTES);
+    return 1;
+}
+
+void
+dnsc_thread_secret_insert(struct dnsc_thread_cache* tc,
+                          uint8_t key[DNSCRYPT_SHARED_SECRET_KEY_LENGTH],
+                          uint32_t hash,
+                          uint8_t nmkey[crypto_box_BEFORENMBYTES])
+{
+    struct dnsc_thread_secret* s;
+    if(!tc)
+        return;
+    s = &tc->secrets[hash & (DNSC_THREAD_SECRETS-1)];
+    memcpy(s->key, key, DNSCRYPT_SHARED_SECRET_KEY_LENGTH);
+    memcpy(s->nmkey, nmkey, crypto_box_BEFORENMBYTES);
+    s->used = 1;
+}
+
 /**
  * Generate a key hash suitable to find a nonce in slabhash.
  * \param[in] nonce: a uint8_t pointer of size crypto_box_HALF_NONCEBYTES
@@ -234,6 +271,7 @@ dnsc_nonces_lookup(struct slabhash* cache,
  * client_nonce, a shared secret will be computed and stored in nmkey and the
  * buffer will be decrypted inplace.
  * \param[in] env the dnscrypt environment.
+ * \param[in] tc the shared secret cache of this thread, or NULL.
  * \param[in] cert the cert that matches this encrypted query.
  * \param[in] client_nonce where the client nonce will be stored.
  * \param[in] nmkey where the shared secret key will be written.
@@ -242,6 +280,7 @@ dnsc_nonces_lookup(struct slabhash* cache,
  */
 static int
 dnscrypt_server_uncurve(struct dnsc_env* env,
+                        struct dnsc_thread_cache* tc,
                         const dnsccert *cert,
                         uint8_t client_nonce[crypto_box_HALF_NONCEBYTES],
                         uint8_t nmkey[crypto_box_BEFORENMBYTES],
@@ -293,16 +332,16 @@ dnscrypt_server_uncurve(struct dnsc_env* env,
         nonce_hash);
     lock_basic_unlock(&env->nonces_cache_lock);
 
-    /* Find existing shared secret */
+    /* Find existing shared secret, in the cache of this thread first */
     hash = dnsc_shared_secrets_cache_key(key,
                                          cert->es_version[1],
                                          query_header->publickey,
                                          cert->keypair->crypt_secretkey);
-    entry = dnsc_shared_secrets_lookup(env->shared_secrets_cache,
-                                       key,
-                                       hash);
-
-    if(!entry) {
+    if(dnsc_thread_secret_lookup(tc, key, hash, nmkey)) {
+        entry = NULL;
+    } else if(!(entry = dnsc_shared_secrets_lookup(env->shared_secrets_cache,
+                                                   key,
+                                                   hash))) {
         lock_basic_lock(&env->shared_secrets_cache_lock);
         env->num_query_dnscrypt_secret_missed_cache++;
         lock_basic_unlock(&env->shared_secrets_cache_lock);
@@ -328,10 +367,12 @@ dnscrypt_server_uncurve(struct dnsc_env* env,
                                     key,
                                     hash,
                                     nmkey);
+        dnsc_thread_secret_insert(tc, key, hash, nmkey);
     } else {
         /* copy shared secret and unlock entry */
         memcpy(nmkey, entry->data, crypto_box_BEFORENMBYTES);
         lock_rw_unlock(&entry->lock);
+        dnsc_thread_secret_insert(tc, key, hash, nmkey);
     }
 
     memcpy(nonce, query_header->nonce, crypto_box_HALF_NONCEBYTES);
@@ -882,8 +923,25 @@ sodium_misuse_handler(void)
  * #########################################################
  */
 
+struct dnsc_thread_cache*
+dnsc_thread_cache_create(void)
+{
+    return (struct dnsc_thread_cache*)calloc(1,
+        sizeof(struct dnsc_thread_cache));
+}
+
+void
+dnsc_thread_cache_delete(struct dnsc_thread_cache* tc)
+{
+    if(!tc)
+        return;
+    sodium_memzero(tc, sizeof(*tc));
+    free(tc);
+}
+
 int
 dnsc_handle_curved_request(struct dnsc_env* dnscenv,
+                           struct dnsc_thread_cache* tc,
                            struct comm_reply* repinfo)
 {
     struct comm_point* c = repinfo->c;
@@ -897,6 +955,7 @@ dnsc_handle_curved_request(struct dnsc_env* dnscenv,
     verbose(VERB_ALGO, "handle request called on DNSCrypt socket");
     if ((repinfo->dnsc_cert = dnsc_find_cert(dnscenv, c->buffer)) != NULL) {
         if(dnscrypt_server_uncurve(dnscenv,
+                                   tc,
                                    repinfo->dnsc_cert,
                                    repinfo->client_nonce,
                                    repinfo->nmkey,
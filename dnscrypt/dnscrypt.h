@@ -36,10 +36,24 @@
 #define DNSCRYPT_REPLY_HEADER_SIZE \
     (DNSCRYPT_MAGIC_HEADER_LEN + crypto_box_HALF_NONCEBYTES * 2 + crypto_box_MACBYTES)
 
+/**
+ * Shared secret cache key length.
+ * secret key.
+ * 1 byte: ES_VERSION[1]
+ * 32 bytes: client crypto_box_PUBLICKEYBYTES
+ * 32 bytes: server crypto_box_SECRETKEYBYTES
+ */
+#define DNSCRYPT_SHARED_SECRET_KEY_LENGTH \
+    (1 + crypto_box_PUBLICKEYBYTES + crypto_box_SECRETKEYBYTES)
+
 struct sldns_buffer;
 struct config_file;
 struct comm_reply;
 struct slabhash;
+struct dnsc_thread_cache;
+
+/** Number of entries in the per thread shared secret cache, power of 2 */
+#define DNSC_THREAD_SECRETS 1024
 
 typedef struct KeyPair_ {
     uint8_t crypt_publickey[crypto_box_PUBLICKEYBYTES];
@@ -112,13 +126,59 @@ int dnsc_apply_cfg(struct dnsc_env *env, struct config_file *cfg);
  */
 void dnsc_delete(struct dnsc_env *env);
 
+/**
+ * Create the shared secret cache for a thread. It is in front of the
+ * shared_secrets_cache, and because only its thread uses it, lookups
+ * need no locks.
+ * \return the cache or NULL on alloc failure.
+ */
+struct dnsc_thread_cache* dnsc_thread_cache_create(void);
+
+/**
+ * Delete the shared secret cache of a thread.
+ * \param[in] tc the cache to delete, can be NULL.
+ */
+void dnsc_thread_cache_delete(struct dnsc_thread_cache* tc);
+
+/**
+ * Lookup a shared secret in the cache of this thread.
+ * \param[in] tc the thread cache, or NULL.
+ * \param[in] key a uint8_t pointer of size DNSCRYPT_SHARED_SECRET_KEY_LENGTH
+ * containing the key to look for.
+ * \param[in] hash the hash of the key.
+ * \param[out] nmkey where the shared secret is copied to.
+ * \return 1 if found.
+ */
+int dnsc_thread_secret_lookup(struct dnsc_thread_cache* tc,
+                              uint8_t key[DNSCRYPT_SHARED_SECRET_KEY_LENGTH],
+                              uint32_t hash,
+                              uint8_t nmkey[crypto_box_BEFORENMBYTES]);
+
+/**
+ * Store a shared secret in the cache of this thread, it replaces the
+ * entry with the same slot.
+ * \param[in] tc the thread cache, or NULL.
+ * \param[in] key a uint8_t pointer of size DNSCRYPT_SHARED_SECRET_KEY_LENGTH
+ * which contains the key of the shared secret.
+ * \param[in] hash the hash of the key.
+ * \param[in] nmkey the shared secret.
+ */
+void dnsc_thread_secret_insert(struct dnsc_thread_cache* tc,
+                               uint8_t key[DNSCRYPT_SHARED_SECRET_KEY_LENGTH],
+                               uint32_t hash,
+                               uint8_t nmkey[crypto_box_BEFORENMBYTES]);
+
 /**
  * handle a crypted dnscrypt request.
  * Determine whether or not a query is coming over the dnscrypt listener and
  * attempt to uncurve it or detect if it is a certificate query.
+ * \param[in] dnscenv the dnscrypt environment.
+ * \param[in] tc the shared secret cache of this thread, or NULL.
+ * \param[in] repinfo the request.
  * return 0 in case of failure.
  */
 int dnsc_handle_curved_request(struct dnsc_env* dnscenv,
+                               struct dnsc_thread_cache* tc,
                                struct comm_reply* repinfo);
 /**
  * handle an unencrypted dnscrypt request.
@@ -42,40 +42,68 @@
 #include "util/module.h"
 #include "addrtree.h"
 
+/**
+ * Get a node allocation, from the pool of the tree if possible.
+ * @param tree: Tree the node is for.
+ * @return the memory for the node, or NULL on failure.
+ */
+static struct addrnode *
+node_alloc(struct addrtree *tree)
+{
+	struct addrnode *node = tree->pool;
+	if (!node)
+		return (struct addrnode *)malloc(tree->node_bytes);
+	tree->pool = node->next;
+	tree->pool_count--;
+	tree->size_bytes -= tree->node_bytes;
+	return node;
+}
+
+/**
+ * Return a node allocation to the pool of the tree, or free it when
+ * the pool is full.
+ * @param tree: Tree the node is from.
+ * @param node: the node, with its elem cleaned.
+ */
+static void
+node_free(struct addrtree *tree, struct addrnode *node)
+{
+	if (tree->pool_count >= ADDRTREE_POOL_MAX) {
+		free(node);
+		return;
+	}
+	node->next = tree->pool;
+	tree->pool = node;
+	tree->pool_count++;
+	tree->size_bytes += tree->node_bytes;
+}
+
 /** 
- * Create a new edge
+ * Create a new edge. The edge and its key are stored in the allocation
+ * of the child node.
  * @param node: Child node this edge will connect to.
  * @param addr: full key to this edge.
  * @param addrlen: length of relevant part of key for this node
  * @param parent_node: Parent node for node
  * @param parent_index: Index of child node at parent node
- * @return new addredge or NULL on failure
  */
-static struct addredge * 
+static void
 edge_create(struct addrnode *node, const addrkey_t *addr, 
 	addrlen_t addrlen, struct addrnode *parent_node, int parent_index)
 {
 	size_t n;
-	struct addredge *edge = (struct addredge *)malloc( sizeof (*edge) );
-	if (!edge)
-		return NULL;
+	struct addredge *edge = (struct addredge *)(node + 1);
 	edge->node = node;
 	edge->len = addrlen;
 	edge->parent_index = parent_index;
 	edge->parent_node = parent_node;
 	/* ceil() */
 	n = (size_t)((addrlen / KEYWIDTH) + ((addrlen % KEYWIDTH != 0)?1:0));
-	edge->str = (addrkey_t *)calloc(n, sizeof (addrkey_t));
-	if (!edge->str) {
-		free(edge);
-		return NULL;
-	}
+	edge->str = (addrkey_t *)(edge + 1);
 	memcpy(edge->str, addr, n * sizeof (addrkey_t));
-	/* Only manipulate other objects after successful alloc */
 	node->parent_edge = edge;
 	log_assert(parent_node->edge[parent_index] == NULL);
 	parent_node->edge[parent_index] = edge;
-	return edge;
 }
 
 /** 
@@ -90,7 +118,7 @@ static struct addrnode *
 node_create(struct addrtree *tree, void *elem, addrlen_t scope, 
 	time_t ttl)
 {
-	struct addrnode* node = (struct addrnode *)malloc( sizeof (*node) );
+	struct addrnode* node = node_alloc(tree);
 	if (!node)
 		return NULL;
 	node->elem = elem;
@@ -114,8 +142,7 @@ node_create(struct addrtree *tree, void *elem, addrlen_t scope,
 static inline size_t 
 node_size(const struct addrtree *tree, const struct addrnode *n)
 {
-	return sizeof *n + sizeof *n->parent_edge + n->parent_edge->len + 
-		(n->elem?tree->sizefunc(n->elem):0);
+	return tree->node_bytes + (n->elem?tree->sizefunc(n->elem):0);
 }
 
 struct addrtree * 
@@ -128,12 +155,14 @@ addrtree_create(addrlen_t max_depth, void (*delfunc)(void *, void *),
 	tree = (struct addrtree *)calloc(1, sizeof(*tree));
 	if (!tree)
 		return NULL;
+	tree->node_bytes = sizeof(struct addrnode) + sizeof(struct addredge)
+		+ ((size_t)max_depth + KEYWIDTH - 1) / KEYWIDTH;
 	tree->root = node_create(tree, NULL, 0, 0);
 	if (!tree->root) {
 		free(tree);
 		return NULL;
 	}
-	tree->size_bytes = sizeof *tree + sizeof *tree->root;
+	tree->size_bytes = sizeof *tree + tree->node_bytes;
 	tree->first = NULL;
 	tree->last = NULL;
 	tree->max_depth = max_depth;
@@ -142,6 +171,7 @@ addrtree_create(addrlen_t max_depth, void (*delfunc)(void *, void *),
 	tree->env = env;
 	tree->node_count = 0;
 	tree->max_node_count = max_node_count;
+	lock_quick_init(&tree->lru_lock);
 	return tree;
 }
 
@@ -230,10 +260,8 @@ purge_node(struct addrtree *tree, struct addrnode *node)
 	}
 	parent_edge->parent_node->edge[index] = child_edge;
 	tree->size_bytes -= node_size(tree, node);
-	free(parent_edge->str);
-	free(parent_edge);
 	lru_pop(tree, node);
-	free(node);
+	node_free(tree, node);
 }
 
 /**
@@ -280,16 +308,20 @@ void addrtree_delete(struct addrtree *tree)
 	if (!tree) return;
 	clean_node(tree, tree->root);
 	free(tree->root);
-	tree->size_bytes -= sizeof(struct addrnode);
+	tree->size_bytes -= tree->node_bytes;
 	while ((n = tree->first)) {
 		tree->first = n->next;
 		clean_node(tree, n);
 		tree->size_bytes -= node_size(tree, n);
-		free(n->parent_edge->str);
-		free(n->parent_edge);
+		free(n);
+	}
+	while ((n = tree->pool)) {
+		tree->pool = n->next;
+		tree->size_bytes -= tree->node_bytes;
 		free(n);
 	}
 	log_assert(sizeof *tree == addrtree_size(tree));
+	lock_quick_destroy(&tree->lru_lock);
 	free(tree);
 }
 
@@ -402,14 +434,11 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 		/* Case 2: New leafnode */
 		if (!edge) {
 			newnode = node_create(tree, elem, scope, ttl);
-			if (!newnode) return;
-			if (!edge_create(newnode, addr, sourcemask, node,
-				index)) {
-				clean_node(tree, newnode);
-				tree->node_count--;
-				free(newnode);
+			if (!newnode) {
+				tree->delfunc(tree->env, elem);
 				return;
 			}
+			edge_create(newnode, addr, sourcemask, node, index);
 			tree->size_bytes += node_size(tree, newnode);
 			lru_push(tree, newnode);
 			lru_cleanup(tree);
@@ -428,16 +457,12 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 			continue;
 		}
 		/* Case 4: split. */
-		if (!(newnode = node_create(tree, NULL, 0, 0)))
-			return;
-		node->edge[index] = NULL;
-		if (!edge_create(newnode, addr, common, node, index)) {
-			node->edge[index] = edge;
-			clean_node(tree, newnode);
-			tree->node_count--;
-			free(newnode);
+		if (!(newnode = node_create(tree, NULL, 0, 0))) {
+			tree->delfunc(tree->env, elem);
 			return;
 		}
+		node->edge[index] = NULL;
+		edge_create(newnode, addr, common, node, index);
 		lru_push(tree, newnode);
 		/* connect existing child to our new node */
 		index = getbit(edge->str, edge->len, common);
@@ -459,13 +484,12 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 			/* Data is stored in other leafnode */
 			node = newnode;
 			newnode = node_create(tree, elem, scope, ttl);
-			if (!edge_create(newnode, addr, sourcemask, node,
-				index^1)) {
-				clean_node(tree, newnode);
-				tree->node_count--;
-				free(newnode);
+			if (!newnode) {
+				tree->delfunc(tree->env, elem);
+				lru_cleanup(tree);
 				return;
 			}
+			edge_create(newnode, addr, sourcemask, node, index^1);
 			tree->size_bytes += node_size(tree, newnode);
 			lru_push(tree, newnode);
 		}
@@ -497,7 +521,9 @@ addrtree_find(struct addrtree *tree, const addrkey_t *addr,
 				/* Authority indicates it does not have a more
 				 * precise answer or we cannot ask a more
 				 * specific question. */
+				lock_quick_lock(&tree->lru_lock);
 				lru_update(tree, node);
+				lock_quick_unlock(&tree->lru_lock);
 				return node;
 			}
 		}
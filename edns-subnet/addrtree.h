@@ -57,10 +57,13 @@
 
 #ifndef ADDRTREE_H
 #define ADDRTREE_H
+#include "util/locks.h"
 
 typedef uint8_t addrlen_t;
 typedef uint8_t addrkey_t;
 #define KEYWIDTH 8
+/** Maximum number of free nodes a tree keeps for reuse */
+#define ADDRTREE_POOL_MAX 8
 
 struct addrtree {
 	struct addrnode *root;
@@ -86,6 +89,19 @@ struct addrtree {
 	struct addrnode* first;
 	/** last node in LRU list, last candidate to go */
 	struct addrnode *last;
+	/** Lock on the LRU list. The tree may be searched by several
+	 * threads at the same time, if they share a lock on the tree that
+	 * excludes inserts, and the LRU update of the search uses this
+	 * lock. Inserts need exclusive access to the tree. */
+	lock_quick_type lru_lock;
+	/** Size in bytes of a node allocation. The node, the edge to its
+	 * parent and the key of that edge are allocated together, with
+	 * room for a key of max_depth bits. */
+	size_t node_bytes;
+	/** Free nodes for reuse, linked with the next pointer */
+	struct addrnode *pool;
+	/** Number of nodes in the pool */
+	int pool_count;
 };
 
 struct addrnode {
@@ -110,7 +126,8 @@ struct addrnode {
 };
 
 struct addredge {
-	/** address of connected node */
+	/** address of connected node, stored after the edge in the
+	 * allocation of the child node */
 	addrkey_t *str;
 	/** length in bits of str */
 	addrlen_t len;
@@ -169,7 +186,8 @@ void addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 	time_t now, int only_match_scope_zero);
 
 /**
- * Find a node containing an element in the tree.
+ * Find a node containing an element in the tree. Can be called by
+ * several threads at the same time, if inserts are excluded.
  * 
  * @param tree: Tree to search.
  * @param addr: key for element lookup.
@@ -54,6 +54,7 @@
 #include "util/storage/slabhash.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
+#include "util/data/dname.h"
 #include "sldns/sbuffer.h"
 #include "sldns/wire2str.h"
 #include "iterator/iter_utils.h"
@@ -83,6 +84,7 @@ msg_cache_sizefunc(void *k, void *d)
 		+ q->key.qname_len + lock_get_mem(&q->entry.lock);
 	s += addrtree_size(r->tree4);
 	s += addrtree_size(r->tree6);
+	s += r->shared_size;
 	return s;
 }
 
@@ -303,11 +305,23 @@ cp_edns_bad_response(struct ecs_data *target, struct ecs_data *source)
 	target->subnet_validdata = 1;
 }
 
+/** Delete a reference to a shared answer, the answer is deleted when it
+ * has no references left. */
 static void
 delfunc(void *envptr, void *elemptr) {
-	struct reply_info *elem = (struct reply_info *)elemptr;
+	struct subnet_shared_rep *elem = (struct subnet_shared_rep *)elemptr;
 	struct subnet_env *env = (struct subnet_env *)envptr;
-	reply_info_parsedelete(elem, &env->alloc);
+	log_assert(elem->refcount > 0);
+	if(--elem->refcount > 0)
+		return;
+	if(elem->prev)
+		elem->prev->next = elem->next;
+	else	elem->owner->shared = elem->next;
+	if(elem->next)
+		elem->next->prev = elem->prev;
+	elem->owner->shared_size -= elem->size;
+	reply_info_parsedelete(elem->rep, &env->alloc);
+	free(elem);
 }
 
 static size_t
@@ -327,6 +341,99 @@ sizefunc(void *elemptr) {
 	return s;
 }
 
+/** Size of the elem of a tree node. The shared answers are counted in the
+ * shared_size of the cache entry, once, not for every node. */
+static size_t
+shared_sizefunc(void *ATTR_UNUSED(elemptr)) {
+	return 0;
+}
+
+/** Size in bytes of the trees and answers of the cache entry data */
+static size_t
+subnet_data_size(struct subnet_msg_cache_data *data)
+{
+	return addrtree_size(data->tree4) + addrtree_size(data->tree6) +
+		data->shared_size;
+}
+
+/** See if two replies have the same contents, apart from the TTLs */
+static int
+reply_info_same(struct reply_info *a, struct reply_info *b)
+{
+	size_t i;
+	if(a->flags != b->flags || a->authoritative != b->authoritative ||
+		a->qdcount != b->qdcount || a->security != b->security ||
+		a->reason_bogus != b->reason_bogus ||
+		a->an_numrrsets != b->an_numrrsets ||
+		a->ns_numrrsets != b->ns_numrrsets ||
+		a->ar_numrrsets != b->ar_numrrsets ||
+		a->rrset_count != b->rrset_count)
+		return 0;
+	if((a->reason_bogus_str == NULL) != (b->reason_bogus_str == NULL) ||
+		(a->reason_bogus_str && strcmp(a->reason_bogus_str,
+		b->reason_bogus_str) != 0))
+		return 0;
+	for(i=0; i<a->rrset_count; i++) {
+		struct packed_rrset_key *ka = &a->rrsets[i]->rk;
+		struct packed_rrset_key *kb = &b->rrsets[i]->rk;
+		if(ka->type != kb->type || ka->rrset_class != kb->rrset_class ||
+			ka->flags != kb->flags ||
+			ka->dname_len != kb->dname_len ||
+			query_dname_compare(ka->dname, kb->dname) != 0)
+			return 0;
+		if(!rrsetdata_equal((struct packed_rrset_data*)a->rrsets[i]->
+			entry.data, (struct packed_rrset_data*)b->rrsets[i]->
+			entry.data))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Get a reference to the shared answer for the reply. If the cache entry
+ * has an identical answer, for another subnet, that is used and it gets
+ * the TTLs of the new reply, since the authority has confirmed the data.
+ * Otherwise a new shared answer is added to the entry.
+ * @param data: cache entry data, locked.
+ * @param rep: the reply, with TTLs set.
+ * @param del_rep: if the reply replaces the reply of an existing shared
+ *	answer, the replaced reply is returned here, to delete after the
+ *	entry is unlocked.
+ * @return the shared answer with a reference for the caller, or NULL on
+ *	alloc failure.
+ */
+static struct subnet_shared_rep*
+shared_rep_get(struct subnet_msg_cache_data *data, struct reply_info *rep,
+	struct reply_info **del_rep)
+{
+	struct subnet_shared_rep *sh;
+	size_t size = sizeof(*sh) + sizefunc(rep);
+	for(sh = data->shared; sh; sh = sh->next) {
+		if(!reply_info_same(sh->rep, rep))
+			continue;
+		*del_rep = sh->rep;
+		sh->rep = rep;
+		data->shared_size += size;
+		data->shared_size -= sh->size;
+		sh->size = size;
+		sh->refcount++;
+		return sh;
+	}
+	sh = (struct subnet_shared_rep*)calloc(1, sizeof(*sh));
+	if(!sh)
+		return NULL;
+	sh->rep = rep;
+	sh->refcount = 1;
+	sh->size = size;
+	sh->owner = data;
+	sh->next = data->shared;
+	if(sh->next)
+		sh->next->prev = sh;
+	data->shared = sh;
+	data->shared_size += size;
+	return sh;
+}
+
 /**
  * Select tree from cache entry based on edns data.
  * If for address family not present it will create a new one.
@@ -340,13 +447,13 @@ get_tree(struct subnet_msg_cache_data *data, struct ecs_data *edns,
 		if (!data->tree4)
 			data->tree4 = addrtree_create(
 				cfg->max_client_subnet_ipv4, &delfunc,
-				&sizefunc, env, cfg->max_ecs_tree_size_ipv4);
+				&shared_sizefunc, env, cfg->max_ecs_tree_size_ipv4);
 		tree = data->tree4;
 	} else {
 		if (!data->tree6)
 			data->tree6 = addrtree_create(
 				cfg->max_client_subnet_ipv6, &delfunc,
-				&sizefunc, env, cfg->max_ecs_tree_size_ipv6);
+				&shared_sizefunc, env, cfg->max_ecs_tree_size_ipv6);
 		tree = data->tree6;
 	}
 	return tree;
@@ -357,7 +464,9 @@ update_cache(struct module_qstate *qstate, int id)
 {
 	struct msgreply_entry *mrep_entry;
 	struct addrtree *tree;
-	struct reply_info *rep;
+	struct reply_info *rep, *del_rep = NULL;
+	struct subnet_shared_rep *shared;
+	struct subnet_msg_cache_data *data;
 	struct query_info qinf;
 	struct subnet_env *sne = qstate->env->modinfo[id];
 	struct subnet_qstate *sq = (struct subnet_qstate*)qstate->minfo[id];
@@ -372,14 +481,36 @@ update_cache(struct module_qstate *qstate, int id)
 		((struct subnet_qstate*)qstate->minfo[id])->qinfo_hash_calculated?
 		((struct subnet_qstate*)qstate->minfo[id])->qinfo_hash :
 		query_info_hash(&qstate->qinfo, qstate->query_flags);
+	struct lruhash_entry* lru_entry;
+	int need_to_insert;
+
+	/* Copy the reply before the entry is locked, so that lookups for
+	 * other subnets of the name do not have to wait for it */
+	lock_quick_lock(&sne->alloc.lock);
+	rep = reply_info_copy(qstate->return_msg->rep, &sne->alloc, NULL);
+	lock_quick_unlock(&sne->alloc.lock);
+	if (!rep) {
+		log_err("subnetcache: cache insertion failed");
+		return;
+	}
+	/* store RRsets */
+	for(i=0; i<rep->rrset_count; i++) {
+		rep->ref[i].key = rep->rrsets[i];
+		rep->ref[i].id = rep->rrsets[i]->id;
+	}
+	reply_info_set_ttls(rep, *qstate->env->now);
+	reply_info_sortref(rep);
+	rep->flags |= (BIT_RA | BIT_QR); /* fix flags to be sensible for */
+	rep->flags &= ~(BIT_AA | BIT_CD);/* a reply based on the cache   */
+
 	/* Step 1, general qinfo lookup */
-	struct lruhash_entry* lru_entry = slabhash_lookup(subnet_msg_cache, h,
-		&qstate->qinfo, 1);
-	int need_to_insert = (lru_entry == NULL);
+	lru_entry = slabhash_lookup(subnet_msg_cache, h, &qstate->qinfo, 1);
+	need_to_insert = (lru_entry == NULL);
 	if (!lru_entry) {
 		void* data = calloc(1,
 			sizeof(struct subnet_msg_cache_data));
 		if(!data) {
+			reply_info_parsedelete(rep, &sne->alloc);
 			log_err("malloc failed");
 			return;
 		}
@@ -388,6 +519,7 @@ update_cache(struct module_qstate *qstate, int id)
 			qstate->qinfo.qname_len);
 		if(!qinf.qname) {
 			free(data);
+			reply_info_parsedelete(rep, &sne->alloc);
 			log_err("memdup failed");
 			return;
 		}
@@ -395,6 +527,7 @@ update_cache(struct module_qstate *qstate, int id)
 		free(qinf.qname); /* if qname 'consumed', it is set to NULL */
 		if (!mrep_entry) {
 			free(data);
+			reply_info_parsedelete(rep, &sne->alloc);
 			log_err("query_info_entrysetup failed");
 			return;
 		}
@@ -403,40 +536,27 @@ update_cache(struct module_qstate *qstate, int id)
 	}
 	/* lru_entry->lock is locked regardless of how we got here,
 	 * either from the slabhash_lookup, or above in the new allocated */
+	data = (struct subnet_msg_cache_data*)lru_entry->data;
+	diff_size = (int)subnet_data_size(data);
 	/* Step 2, find the correct tree */
-	if (!(tree = get_tree(lru_entry->data, edns, sne, qstate->env->cfg))) {
-		lock_rw_unlock(&lru_entry->lock);
+	if (!(tree = get_tree(data, edns, sne, qstate->env->cfg)) ||
+		!(shared = shared_rep_get(data, rep, &del_rep))) {
 		log_err("subnetcache: cache insertion failed");
-		return;
-	}
-	lock_quick_lock(&sne->alloc.lock);
-	rep = reply_info_copy(qstate->return_msg->rep, &sne->alloc, NULL);
-	lock_quick_unlock(&sne->alloc.lock);
-	if (!rep) {
-		lock_rw_unlock(&lru_entry->lock);
-		log_err("subnetcache: cache insertion failed");
-		return;
-	}
-
-	/* store RRsets */
-	for(i=0; i<rep->rrset_count; i++) {
-		rep->ref[i].key = rep->rrsets[i];
-		rep->ref[i].id = rep->rrsets[i]->id;
+		del_rep = rep;
+	} else {
+		if(edns->subnet_source_mask == 0 &&
+			edns->subnet_scope_mask == 0)
+			only_match_scope_zero = 1;
+		else only_match_scope_zero = 0;
+		addrtree_insert(tree, (addrkey_t*)edns->subnet_addr,
+			edns->subnet_source_mask, sq->max_scope, shared,
+			rep->ttl, *qstate->env->now, only_match_scope_zero);
 	}
-	reply_info_set_ttls(rep, *qstate->env->now);
-	reply_info_sortref(rep);
-	rep->flags |= (BIT_RA | BIT_QR); /* fix flags to be sensible for */
-	rep->flags &= ~(BIT_AA | BIT_CD);/* a reply based on the cache   */
-	if(edns->subnet_source_mask == 0 && edns->subnet_scope_mask == 0)
-		only_match_scope_zero = 1;
-	else only_match_scope_zero = 0;
-	diff_size = (int)tree->size_bytes;
-	addrtree_insert(tree, (addrkey_t*)edns->subnet_addr, 
-		edns->subnet_source_mask, sq->max_scope, rep,
-		rep->ttl, *qstate->env->now, only_match_scope_zero);
-	diff_size = (int)tree->size_bytes - diff_size;
+	diff_size = (int)subnet_data_size(data) - diff_size;
 
 	lock_rw_unlock(&lru_entry->lock);
+	if(del_rep)
+		reply_info_parsedelete(del_rep, &sne->alloc);
 	if (need_to_insert) {
 		slabhash_insert(subnet_msg_cache, h, lru_entry, lru_entry->data,
 			NULL);
@@ -458,7 +578,9 @@ lookup_and_reply(struct module_qstate *qstate, int id, struct subnet_qstate *sq,
 	struct ecs_data *ecs = &sq->ecs_client_in;
 	struct addrtree *tree;
 	struct addrnode *node;
+	struct reply_info *rep;
 	uint8_t scope;
+	int need_refetch;
 
 	memset(&sq->ecs_client_out, 0, sizeof(sq->ecs_client_out));
 
@@ -466,7 +588,9 @@ lookup_and_reply(struct module_qstate *qstate, int id, struct subnet_qstate *sq,
 		sq->qinfo_hash = h; /* Might be useful on cache miss */
 		sq->qinfo_hash_calculated = 1;
 	}
-	e = slabhash_lookup(sne->subnet_msg_cache, h, &qstate->qinfo, 1);
+	/* A read lock, lookups for the name run concurrently, the tree
+	 * has a lock for its LRU list */
+	e = slabhash_lookup(sne->subnet_msg_cache, h, &qstate->qinfo, 0);
 	if (!e) return 0; /* qinfo not in cache */
 	data = e->data;
 	tree = (ecs->subnet_addr_fam == EDNSSUBNET_ADDRFAM_IP4)?
@@ -482,10 +606,11 @@ lookup_and_reply(struct module_qstate *qstate, int id, struct subnet_qstate *sq,
 		return 0;
 	}
 
-	qstate->return_msg = tomsg(NULL, &qstate->qinfo,
-		(struct reply_info *)node->elem, qstate->region, *env->now, 0,
-		env->scratch);
+	rep = ((struct subnet_shared_rep *)node->elem)->rep;
+	qstate->return_msg = tomsg(NULL, &qstate->qinfo, rep, qstate->region,
+		*env->now, 0, env->scratch);
 	scope = (uint8_t)node->scope;
+	need_refetch = (*qstate->env->now >= rep->prefetch_ttl);
 	lock_rw_unlock(&e->lock);
 	
 	if (!qstate->return_msg) { /* Failed allocation or expired TTL */
@@ -501,7 +626,7 @@ lookup_and_reply(struct module_qstate *qstate, int id, struct subnet_qstate *sq,
 		sq->ecs_client_out.subnet_validdata = 1;
 	}
 
-	if (prefetch && *qstate->env->now >= ((struct reply_info *)node->elem)->prefetch_ttl) {
+	if (prefetch && need_refetch) {
 		qstate->need_refetch = 1;
 	}
 	return 1;
@@ -558,9 +683,7 @@ eval_response(struct module_qstate *qstate, int id, struct subnet_qstate *sq)
 		 * when a client explicitly asks for subnet specific answer. */
 		verbose(VERB_QUERY, "subnetcache: Authority indicates no support");
 		if(!sq->started_no_cache_store) {
-			lock_rw_wrlock(&sne->biglock);
 			update_cache(qstate, id);
-			lock_rw_unlock(&sne->biglock);
 		}
 		if (sq->subnet_downstream)
 			cp_edns_bad_response(c_out, c_in);
@@ -599,10 +722,10 @@ eval_response(struct module_qstate *qstate, int id, struct subnet_qstate *sq)
 		return module_restart_next;
 	}
 
-	lock_rw_wrlock(&sne->biglock);
 	if(!sq->started_no_cache_store) {
 		update_cache(qstate, id);
 	}
+	lock_rw_wrlock(&sne->biglock);
 	sne->num_msg_nocache++;
 	lock_rw_unlock(&sne->biglock);
 
@@ -868,10 +991,10 @@ subnetmod_operate(struct module_qstate *qstate, enum module_ev event,
 		}
 
 		if(!sq->started_no_cache_lookup && !qstate->blacklist) {
-			lock_rw_wrlock(&sne->biglock);
 			if(qstate->mesh_info->reply_list &&
 				lookup_and_reply(qstate, id, sq,
 				qstate->env->cfg->prefetch)) {
+				lock_rw_wrlock(&sne->biglock);
 				sne->num_msg_cache++;
 				lock_rw_unlock(&sne->biglock);
 				verbose(VERB_QUERY, "subnetcache: answered from cache");
@@ -889,7 +1012,6 @@ subnetmod_operate(struct module_qstate *qstate, enum module_ev event,
 				}
 				return;
 			}
-			lock_rw_unlock(&sne->biglock);
 		}
 		
 		sq->ecs_server_out.subnet_addr_fam =
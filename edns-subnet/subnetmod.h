@@ -61,6 +61,8 @@ struct subnet_env {
 	struct ecs_whitelist* whitelist;
 	/** allocation service */
 	struct alloc_cache alloc;
+	/** lock on the statistics counters. The cache entries have their
+	 * own locks, cache lookups and updates do not hold this lock. */
 	lock_rw_type biglock;
 	/** number of messages from cache */
 	size_t num_msg_cache;
@@ -71,6 +73,30 @@ struct subnet_env {
 struct subnet_msg_cache_data {
 	struct addrtree* tree4;
 	struct addrtree* tree6;
+	/** the answers that the tree nodes refer to, list. Nodes with an
+	 * identical answer, for different subnets, share it. */
+	struct subnet_shared_rep* shared;
+	/** size in bytes of the shared answers */
+	size_t shared_size;
+};
+
+/**
+ * An answer in the subnet cache, the elem of the addrtree nodes.
+ * Protected by the lock of the cache entry.
+ */
+struct subnet_shared_rep {
+	/** the answer */
+	struct reply_info* rep;
+	/** the number of tree nodes that refer to it */
+	size_t refcount;
+	/** size in bytes of the answer */
+	size_t size;
+	/** the cache entry data that it is part of */
+	struct subnet_msg_cache_data* owner;
+	/** previous in the list of the entry */
+	struct subnet_shared_rep* prev;
+	/** next in the list of the entry */
+	struct subnet_shared_rep* next;
 };
 
 struct subnet_qstate {
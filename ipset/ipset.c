@@ -10,6 +10,7 @@
 #include "util/regional.h"
 #include "util/net_help.h"
 #include "util/config_file.h"
+#include "util/storage/lookup3.h"
 
 #include "services/cache/dns.h"
 
@@ -32,6 +33,10 @@ typedef struct mnl_socket * filter_dev;
 #endif
 
 #define BUFF_LEN 256
+/** max number of addresses in one ioctl */
+#define IPSET_BATCH_MAX 64
+/** max length of the netlink messages in one send */
+#define IPSET_BATCH_SIZE 8192
 
 /**
  * Return an error
@@ -83,19 +88,43 @@ static void * open_filter() {
 #endif
 
 #ifdef HAVE_NET_PFVAR_H
-static int add_to_ipset(filter_dev dev, const char *setname, const void *ipaddr, int af) {
+/** The addresses of an answer, that are added to the table together */
+struct ipset_batch {
+	/** the table name for the addresses in the batch */
+	const char* setname;
+	/** the addresses */
+	struct pfr_addr addr[IPSET_BATCH_MAX];
+	/** the number of addresses in the batch */
+	int num;
+};
+
+static struct ipset_batch* ipset_batch_create(void) {
+	return (struct ipset_batch*)calloc(1, sizeof(struct ipset_batch));
+}
+
+static void ipset_batch_delete(struct ipset_batch* batch) {
+	free(batch);
+}
+
+static void ipset_batch_clear(struct ipset_batch* batch) {
+	batch->num = 0;
+}
+
+static int ipset_batch_flush(filter_dev dev, struct ipset_batch* batch) {
 	struct pfioc_table io;
-	struct pfr_addr addr;
+	const char *setname = batch->setname;
 	const char *p;
 	int i;
 
+	if (batch->num == 0)
+		return 0;
 	bzero(&io, sizeof(io));
-	bzero(&addr, sizeof(addr));
 
 	p = strrchr(setname, '/');
 	if (p) {
 		i = p - setname;
 		if (i >= PATH_MAX) {
+			batch->num = 0;
 			errno = ENAMETOOLONG;
 			return -1;
 		}
@@ -108,42 +137,155 @@ static int add_to_ipset(filter_dev dev, const char *setname, const void *ipaddr,
 		p = setname;
 
 	if (strlen(p) >= PF_TABLE_NAME_SIZE) {
+		batch->num = 0;
 		errno = ENAMETOOLONG;
 		return -1;
 	}
 	strlcpy(io.pfrio_table.pfrt_name, p, PF_TABLE_NAME_SIZE);
 
-	io.pfrio_buffer = &addr;
-	io.pfrio_size = 1;
-	io.pfrio_esize = sizeof(addr);
+	io.pfrio_buffer = batch->addr;
+	io.pfrio_size = batch->num;
+	io.pfrio_esize = sizeof(batch->addr[0]);
+	batch->num = 0;
 
-	switch (af) {
-		case AF_INET:
-			addr.pfra_ip4addr = *(struct in_addr *)ipaddr;
-			addr.pfra_net = 32;
-			break;
-		case AF_INET6:
-			addr.pfra_ip6addr = *(struct in6_addr *)ipaddr;
-			addr.pfra_net = 128;
-			break;
-		default:
-		errno = EAFNOSUPPORT;
+	if (ioctl(dev, DIOCRADDADDRS, &io) == -1) {
+		log_err("ioctl failed: %s", strerror(errno));
 		return -1;
 	}
-	addr.pfra_af = af;
+	return 0;
+}
 
-	if (ioctl(dev, DIOCRADDADDRS, &io) == -1) {
-		log_err("ioctl failed: %s", strerror(errno));
+static int add_to_ipset(filter_dev dev, struct ipset_batch *batch,
+	const char *setname, const void *ipaddr, int af) {
+	struct pfr_addr *addr;
+
+	if (af != AF_INET && af != AF_INET6) {
+		errno = EAFNOSUPPORT;
 		return -1;
 	}
+	/* one ioctl adds to one table */
+	if (batch->num == IPSET_BATCH_MAX || (batch->num > 0 &&
+		strcmp(batch->setname, setname) != 0)) {
+		if (ipset_batch_flush(dev, batch) < 0)
+			return -1;
+	}
+	batch->setname = setname;
+	addr = &batch->addr[batch->num++];
+	bzero(addr, sizeof(*addr));
+
+	if (af == AF_INET) {
+		addr->pfra_ip4addr = *(struct in_addr *)ipaddr;
+		addr->pfra_net = 32;
+	} else {
+		addr->pfra_ip6addr = *(struct in6_addr *)ipaddr;
+		addr->pfra_net = 128;
+	}
+	addr->pfra_af = af;
 	return 0;
 }
 #else
-static int add_to_ipset(filter_dev dev, const char *setname, const void *ipaddr, int af) {
+/** The netlink messages of an answer, that are sent together */
+struct ipset_batch {
+	/** the batch of messages in the buffer */
+	struct mnl_nlmsg_batch *b;
+	/** the buffer, twice the limit, because the message that does not
+	 * fit is made after the limit and moved to the start by the reset */
+	char buffer[IPSET_BATCH_SIZE*2];
+};
+
+static struct ipset_batch* ipset_batch_create(void) {
+	struct ipset_batch *batch = (struct ipset_batch*)calloc(1,
+		sizeof(struct ipset_batch));
+	if (!batch)
+		return NULL;
+	batch->b = mnl_nlmsg_batch_start(batch->buffer, IPSET_BATCH_SIZE);
+	if (!batch->b) {
+		free(batch);
+		return NULL;
+	}
+	return batch;
+}
+
+static void ipset_batch_delete(struct ipset_batch* batch) {
+	if (!batch)
+		return;
+	mnl_nlmsg_batch_stop(batch->b);
+	free(batch);
+}
+
+static void ipset_batch_clear(struct ipset_batch* batch) {
+	/* the first reset moves a message that did not fit to the start,
+	 * the second drops it */
+	mnl_nlmsg_batch_reset(batch->b);
+	mnl_nlmsg_batch_reset(batch->b);
+}
+
+/**
+ * Read the replies to the sent batch. The kernel handles the batch in the
+ * sendto, the replies are queued when it returns. Only the messages that
+ * failed have a reply, they are requested without NLM_F_ACK. The errors
+ * are logged, the receive queue is emptied so it does not fill up.
+ */
+static void ipset_batch_replies(filter_dev dev) {
+	char buf[MNL_SOCKET_BUFFER_SIZE];
+	struct nlmsghdr *nlh;
+	struct nlmsgerr *err;
+	int len, num_err = 0, first_err = 0;
+
+	for (;;) {
+		len = (int)recv(mnl_socket_get_fd(dev), buf, sizeof(buf),
+			MSG_DONTWAIT);
+		if (len < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				log_err("ipset: recv failed: %s",
+					strerror(errno));
+			break;
+		}
+		if (len == 0)
+			break;
+		for (nlh = (struct nlmsghdr*)buf; mnl_nlmsg_ok(nlh, len);
+			nlh = mnl_nlmsg_next(nlh, &len)) {
+			if (nlh->nlmsg_type != NLMSG_ERROR)
+				continue;
+			err = (struct nlmsgerr*)mnl_nlmsg_get_payload(nlh);
+			if (err->error == 0)
+				continue;
+			if (num_err++ == 0)
+				first_err = -err->error;
+		}
+	}
+	if (num_err == 0)
+		return;
+	if (first_err < IPSET_ERR_PRIVATE)
+		log_err("ipset: %d addresses could not be added: %s",
+			num_err, strerror(first_err));
+	else	log_err("ipset: %d addresses could not be added: ipset "
+			"error %d", num_err, first_err);
+}
+
+static int ipset_batch_flush(filter_dev dev, struct ipset_batch* batch) {
+	ssize_t ret;
+
+	if (mnl_nlmsg_batch_is_empty(batch->b))
+		return 0;
+	ret = mnl_socket_sendto(dev, mnl_nlmsg_batch_head(batch->b),
+		mnl_nlmsg_batch_size(batch->b));
+	/* moves a message that did not fit to the start */
+	mnl_nlmsg_batch_reset(batch->b);
+	if (ret < 0) {
+		return -1;
+	}
+	ipset_batch_replies(dev);
+	return 0;
+}
+
+static int add_to_ipset(filter_dev dev, struct ipset_batch *batch,
+	const char *setname, const void *ipaddr, int af) {
 	struct nlmsghdr *nlh;
 	struct nfgenmsg *nfg;
 	struct nlattr *nested[2];
-	static char buffer[BUFF_LEN];
 
 	if (strlen(setname) >= IPSET_MAXNAMELEN) {
 		errno = ENAMETOOLONG;
@@ -154,9 +296,11 @@ static int add_to_ipset(filter_dev dev, const char *setname, const void *ipaddr,
 		return -1;
 	}
 
-	nlh = mnl_nlmsg_put_header(buffer);
+	nlh = mnl_nlmsg_put_header(mnl_nlmsg_batch_current(batch->b));
 	nlh->nlmsg_type = IPSET_CMD_ADD | (NFNL_SUBSYS_IPSET << 8);
-	nlh->nlmsg_flags = NLM_F_REQUEST|NLM_F_ACK|NLM_F_EXCL;
+	/* no NLM_F_ACK, only failures are answered. No NLM_F_EXCL, an
+	 * address that is in the set already is not a failure. */
+	nlh->nlmsg_flags = NLM_F_REQUEST;
 
 	nfg = mnl_nlmsg_put_extra_header(nlh, sizeof(struct nfgenmsg));
 	nfg->nfgen_family = af;
@@ -172,15 +316,51 @@ static int add_to_ipset(filter_dev dev, const char *setname, const void *ipaddr,
 	mnl_attr_nest_end(nlh, nested[1]);
 	mnl_attr_nest_end(nlh, nested[0]);
 
-	if (mnl_socket_sendto(dev, nlh, nlh->nlmsg_len) < 0) {
-		return -1;
+	if (!mnl_nlmsg_batch_next(batch->b)) {
+		/* the batch is full, send the messages before this one */
+		return ipset_batch_flush(dev, batch);
 	}
 	return 0;
 }
 #endif
 
+/** the filter failed, the batch and the recently added set are dropped */
 static void
-ipset_add_rrset_data(struct ipset_env *ie,
+ipset_dev_failed(struct ipset_env *ie)
+{
+	ipset_batch_clear((struct ipset_batch*)ie->batch);
+	memset(ie->recent, 0, sizeof(ie->recent));
+#if HAVE_NET_PFVAR_H
+	/* don't close as we might not be able to open again due to dropped privs */
+#else
+	mnl_socket_close((filter_dev)ie->dev);
+	ie->dev = NULL;
+#endif
+}
+
+/**
+ * See if the address was added recently, if not, it is remembered as
+ * added now.
+ * @return true if it was recently added, and does not have to be sent.
+ */
+static int
+ipset_recent_lookup(struct ipset_env *ie, time_t now, int af,
+	const uint8_t *addr, size_t len)
+{
+	struct ipset_recent *r = &ie->recent[hashlittle(addr, len,
+		(uint32_t)af) % IPSET_RECENT_SIZE];
+	if (r->af == af && now - r->added < IPSET_RECENT_TIME &&
+		memcmp(r->addr, addr, len) == 0) {
+		return 1;
+	}
+	r->af = af;
+	r->added = now;
+	memcpy(r->addr, addr, len);
+	return 0;
+}
+
+static int
+ipset_add_rrset_data(struct ipset_env *ie, time_t now,
 	struct packed_rrset_data *d, const char* setname, int af,
 	const char* dname)
 {
@@ -199,26 +379,25 @@ ipset_add_rrset_data(struct ipset_env *ie,
 		if(af == AF_INET6 && rd_len != INET6_SIZE)
 			continue;
 		if (rr_len - 2 >= rd_len) {
+			if(ipset_recent_lookup(ie, now, af, rr_data+2, rd_len))
+				continue;
 			if(verbosity >= VERB_QUERY) {
 				char ip[128];
 				if(inet_ntop(af, rr_data+2, ip, (socklen_t)sizeof(ip)) == 0)
 					snprintf(ip, sizeof(ip), "(inet_ntop_error)");
 				verbose(VERB_QUERY, "ipset: add %s to %s for %s", ip, setname, dname);
 			}
-			ret = add_to_ipset((filter_dev)ie->dev, setname, rr_data + 2, af);
+			ret = add_to_ipset((filter_dev)ie->dev,
+				(struct ipset_batch*)ie->batch, setname,
+				rr_data + 2, af);
 			if (ret < 0) {
 				log_err("ipset: could not add %s into %s", dname, setname);
-
-#if HAVE_NET_PFVAR_H
-				/* don't close as we might not be able to open again due to dropped privs */
-#else
-				mnl_socket_close((filter_dev)ie->dev);
-				ie->dev = NULL;
-#endif
-				break;
+				ipset_dev_failed(ie);
+				return -1;
 			}
 		}
 	}
+	return 0;
 }
 
 static int
@@ -262,15 +441,16 @@ ipset_check_zones_for_rrset(struct module_env *env, struct ipset_env *ie,
 		if ((ds && strncasecmp(p->str, ds, plen) == 0)
 			|| (qs && strncasecmp(p->str, qs, plen) == 0)) {
 			d = (struct packed_rrset_data*)rrset->entry.data;
-			ipset_add_rrset_data(ie, d, setname, af, dname);
-			break;
+			return ipset_add_rrset_data(ie, *env->now, d, setname,
+				af, dname);
 		}
 	}
 	return 0;
 }
 
-static int ipset_update(struct module_env *env, struct dns_msg *return_msg,
-	struct query_info qinfo, struct ipset_env *ie)
+static int ipset_update_locked(struct module_env *env,
+	struct dns_msg *return_msg, struct query_info qinfo,
+	struct ipset_env *ie)
 {
 	size_t i;
 	const char *setname;
@@ -318,9 +498,26 @@ static int ipset_update(struct module_env *env, struct dns_msg *return_msg,
 		}
 	}
 
+	/* send the additions for this answer in one go */
+	if(ipset_batch_flush((filter_dev)ie->dev,
+		(struct ipset_batch*)ie->batch) < 0) {
+		log_err("ipset: could not add the addresses for %s", qname);
+		ipset_dev_failed(ie);
+		return -1;
+	}
 	return 0;
 }
 
+static int ipset_update(struct module_env *env, struct dns_msg *return_msg,
+	struct query_info qinfo, struct ipset_env *ie)
+{
+	int ret;
+	lock_basic_lock(&ie->lock);
+	ret = ipset_update_locked(env, return_msg, qinfo, ie);
+	lock_basic_unlock(&ie->lock);
+	return ret;
+}
+
 int ipset_startup(struct module_env* env, int id) {
 	struct ipset_env *ipset_env;
 
@@ -331,6 +528,14 @@ int ipset_startup(struct module_env* env, int id) {
 	}
 
 	env->modinfo[id] = (void *)ipset_env;
+	lock_basic_init(&ipset_env->lock);
+	lock_protect(&ipset_env->lock, ipset_env, sizeof(*ipset_env));
+
+	ipset_env->batch = ipset_batch_create();
+	if (!ipset_env->batch) {
+		log_err("malloc failure");
+		return 0;
+	}
 
 #ifdef HAVE_NET_PFVAR_H
 	ipset_env->dev = open_filter();
@@ -363,6 +568,8 @@ void ipset_destartup(struct module_env* env, int id) {
 		ipset_env->dev = NULL;
 	}
 
+	ipset_batch_delete((struct ipset_batch*)ipset_env->batch);
+	lock_basic_destroy(&ipset_env->lock);
 	free(ipset_env);
 	env->modinfo[id] = NULL;
 }
@@ -483,7 +690,7 @@ size_t ipset_get_mem(struct module_env *env, int id) {
 	if (!ie) {
 		return 0;
 	}
-	return sizeof(*ie);
+	return sizeof(*ie) + sizeof(struct ipset_batch);
 }
 
 /**
@@ -31,11 +31,30 @@
  */
 
 #include "util/module.h"
+#include "util/locks.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** number of slots in the set of recently added addresses */
+#define IPSET_RECENT_SIZE 1024
+/** seconds that an added address is remembered, and not sent again */
+#define IPSET_RECENT_TIME 10
+
+/**
+ * An address that was recently added to the set. The filter already has
+ * it, and the next answers with it do not have to send it again.
+ */
+struct ipset_recent {
+	/** the time when it was added */
+	time_t added;
+	/** the address family, 0 if the slot is empty */
+	int af;
+	/** the address, in network format */
+	uint8_t addr[16];
+};
+
 struct ipset_env {
 	void* dev;
 
@@ -44,6 +63,15 @@ struct ipset_env {
 
 	const char *name_v4;
 	const char *name_v6;
+
+	/** lock on the dev, the batch and the recent set. The env is
+	 * shared by the worker threads. */
+	lock_basic_type lock;
+	/** the additions of one answer, sent to the filter together,
+	 * struct ipset_batch */
+	void* batch;
+	/** the recently added addresses, the slot is picked by hash */
+	struct ipset_recent recent[IPSET_RECENT_SIZE];
 };
 
 struct ipset_qstate {
@@ -207,6 +207,7 @@ iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
 	iter_env->outbound_msg_retry = cfg->outbound_msg_retry;
 	iter_env->max_sent_count = cfg->max_sent_count;
 	iter_env->max_query_restarts = cfg->max_query_restarts;
+	iter_env->hedge_budget = cfg->hedge_queries?cfg->hedge_budget:0;
 	return 1;
 }
 
@@ -585,6 +586,20 @@ iter_filter_order(struct iter_env* iter_env, struct module_env* env,
 	return got_num;
 }
 
+/** get the selection rtt of the nth target in the result list */
+static int
+result_sel_rtt(struct delegpt* dp, int n)
+{
+	struct delegpt_addr* a = dp->result_list;
+	while(n > 0 && a) {
+		a = a->next_result;
+		n--;
+	}
+	if(!a)
+		return -1;
+	return a->sel_rtt;
+}
+
 struct delegpt_addr*
 iter_server_selection(struct iter_env* iter_env,
 	struct module_env* env, struct delegpt* dp,
@@ -640,6 +655,16 @@ iter_server_selection(struct iter_env* iter_env,
 	/* grab secure random number, to pick unexpected server.
 	 * also we need it to be threadsafe. */
 	sel = ub_random_max(env->rnd, num);
+	if(env->cfg->infra_latency_selection) {
+		/* power of two choices, of two random targets pick the one
+		 * with the lower median reply time. That prefers the fast
+		 * servers, and still sends queries to the others, so their
+		 * estimates keep up to date. */
+		int sel2 = ub_random_max(env->rnd, num);
+		int rtt2 = result_sel_rtt(dp, sel2);
+		if(rtt2 != -1 && rtt2 < result_sel_rtt(dp, sel))
+			sel = sel2;
+	}
 	a = dp->result_list;
 	prev = NULL;
 	while(sel > 0 && a) {
@@ -96,6 +96,9 @@ iter_init(struct module_env* env, int id)
 	lock_protect(&iter_env->queries_ratelimit_lock,
 			&iter_env->num_queries_ratelimited,
 		sizeof(iter_env->num_queries_ratelimited));
+	lock_basic_init(&iter_env->hedge_lock);
+	lock_protect(&iter_env->hedge_lock, &iter_env->num_queries_hedged,
+		sizeof(iter_env->num_queries_hedged));
 
 	if(!iter_apply_cfg(iter_env, env->cfg)) {
 		log_err("iterator: could not apply configuration settings.");
@@ -123,6 +126,7 @@ iter_deinit(struct module_env* env, int id)
 		return;
 	iter_env = (struct iter_env*)env->modinfo[id];
 	lock_basic_destroy(&iter_env->queries_ratelimit_lock);
+	lock_basic_destroy(&iter_env->hedge_lock);
 	free(iter_env->target_fetch_policy);
 	priv_delete(iter_env->priv);
 	donotq_delete(iter_env->donotq);
@@ -2418,6 +2422,227 @@ check_waiting_queries(struct iter_qstate* iq, struct module_qstate* qstate,
 		qstate->ext_state[id] = module_wait_reply;
 	}
 }
+
+/** the address to send the query to for the target, with NAT64 applied */
+static void
+target_real_addr(struct iter_env* ie, struct iter_qstate* iq,
+	struct delegpt_addr* target, struct sockaddr_storage* real_addr,
+	socklen_t* real_addrlen)
+{
+	*real_addr = target->addr;
+	*real_addrlen = target->addrlen;
+
+	if(ie->use_nat64 && target->addr.ss_family == AF_INET) {
+		addr_to_nat64(&target->addr, &ie->nat64_prefix_addr,
+			ie->nat64_prefix_addrlen, ie->nat64_prefix_net,
+			real_addr, real_addrlen);
+		log_name_addr(VERB_QUERY, "applied NAT64:",
+			iq->dp->name, real_addr, *real_addrlen);
+	}
+}
+
+/**
+ * Send the query for the iterator state to the target.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param target: the server to send to.
+ * @param real_addr: the address to send to, from target_real_addr.
+ * @param real_addrlen: length of real_addr.
+ * @param sq_check_ratelimit: if the ratelimit is checked for the query.
+ * @param sq_was_ratelimited: returns if the query was ratelimited.
+ * @return the outbound entry, or NULL if it could not be sent.
+ */
+static struct outbound_entry*
+send_query_to_target(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct delegpt_addr* target, struct sockaddr_storage* real_addr,
+	socklen_t real_addrlen, int sq_check_ratelimit,
+	int* sq_was_ratelimited)
+{
+	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
+	return (*qstate->env->send_query)(&iq->qinfo_out,
+		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0),
+		/* unset CD if to forwarder(RD set) and not dnssec retry
+		 * (blacklist nonempty) and no trust-anchors are configured
+		 * above the qname or on the first attempt when dnssec is on */
+		(qstate->env->cfg->disable_edns_do?0:EDNS_DO)|
+		((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
+		!qstate->blacklist&&(!iter_qname_indicates_dnssec(qstate->env,
+		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD),
+		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
+		ie, iq), sq_check_ratelimit, real_addr, real_addrlen,
+		iq->dp->name, iq->dp->namelen,
+		(iq->dp->tcp_upstream || qstate->env->cfg->tcp_upstream),
+		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream),
+		target->tls_auth_name, qstate, sq_was_ratelimited);
+}
+
+/**
+ * Set the hedge timer for the query that was sent to the target. Every
+ * outgoing query adds to the hedge budget. The timer is set to the 95th
+ * percentile of the response time of the server, if that is before the
+ * retransmit timeout.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param target: the server that the query was sent to.
+ * @param real_addr: the address the query was sent to.
+ * @param real_addrlen: length of real_addr.
+ * @param sq_check_ratelimit: if the ratelimit was checked for the query.
+ */
+static void
+iter_hedge_set_timer(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct delegpt_addr* target,
+	struct sockaddr_storage* real_addr, socklen_t real_addrlen,
+	int sq_check_ratelimit)
+{
+	struct rtt_info rtt;
+	struct timeval tv;
+	int delay, tA, tAAAA, tother, ms;
+	if(ie->hedge_budget == 0)
+		return;
+	/* the credit is per thread, this is the thread of the query */
+	qstate->env->hedge_credit += (size_t)ie->hedge_budget;
+	if(qstate->env->hedge_credit > HEDGE_CREDIT_COST*HEDGE_CREDIT_BURST)
+		qstate->env->hedge_credit = HEDGE_CREDIT_COST*HEDGE_CREDIT_BURST;
+
+	/* servers without timing information are not hedged */
+	if(infra_get_host_rto(qstate->env->infra_cache, real_addr,
+		real_addrlen, iq->dp->name, iq->dp->namelen, &rtt, &delay,
+		*qstate->env->now, &tA, &tAAAA, &tother) < 0)
+		return;
+	ms = rtt_p95(&rtt);
+	if(ms >= rtt_timeout(&rtt))
+		return; /* the retransmit comes first */
+	if(!iq->hedge_timer) {
+		iq->hedge_timer = comm_timer_create(qstate->env->worker_base,
+			iter_hedge_timer_cb, qstate);
+		if(!iq->hedge_timer) {
+			log_err("iter_hedge_set_timer: out of memory for "
+				"comm_timer_create");
+			return;
+		}
+	}
+	iq->hedge_due = 0;
+	iq->hedge_addr = target->addr;
+	iq->hedge_addrlen = target->addrlen;
+	iq->hedge_check_ratelimit = sq_check_ratelimit;
+	verbose(VERB_ALGO, "hedge timer set for %d msec", ms);
+#ifndef S_SPLINT_S
+	tv.tv_sec = ms / 1000;
+	tv.tv_usec = (ms % 1000) * 1000;
+#endif
+	comm_timer_set(iq->hedge_timer, &tv);
+}
+
+/** return the credit of a hedged query that was not sent to the budget */
+static void
+iter_hedge_refund(struct module_env* env)
+{
+	env->hedge_credit += HEDGE_CREDIT_COST;
+}
+
+/**
+ * The reply to the outstanding query is slow, send the query to the next
+ * best server as well. The reply that arrives first is used, and the other
+ * query is stopped when that reply is processed.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param id: module id.
+ */
+static void
+iter_hedge_query(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, int id)
+{
+	struct sock_list outstanding;
+	struct delegpt_addr* target;
+	struct outbound_entry* outq;
+	struct sockaddr_storage real_addr;
+	socklen_t real_addrlen;
+	int dnssec_lame = iq->dnssec_lame_query;
+	int chase_to_rd = iq->chase_to_rd;
+	int sq_was_ratelimited = 0;
+
+	qstate->ext_state[id] = module_wait_reply;
+	if(iq->state != QUERYTARGETS_STATE || iq->num_current_queries != 1
+		|| !iq->dp || iq->caps_fallback)
+		return;
+	/* the hedged query counts for the limits like the other sends */
+	if(iq->sent_count >= ie->max_sent_count) {
+		verbose(VERB_ALGO, "no hedged query, the maximum number of "
+			"sends is reached");
+		return;
+	}
+	if(iq->target_count && iq->target_count[TARGET_COUNT_GLOBAL_QUOTA]
+		>= MAX_GLOBAL_QUOTA) {
+		verbose(VERB_ALGO, "no hedged query, the global quota on "
+			"upstream queries is reached");
+		return;
+	}
+	if(qstate->env->hedge_credit < HEDGE_CREDIT_COST) {
+		verbose(VERB_ALGO, "hedge budget used up, no hedged query");
+		return;
+	}
+	qstate->env->hedge_credit -= HEDGE_CREDIT_COST;
+
+	/* the server of the outstanding query is selected last, like
+	 * the blacklisted servers */
+	outstanding.next = qstate->blacklist;
+	outstanding.len = iq->hedge_addrlen;
+	outstanding.addr = iq->hedge_addr;
+	target = iter_server_selection(ie, qstate->env, iq->dp,
+		iq->dp->name, iq->dp->namelen, iq->qchase.qtype,
+		&dnssec_lame, &chase_to_rd, iq->num_target_queries,
+		&outstanding, qstate->prefetch_leeway);
+	if(!target || sockaddr_cmp(&target->addr, target->addrlen,
+		&iq->hedge_addr, iq->hedge_addrlen) == 0 ||
+		dnssec_lame != iq->dnssec_lame_query ||
+		chase_to_rd != iq->chase_to_rd) {
+		verbose(VERB_ALGO, "no other server for a hedged query");
+		iter_hedge_refund(qstate->env);
+		return;
+	}
+
+	target_real_addr(ie, iq, target, &real_addr, &real_addrlen);
+	if(verbosity >= VERB_QUERY) {
+		log_query_info(VERB_QUERY, "sending hedged query:",
+			&iq->qinfo_out);
+		log_name_addr(VERB_QUERY, "sending hedged query to target:",
+			iq->dp->name, &real_addr, real_addrlen);
+	}
+	outq = send_query_to_target(qstate, iq, ie, target, &real_addr,
+		real_addrlen, iq->hedge_check_ratelimit, &sq_was_ratelimited);
+	if(!outq) {
+		if(sq_was_ratelimited)
+			verbose(VERB_ALGO, "hedged query exceeded ratelimits");
+		else log_addr(VERB_QUERY, "error sending hedged query to "
+			"auth server", &real_addr, real_addrlen);
+		iter_hedge_refund(qstate->env);
+		return;
+	}
+	outbound_list_insert(&iq->outlist, outq);
+	iq->num_current_queries++;
+	iq->sent_count++;
+	target_count_increase_global_quota(iq, 1);
+	lock_basic_lock(&ie->hedge_lock);
+	ie->num_queries_hedged++;
+	lock_basic_unlock(&ie->hedge_lock);
+}
+
+void
+iter_hedge_timer_cb(void* arg)
+{
+	struct module_qstate* qstate = (struct module_qstate*)arg;
+	int id = qstate->curmod;
+	if(qstate->env->mesh->mods.mod[id]->operate != &iter_operate ||
+		!qstate->minfo[id])
+		return;
+	verbose(VERB_ALGO, "hedge timer, the reply is slow");
+	((struct iter_qstate*)qstate->minfo[id])->hedge_due = 1;
+	mesh_run(qstate->env->mesh, qstate->mesh_info, module_event_pass,
+		NULL);
+}
 	
 /** 
  * This is the request event state where the request will be sent to one of
@@ -3067,33 +3292,9 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			iq->dnssec_lame_query?" but lame_query anyway": "");
 	}
 
-	real_addr = target->addr;
-	real_addrlen = target->addrlen;
-
-	if(ie->use_nat64 && target->addr.ss_family == AF_INET) {
-		addr_to_nat64(&target->addr, &ie->nat64_prefix_addr,
-			ie->nat64_prefix_addrlen, ie->nat64_prefix_net,
-			&real_addr, &real_addrlen);
-		log_name_addr(VERB_QUERY, "applied NAT64:",
-			iq->dp->name, &real_addr, real_addrlen);
-	}
-
-	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
-	outq = (*qstate->env->send_query)(&iq->qinfo_out,
-		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0),
-		/* unset CD if to forwarder(RD set) and not dnssec retry
-		 * (blacklist nonempty) and no trust-anchors are configured
-		 * above the qname or on the first attempt when dnssec is on */
-		(qstate->env->cfg->disable_edns_do?0:EDNS_DO)|
-		((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
-		!qstate->blacklist&&(!iter_qname_indicates_dnssec(qstate->env,
-		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD),
-		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
-		ie, iq), sq_check_ratelimit, &real_addr, real_addrlen,
-		iq->dp->name, iq->dp->namelen,
-		(iq->dp->tcp_upstream || qstate->env->cfg->tcp_upstream),
-		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream),
-		target->tls_auth_name, qstate, &sq_was_ratelimited);
+	target_real_addr(ie, iq, target, &real_addr, &real_addrlen);
+	outq = send_query_to_target(qstate, iq, ie, target, &real_addr,
+		real_addrlen, sq_check_ratelimit, &sq_was_ratelimited);
 	if(!outq) {
 		if(sq_was_ratelimited) {
 			lock_basic_lock(&ie->queries_ratelimit_lock);
@@ -3115,6 +3316,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	iq->num_current_queries++;
 	iq->sent_count++;
 	qstate->ext_state[id] = module_wait_reply;
+	iter_hedge_set_timer(qstate, iq, ie, target, &real_addr, real_addrlen,
+		sq_check_ratelimit);
 
 	return 0;
 }
@@ -4276,6 +4479,9 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 	sldns_buffer* pkt;
 
 	verbose(VERB_ALGO, "process_response: new external response event");
+	if(iq->hedge_timer)
+		comm_timer_disable(iq->hedge_timer);
+	iq->hedge_due = 0;
 	iq->response = NULL;
 	iq->state = QUERY_RESP_STATE;
 	if(event == module_event_noreply || event == module_event_error) {
@@ -4487,6 +4693,11 @@ iter_operate(struct module_qstate* qstate, enum module_ev event, int id,
 		return;
 	}
 	if(iq && event == module_event_pass) {
+		if(iq->hedge_due) {
+			iq->hedge_due = 0;
+			iter_hedge_query(qstate, iq, ie, id);
+			return;
+		}
 		iter_handle(qstate, iq, ie, id);
 		return;
 	}
@@ -4515,6 +4726,10 @@ iter_clear(struct module_qstate* qstate, int id)
 	iq = (struct iter_qstate*)qstate->minfo[id];
 	if(iq) {
 		outbound_list_clear(&iq->outlist);
+		if(iq->hedge_timer) {
+			comm_timer_delete(iq->hedge_timer);
+			iq->hedge_timer = NULL;
+		}
 		if(iq->target_count && --iq->target_count[TARGET_COUNT_REF] == 0) {
 			free(iq->target_count);
 			if(*iq->nxns_dp) free(*iq->nxns_dp);
@@ -52,6 +52,7 @@ struct iter_donotq;
 struct iter_prep_list;
 struct iter_priv;
 struct rbtree_type;
+struct comm_timer;
 
 /** max number of targets spawned for a query and its subqueries */
 #define MAX_TARGET_COUNT	64
@@ -106,6 +107,12 @@ extern int BLACKLIST_PENALTY;
 #define RTT_BAND 400
 /** Number of retries for empty nodata packets before it is accepted. */
 #define EMPTY_NODATA_RETRY_COUNT 2
+/** The hedge budget credit for one hedged query. Every outgoing query adds
+ * the hedge-budget percentage to the credit. */
+#define HEDGE_CREDIT_COST 100
+/** Max hedge budget credit that is saved up, in hedged queries. This is the
+ * burst of hedged queries that can be sent when servers become slow. */
+#define HEDGE_CREDIT_BURST 10
 
 /**
  * Global state for the iterator.
@@ -164,6 +171,15 @@ struct iter_env {
 
 	/** max number of query restarts to limit length of CNAME chain */
 	int max_query_restarts;
+
+	/** percentage of outgoing queries that can be hedged, 0 if hedged
+	 * queries are disabled */
+	int hedge_budget;
+	/** lock on the hedged query counter, the credit is in the
+	 * module_env of the thread */
+	lock_basic_type hedge_lock;
+	/** number of hedged queries that have been sent */
+	size_t num_queries_hedged;
 };
 
 /**
@@ -472,6 +488,19 @@ struct iter_qstate {
 	} fail_addr;
 	/** which fail_addr, 0 is nothing, 4 or 6 */
 	int fail_addr_type;
+
+	/** timer to send a hedged query, if the reply to the outstanding
+	 * query is slow. NULL if not created. */
+	struct comm_timer* hedge_timer;
+	/** the hedge timer has fired, send the hedged query */
+	int hedge_due;
+	/** address of the outstanding query that the hedge timer is for */
+	struct sockaddr_storage hedge_addr;
+	/** length of hedge_addr */
+	socklen_t hedge_addrlen;
+	/** if the ratelimit was checked for the outstanding query, the
+	 * hedged query does the same */
+	int hedge_check_ratelimit;
 };
 
 /**
@@ -530,6 +559,13 @@ void iter_inform_super(struct module_qstate* qstate, int id,
 /** iterator cleanup query state */
 void iter_clear(struct module_qstate* qstate, int id);
 
+/**
+ * Hedge timer callback. The reply to the outstanding query is slow, run
+ * the iterator to send the query to the next server as well.
+ * @param arg: the query state.
+ */
+void iter_hedge_timer_cb(void* arg);
+
 /** iterator alloc size routine */
 size_t iter_get_mem(struct module_env* env, int id);
 
@@ -46,6 +46,7 @@
 #include "services/modstack.h"
 #include "services/localzone.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/cache/infra.h"
 #include "services/authzone.h"
 #include "services/listen_dnsport.h"
@@ -61,6 +62,7 @@ context_finalize(struct ub_ctx* ctx)
 {
 	int is_rpz = 0;
 	struct config_file* cfg = ctx->env->cfg;
+	struct rrset_cache* old_rrset;
 	verbosity = cfg->verbosity;
 	if(ctx_logfile_overridden && !ctx->logfile_override) {
 		log_file(NULL); /* clear that override */
@@ -107,10 +109,18 @@ context_finalize(struct ub_ctx* ctx)
 		if(!ctx->env->msg_cache)
 			return UB_NOMEM;
 	}
+	old_rrset = ctx->env->rrset_cache;
 	ctx->env->rrset_cache = rrset_cache_adjust(ctx->env->rrset_cache,
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
 		return UB_NOMEM;
+	if(ctx->env->rrset_cache != old_rrset) {
+		deleg_cache_delete(ctx->env->deleg_cache);
+		ctx->env->deleg_cache = NULL;
+	}
+	ctx->env->deleg_cache = deleg_cache_adjust(ctx->env->deleg_cache, cfg);
+	if(!ctx->env->deleg_cache && cfg->deleg_cache_size)
+		return UB_NOMEM;
 	ctx->env->infra_cache = infra_adjust(ctx->env->infra_cache, cfg);
 	if(!ctx->env->infra_cache)
 		return UB_NOMEM;
@@ -194,6 +204,103 @@ context_new(struct ub_ctx* ctx, const char* name, int rrtype, int rrclass,
 	return q;
 }
 
+struct ctx_batch*
+context_batch_new(struct ub_batch_query* queries, int num,
+	ub_batch_callback_type cb, void* cbarg)
+{
+	struct ctx_batch* b = (struct ctx_batch*)calloc(1, sizeof(*b));
+	if(!b) return NULL;
+	b->queries = queries;
+	b->num = num;
+	b->outstanding = num;
+	b->cb = cb;
+	b->cb_arg = cbarg;
+	b->err = (int*)calloc((size_t)num, sizeof(*b->err));
+	b->result = (struct ub_result**)calloc((size_t)num,
+		sizeof(*b->result));
+	if(!b->err || !b->result) {
+		context_batch_delete(b);
+		return NULL;
+	}
+	return b;
+}
+
+void
+context_batch_delete(struct ctx_batch* b)
+{
+	int i;
+	if(!b) return;
+	for(i=0; b->result && i<b->num; i++)
+		ub_resolve_free(b->result[i]);
+	free(b->err);
+	free(b->result);
+	free(b);
+}
+
+struct ctx_batch*
+context_batch_enter_answer(struct ctx_query* q, int err, struct ub_result* res)
+{
+	struct ctx_batch* b = q->batch;
+	b->err[q->batch_idx] = err;
+	b->result[q->batch_idx] = res;
+	if(--b->outstanding > 0)
+		return NULL;
+	return b;
+}
+
+struct ctx_query**
+context_new_batch(struct ub_ctx* ctx, struct ctx_batch* b)
+{
+	struct ctx_query** qs = (struct ctx_query**)calloc((size_t)b->num,
+		sizeof(*qs));
+	int i;
+	if(!qs) return NULL;
+	for(i=0; i<b->num; i++) {
+		struct ctx_query* q = (struct ctx_query*)calloc(1, sizeof(*q));
+		qs[i] = q;
+		if(!q)
+			break;
+		q->node.key = &q->querynum;
+		q->async = 1;
+		q->batch = b;
+		q->batch_idx = i;
+		q->res = (struct ub_result*)calloc(1, sizeof(*q->res));
+		if(!q->res)
+			break;
+		q->res->qname = strdup(b->queries[i].qname);
+		if(!q->res->qname)
+			break;
+		q->res->qtype = b->queries[i].qtype;
+		q->res->qclass = b->queries[i].qclass;
+	}
+	if(i < b->num) {
+		for(; i>=0; i--)
+			context_query_delete(qs[i]);
+		free(qs);
+		return NULL;
+	}
+
+	/* add to query list, with one lock for the batch */
+	lock_basic_lock(&ctx->cfglock);
+	for(i=0; i<b->num; i++) {
+		if(!find_id(ctx, &qs[i]->querynum)) {
+			for(i=i-1; i>=0; i--)
+				(void)rbtree_delete(&ctx->queries,
+					qs[i]->node.key);
+			lock_basic_unlock(&ctx->cfglock);
+			for(i=0; i<b->num; i++)
+				context_query_delete(qs[i]);
+			free(qs);
+			return NULL;
+		}
+		(void)rbtree_insert(&ctx->queries, &qs[i]->node);
+		b->queries[i].async_id = qs[i]->querynum;
+	}
+	ctx->num_async += b->num;
+	lock_basic_unlock(&ctx->cfglock);
+	return qs;
+}
+
 struct alloc_cache* 
 context_obtain_alloc(struct ub_ctx* ctx, int locking)
 {
@@ -211,12 +318,14 @@ context_obtain_alloc(struct ub_ctx* ctx, int locking)
 	}
 	if(a) {
 		a->super = &ctx->superalloc;
+		alloc_set_special_batch(a, ctx->env->cfg->rrset_alloc_batch);
 		return a;
 	}
 	a = (struct alloc_cache*)calloc(1, sizeof(*a));
 	if(!a)
 		return NULL;
 	alloc_init(a, &ctx->superalloc, tnum);
+	alloc_set_special_batch(a, ctx->env->cfg->rrset_alloc_batch);
 	return a;
 }
 
@@ -259,6 +368,42 @@ context_serialize_new_query(struct ctx_query* q, uint32_t* len)
 	return p;
 }
 
+uint8_t*
+context_serialize_new_batch(struct ctx_query** qs, int num, uint32_t* len)
+{
+	/* format for new batch is
+	 * 	o uint32 cmd
+	 * 	o uint32 number of queries
+	 * 	o per query: uint32 length, and the new query format
+	 */
+	uint8_t* p, *at;
+	size_t total = sizeof(uint32_t)*2;
+	int i;
+	for(i=0; i<num; i++)
+		total += sizeof(uint32_t)*5 + strlen(qs[i]->res->qname) + 1;
+	*len = (uint32_t)total;
+	p = (uint8_t*)malloc(total);
+	if(!p) return NULL;
+	sldns_write_uint32(p, UB_LIBCMD_NEWBATCH);
+	sldns_write_uint32(p+sizeof(uint32_t), (uint32_t)num);
+	at = p + sizeof(uint32_t)*2;
+	for(i=0; i<num; i++) {
+		struct ctx_query* q = qs[i];
+		size_t slen = strlen(q->res->qname) + 1/*end of string*/;
+		sldns_write_uint32(at, (uint32_t)(sizeof(uint32_t)*4 + slen));
+		at += sizeof(uint32_t);
+		sldns_write_uint32(at, UB_LIBCMD_NEWQUERY);
+		sldns_write_uint32(at+sizeof(uint32_t), (uint32_t)q->querynum);
+		sldns_write_uint32(at+2*sizeof(uint32_t),
+			(uint32_t)q->res->qtype);
+		sldns_write_uint32(at+3*sizeof(uint32_t),
+			(uint32_t)q->res->qclass);
+		memmove(at+4*sizeof(uint32_t), q->res->qname, slen);
+		at += sizeof(uint32_t)*4 + slen;
+	}
+	return p;
+}
+
 struct ctx_query* 
 context_deserialize_new_query(struct ub_ctx* ctx, uint8_t* p, uint32_t len)
 {
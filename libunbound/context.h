@@ -61,6 +61,9 @@ extern int ctx_logfile_overridden;
  * Contains two pipes for async service
  *	qq : write queries to the async service pid/tid.
  *	rr : read results from the async service pid/tid.
+ * When threaded, every bg thread has its own query pipe, and the threads
+ * put the answered queries on the done list, the rr pipe is then only
+ * used to wake up the reader.
  */
 struct ub_ctx {
 	/* --- pipes --- */
@@ -87,14 +90,32 @@ struct ub_ctx {
 	int created_bg;
 	/** pid of bg worker process */
 	pid_t bg_pid;
-	/** tid of bg worker thread */
-	ub_thread_type bg_tid;
+	/** tids of the bg worker threads, array of bg_num */
+	ub_thread_type* bg_tid;
 	/** pid when pipes are created. This was the process when the
 	 * setup was called. Helps with clean up, so we can tell after a fork
 	 * which side of the fork the delete is on. */
 	pid_t pipe_pid;
-	/** when threaded, the worker that exists in the created thread. */
-	struct libworker* thread_worker;
+	/** when threaded, the workers that exist in the created threads,
+	 * array of bg_num. */
+	struct libworker** thread_worker;
+	/** when threaded, the query pipes of the bg worker threads, array
+	 * of bg_num. The first is the qq_pipe, the others are owned by
+	 * this array. Written to with the qqpipe_lock. */
+	struct tube** bg_qq;
+	/** number of bg worker threads, 0 if not threaded */
+	int bg_num;
+	/** the bg worker thread that gets the next new query */
+	int bg_next;
+
+	/** mutex on the done list, and on the writes of the bg worker
+	 * threads to the rr pipe */
+	lock_basic_type donelock;
+	/** answered queries from the bg worker threads, linked with
+	 * done_next, that the reader has not processed yet. */
+	struct ctx_query* done_first;
+	/** last entry on the done list */
+	struct ctx_query* done_last;
 
 	/** do threading (instead of forking) for async resolution */
 	int dothread;
@@ -130,6 +151,11 @@ struct ub_ctx {
 	int event_base_malloced;
 	/** libworker for event based interface */
 	struct libworker* event_worker;
+	/** idle libworkers for the synchronous resolves, linked list with
+	 * pool_next, protected by cfglock */
+	struct libworker* fg_pool;
+	/** number of workers in the fg_pool */
+	int fg_pool_num;
 
 	/** next query number (to try) to use */
 	int next_querynum;
@@ -180,6 +206,42 @@ struct ctx_query {
 	/** result structure, also contains original query, type, class.
 	 * malloced ptr ready to hand to the client. */
 	struct ub_result* res;
+	/** error code of the answer, when on the done list */
+	int err;
+	/** next on the done list */
+	struct ctx_query* done_next;
+	/** for a resolve into the buffer of the caller, the buffer, or
+	 * NULL. The result is then packed there, and not in res. */
+	uint8_t* resbuf;
+	/** size of resbuf, afterwards the size that is used or needed */
+	size_t resbuf_len;
+	/** the result in resbuf, or NULL if it did not fit */
+	struct ub_result* resbuf_res;
+	/** the batch that this query is part of, or NULL */
+	struct ctx_batch* batch;
+	/** index of the query in the batch */
+	int batch_idx;
+};
+
+/**
+ * A batch of async queries, with one callback when all are done.
+ * The answers are kept here until then, protected by the ctx cfglock.
+ */
+struct ctx_batch {
+	/** the queries array of the caller, filled in at the end */
+	struct ub_batch_query* queries;
+	/** number of queries */
+	int num;
+	/** number of queries that are not answered yet */
+	int outstanding;
+	/** the error codes of the answers, array of num */
+	int* err;
+	/** the results of the answers, array of num */
+	struct ub_result** result;
+	/** the callback function */
+	ub_batch_callback_type cb;
+	/** the callback user arg */
+	void* cb_arg;
 };
 
 /**
@@ -198,7 +260,11 @@ enum ub_ctx_cmd {
 	/** Cancel query, sent to bg worker */
 	UB_LIBCMD_CANCEL,
 	/** Query result, originates from bg worker */
-	UB_LIBCMD_ANSWER
+	UB_LIBCMD_ANSWER,
+	/** Query results are on the done list, from bg worker threads */
+	UB_LIBCMD_DONE,
+	/** New queries of a batch, sent to bg worker */
+	UB_LIBCMD_NEWBATCH
 };
 
 /** 
@@ -232,6 +298,44 @@ struct ctx_query* context_new(struct ub_ctx* ctx, const char* name, int rrtype,
         int rrclass,  ub_callback_type cb, ub_event_callback_type cb_event,
 	void* cbarg);
 
+/**
+ * Create a new batch of queries.
+ * @param queries: the queries array of the caller.
+ * @param num: number of queries.
+ * @param cb: callback when the batch is done.
+ * @param cbarg: user arg for the callback.
+ * @return new batch or NULL for malloc failure.
+ */
+struct ctx_batch* context_batch_new(struct ub_batch_query* queries, int num,
+	ub_batch_callback_type cb, void* cbarg);
+
+/**
+ * Delete a batch, and the results that it has.
+ * @param b: batch to delete.
+ */
+void context_batch_delete(struct ctx_batch* b);
+
+/**
+ * Enter the answer of a query of a batch, with the cfglock held.
+ * @param q: the query, part of a batch.
+ * @param err: the error code, or 0.
+ * @param res: the result, or NULL. It is owned by the batch afterwards.
+ * @return the batch if this was its last outstanding query, the caller
+ *	calls the callback and deletes it, otherwise NULL.
+ */
+struct ctx_batch* context_batch_enter_answer(struct ctx_query* q, int err,
+	struct ub_result* res);
+
+/**
+ * Create the queries of a batch in the context, and add them to the
+ * querynum list, with one lock for the batch.
+ * @param ctx: context
+ * @param b: the batch.
+ * @return array of the new ctx_query entries, malloced, or NULL for malloc
+ *	failure.
+ */
+struct ctx_query** context_new_batch(struct ub_ctx* ctx, struct ctx_batch* b);
+
 /**
  * Get a new alloc. Creates a new one or uses a cached one.
  * @param ctx: context
@@ -249,6 +353,16 @@ struct alloc_cache* context_obtain_alloc(struct ub_ctx* ctx, int locking);
 void context_release_alloc(struct ub_ctx* ctx, struct alloc_cache* alloc,
 	int locking);
 
+/**
+ * Serialize the new queries of a batch.
+ * @param qs: the queries.
+ * @param num: number of queries.
+ * @param len: the length of the allocation is returned.
+ * @return: an alloc, or NULL on mem error.
+ */
+uint8_t* context_serialize_new_batch(struct ctx_query** qs, int num,
+	uint32_t* len);
+
 /**
  * Serialize a context query that questions data.
  * This serializes the query name, type, ...
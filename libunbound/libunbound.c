@@ -63,6 +63,7 @@
 #include "services/localzone.h"
 #include "services/cache/infra.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/authzone.h"
 #include "services/listen_dnsport.h"
 #include "sldns/sbuffer.h"
@@ -123,6 +124,7 @@ static struct ub_ctx* ub_ctx_create_nopipe(void)
 	lock_basic_init(&ctx->qqpipe_lock);
 	lock_basic_init(&ctx->rrpipe_lock);
 	lock_basic_init(&ctx->cfglock);
+	lock_basic_init(&ctx->donelock);
 	ctx->env = (struct module_env*)calloc(1, sizeof(*ctx->env));
 	if(!ctx->env) {
 		ub_randfree(ctx->seed_rnd);
@@ -256,6 +258,9 @@ static void
 delq(rbnode_type* n, void* ATTR_UNUSED(arg))
 {
 	struct ctx_query* q = (struct ctx_query*)n;
+	/* the batch is deleted with its last query */
+	if(q->batch && --q->batch->outstanding == 0)
+		context_batch_delete(q->batch);
 	context_query_delete(q);
 }
 
@@ -268,17 +273,26 @@ static void ub_stop_bg(struct ub_ctx* ctx)
 		uint8_t* msg;
 		uint32_t len;
 		uint32_t cmd = UB_LIBCMD_QUIT;
+		int i, num = (ctx->bg_num?ctx->bg_num:1), quits = 0;
 		lock_basic_unlock(&ctx->cfglock);
 		lock_basic_lock(&ctx->qqpipe_lock);
-		(void)tube_write_msg(ctx->qq_pipe, (uint8_t*)&cmd, 
-			(uint32_t)sizeof(cmd), 0);
+		if(ctx->bg_num) {
+			for(i=0; i<ctx->bg_num; i++)
+				(void)tube_write_msg(ctx->bg_qq[i],
+					(uint8_t*)&cmd, (uint32_t)sizeof(cmd), 0);
+		} else {
+			(void)tube_write_msg(ctx->qq_pipe, (uint8_t*)&cmd, 
+				(uint32_t)sizeof(cmd), 0);
+		}
 		lock_basic_unlock(&ctx->qqpipe_lock);
 		lock_basic_lock(&ctx->rrpipe_lock);
 		while(tube_read_msg(ctx->rr_pipe, &msg, &len, 0)) {
 			/* discard all results except a quit confirm */
 			if(context_serial_getcmd(msg, len) == UB_LIBCMD_QUIT) {
 				free(msg);
-				break;
+				if(++quits >= num)
+					break;
+				continue;
 			}
 			free(msg);
 		}
@@ -289,7 +303,8 @@ static void ub_stop_bg(struct ub_ctx* ctx)
 		lock_basic_lock(&ctx->cfglock);
 		if(ctx->dothread) {
 			lock_basic_unlock(&ctx->cfglock);
-			ub_thread_join(ctx->bg_tid);
+			for(i=0; i<ctx->bg_num; i++)
+				ub_thread_join(ctx->bg_tid[i]);
 		} else {
 			lock_basic_unlock(&ctx->cfglock);
 #ifndef UB_ON_WINDOWS
@@ -309,7 +324,7 @@ void
 ub_ctx_delete(struct ub_ctx* ctx)
 {
 	struct alloc_cache* a, *na;
-	int do_stop = 1;
+	int do_stop = 1, i;
 	if(!ctx) return;
 
 	/* if the delete is called but it has forked, and before the fork
@@ -330,6 +345,10 @@ ub_ctx_delete(struct ub_ctx* ctx)
 			ctx->rr_pipe->listen_com->event_added = 0;
 		if(ctx->rr_pipe->res_com)
 			ctx->rr_pipe->res_com->event_added = 0;
+		for(i=1; i<ctx->bg_num; i++) {
+			if(ctx->bg_qq[i]->listen_com)
+				ctx->bg_qq[i]->listen_com->event_added = 0;
+		}
 #endif
 	}
 	/* see if bg thread is created and if threads have been killed */
@@ -337,22 +356,25 @@ ub_ctx_delete(struct ub_ctx* ctx)
 	/* for processes the read pipe is closed and we see that on read */
 #ifdef HAVE_PTHREAD
 	if(ctx->created_bg && ctx->dothread && do_stop) {
-		if(pthread_kill(ctx->bg_tid, 0) == ESRCH) {
-			/* thread has been killed */
-			do_stop = 0;
+		for(i=0; i<ctx->bg_num; i++) {
+			if(pthread_kill(ctx->bg_tid[i], 0) == ESRCH) {
+				/* thread has been killed */
+				do_stop = 0;
+			}
 		}
 	}
 #endif /* HAVE_PTHREAD */
 	if(do_stop)
 		ub_stop_bg(ctx);
-	if(ctx->created_bg && ctx->pipe_pid != getpid() && ctx->thread_worker) {
+	for(i=0; ctx->created_bg && ctx->pipe_pid != getpid() &&
+		i<ctx->bg_num; i++) {
 		/* This delete is happening from a different process. Delete
-		 * the thread worker from this process memory space. The
-		 * thread is not there to do so, so it is freed here. */
+		 * the thread workers from this process memory space. The
+		 * threads are not there to do so, so they are freed here. */
 		struct ub_event_base* evbase = comm_base_internal(
-			ctx->thread_worker->base);
-		libworker_delete_event(ctx->thread_worker);
-		ctx->thread_worker = NULL;
+			ctx->thread_worker[i]->base);
+		libworker_delete_event(ctx->thread_worker[i]);
+		ctx->thread_worker[i] = NULL;
 #ifdef USE_MINI_EVENT
 		ub_event_base_free(evbase);
 #else
@@ -363,6 +385,7 @@ ub_ctx_delete(struct ub_ctx* ctx)
 #endif
 	}
 	libworker_delete_event(ctx->event_worker);
+	libworker_pool_delete(ctx);
 
 	modstack_call_deinit(&ctx->mods, ctx->env);
 	modstack_call_destartup(&ctx->mods, ctx->env);
@@ -379,10 +402,17 @@ ub_ctx_delete(struct ub_ctx* ctx)
 	lock_basic_destroy(&ctx->qqpipe_lock);
 	lock_basic_destroy(&ctx->rrpipe_lock);
 	lock_basic_destroy(&ctx->cfglock);
+	lock_basic_destroy(&ctx->donelock);
+	for(i=1; i<ctx->bg_num; i++)
+		tube_delete(ctx->bg_qq[i]);
+	free(ctx->bg_qq);
+	free(ctx->bg_tid);
+	free(ctx->thread_worker);
 	tube_delete(ctx->qq_pipe);
 	tube_delete(ctx->rr_pipe);
 	if(ctx->env) {
 		slabhash_delete(ctx->env->msg_cache);
+		deleg_cache_delete(ctx->env->deleg_cache);
 		rrset_cache_delete(ctx->env->rrset_cache);
 		infra_delete(ctx->env->infra_cache);
 		config_delete(ctx->env->cfg);
@@ -581,11 +611,25 @@ ub_fd(struct ub_ctx* ctx)
 	return tube_read_fd(ctx->rr_pipe);
 }
 
+/** call the callback of a complete batch, without locks, and delete it */
+static void
+batch_callback(struct ctx_batch* b)
+{
+	int i;
+	for(i=0; i<b->num; i++) {
+		b->queries[i].err = b->err[i];
+		b->queries[i].result = b->result[i];
+		b->result[i] = NULL;
+	}
+	(*b->cb)(b->cb_arg, b->queries, b->num);
+	context_batch_delete(b);
+}
+
 /** process answer from bg worker */
 static int
 process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
 	ub_callback_type* cb, void** cbarg, int* err,
-	struct ub_result** res)
+	struct ub_result** res, struct ctx_batch** batch)
 {
 	struct ctx_query* q;
 	if(context_serial_getcmd(msg, len) != UB_LIBCMD_ANSWER) {
@@ -635,12 +679,18 @@ process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
 		regional_destroy(region);
 	}
 	q->res = NULL;
+	*batch = NULL;
+	if(q->batch) {
+		*batch = context_batch_enter_answer(q, *err, *res);
+		*res = NULL;
+	}
 	/* delete the q from list */
 	(void)rbtree_delete(&ctx->queries, q->node.key);
 	ctx->num_async--;
 	context_query_delete(q);
 	lock_basic_unlock(&ctx->cfglock);
 
+	if(*batch) return 3;
 	if(*cb) return 2;
 	ub_resolve_free(*res);
 	return 1;
@@ -654,33 +704,116 @@ process_answer(struct ub_ctx* ctx, uint8_t* msg, uint32_t len)
 	ub_callback_type cb;
 	void* cbarg;
 	struct ub_result* res;
+	struct ctx_batch* batch;
 	int r;
 
-	r = process_answer_detail(ctx, msg, len, &cb, &cbarg, &err, &res);
+	r = process_answer_detail(ctx, msg, len, &cb, &cbarg, &err, &res,
+		&batch);
 
 	/* no locks held while calling callback, so that library is
 	 * re-entrant. */
 	if(r == 2)
 		(*cb)(cbarg, err, res);
+	else if(r == 3)
+		batch_callback(batch);
 
 	return r;
 }
 
+/**
+ * Take the answers on the done list from the bg worker threads, and remove
+ * them from the query list. Called with the rrpipe_lock held, like for an
+ * answer from the pipe, so that num_async is down when another thread in
+ * ub_wait looks at it.
+ * @return the list of queries, with in cb, res, err and batch what the
+ *	callback gets, for process_done.
+ */
+static struct ctx_query*
+take_done(struct ub_ctx* ctx)
+{
+	struct ctx_query* q, *list;
+
+	lock_basic_lock(&ctx->donelock);
+	list = ctx->done_first;
+	ctx->done_first = NULL;
+	ctx->done_last = NULL;
+	lock_basic_unlock(&ctx->donelock);
+
+	lock_basic_lock(&ctx->cfglock);
+	for(q = list; q; q = q->done_next) {
+		if(q->cancelled)
+			q->cb = NULL;
+		if(q->err) {
+			ub_resolve_free(q->res);
+			q->res = NULL;
+		}
+		if(q->batch) {
+			if(q->cancelled) {
+				/* the answer came before the cancel */
+				ub_resolve_free(q->res);
+				q->res = NULL;
+				q->err = UB_CANCELLED;
+			}
+			/* the batch is kept if this was its last answer */
+			q->batch = context_batch_enter_answer(q, q->err,
+				q->res);
+			q->res = NULL;
+		}
+		/* delete the q from list */
+		(void)rbtree_delete(&ctx->queries, q->node.key);
+		ctx->num_async--;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+	return list;
+}
+
+/** call the callbacks for the list from take_done, and delete the list */
+static void
+process_done(struct ctx_query* list)
+{
+	struct ctx_query* q;
+	struct ub_result* res;
+	while(list) {
+		q = list;
+		list = q->done_next;
+		res = q->res;
+		q->res = NULL;
+
+		/* no locks held while calling callback, so that library is
+		 * re-entrant. */
+		if(q->batch)
+			batch_callback(q->batch);
+		else if(q->cb)
+			(*q->cb)(q->cb_arg, q->err, res);
+		else	ub_resolve_free(res);
+		context_query_delete(q);
+	}
+}
+
 int 
 ub_process(struct ub_ctx* ctx)
 {
 	int r;
+	struct ctx_query* done;
 	uint8_t* msg;
 	uint32_t len;
 	while(1) {
 		msg = NULL;
+		done = NULL;
 		lock_basic_lock(&ctx->rrpipe_lock);
 		r = tube_read_msg(ctx->rr_pipe, &msg, &len, 1);
+		if(r > 0 && context_serial_getcmd(msg, len) == UB_LIBCMD_DONE)
+			done = take_done(ctx);
 		lock_basic_unlock(&ctx->rrpipe_lock);
 		if(r == 0)
 			return UB_PIPE;
 		else if(r == -1)
 			break;
+		if(context_serial_getcmd(msg, len) == UB_LIBCMD_DONE) {
+			free(msg);
+			process_done(done);
+			continue;
+		}
 		if(!process_answer(ctx, msg, len)) {
 			free(msg);
 			return UB_PIPE;
@@ -697,6 +830,7 @@ ub_wait(struct ub_ctx* ctx)
 	ub_callback_type cb;
 	void* cbarg;
 	struct ub_result* res;
+	struct ctx_batch* batch;
 	int r;
 	uint8_t* msg;
 	uint32_t len;
@@ -729,14 +863,23 @@ ub_wait(struct ub_ctx* ctx)
 				lock_basic_unlock(&ctx->rrpipe_lock);
 				continue;
 			}
+			if(context_serial_getcmd(msg, len) == UB_LIBCMD_DONE) {
+				struct ctx_query* done = take_done(ctx);
+				lock_basic_unlock(&ctx->rrpipe_lock);
+				free(msg);
+				process_done(done);
+				continue;
+			}
 			r = process_answer_detail(ctx, msg, len, 
-				&cb, &cbarg, &err, &res);
+				&cb, &cbarg, &err, &res, &batch);
 			lock_basic_unlock(&ctx->rrpipe_lock);
 			free(msg);
 			if(r == 0)
 				return UB_PIPE;
 			if(r == 2)
 				(*cb)(cbarg, err, res);
+			else if(r == 3)
+				batch_callback(batch);
 		} else {
 			lock_basic_unlock(&ctx->rrpipe_lock);
 		}
@@ -788,6 +931,53 @@ ub_resolve(struct ub_ctx* ctx, const char* name, int rrtype,
 	return UB_NOERROR;
 }
 
+int
+ub_resolve_buf(struct ub_ctx* ctx, const char* name, int rrtype,
+	int rrclass, void* buf, int* buflen, struct ub_result** result)
+{
+	/* the query state is on the stack, it is not in the query list,
+	 * because it is not async; ub_cancel does not apply to it */
+	struct ctx_query q;
+	struct ub_result qres;
+	int r;
+	*result = NULL;
+	if(*buflen < 0)
+		return UB_SYNTAX;
+
+	lock_basic_lock(&ctx->cfglock);
+	if(!ctx->finalized) {
+		r = context_finalize(ctx);
+		if(r) {
+			lock_basic_unlock(&ctx->cfglock);
+			return r;
+		}
+	}
+	lock_basic_unlock(&ctx->cfglock);
+	memset(&q, 0, sizeof(q));
+	memset(&qres, 0, sizeof(qres));
+	qres.qname = (char*)name;
+	qres.qtype = rrtype;
+	qres.qclass = rrclass;
+	q.res = &qres;
+	q.resbuf = (uint8_t*)buf;
+	q.resbuf_len = (size_t)*buflen;
+	/* become a resolver thread for a bit, the result is packed in the
+	 * buffer from the answer in the worker */
+	r = libworker_fg(ctx, &q);
+	if(r == UB_NOERROR) {
+		if(q.resbuf_res) {
+			*result = q.resbuf_res;
+			*buflen = (int)q.resbuf_len;
+		} else if(q.resbuf_len > (size_t)*buflen) {
+			*buflen = (int)q.resbuf_len;
+			r = UB_NOSPACE;
+		} else {
+			r = UB_SERVFAIL;
+		}
+	}
+	return r;
+}
+
 int 
 ub_resolve_event(struct ub_ctx* ctx, const char* name, int rrtype, 
 	int rrclass, void* mydata, ub_event_callback_type callback,
@@ -830,16 +1020,10 @@ ub_resolve_event(struct ub_ctx* ctx, const char* name, int rrtype,
 }
 
 
-int 
-ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
-	int rrclass, void* mydata, ub_callback_type callback, int* async_id)
+/** finalize the context and create the bg worker, if not done yet */
+static int
+ctx_start_bg(struct ub_ctx* ctx)
 {
-	struct ctx_query* q;
-	uint8_t* msg = NULL;
-	uint32_t len = 0;
-
-	if(async_id)
-		*async_id = 0;
 	lock_basic_lock(&ctx->cfglock);
 	if(!ctx->finalized) {
 		int r = context_finalize(ctx);
@@ -862,6 +1046,37 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	} else {
 		lock_basic_unlock(&ctx->cfglock);
 	}
+	return UB_NOERROR;
+}
+
+/** get the query pipe to write a new query to, with qqpipe_lock held */
+static struct tube*
+ctx_next_qq(struct ub_ctx* ctx)
+{
+	struct tube* qq;
+	if(ctx->bg_num) {
+		/* the bg worker threads get the new queries in turn */
+		qq = ctx->bg_qq[ctx->bg_next];
+		ctx->bg_next = (ctx->bg_next+1) % ctx->bg_num;
+	} else {
+		qq = ctx->qq_pipe;
+	}
+	return qq;
+}
+
+int 
+ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
+	int rrclass, void* mydata, ub_callback_type callback, int* async_id)
+{
+	struct ctx_query* q;
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	int r;
+
+	if(async_id)
+		*async_id = 0;
+	if((r=ctx_start_bg(ctx)) != UB_NOERROR)
+		return r;
 
 	/* create new ctx_query and attempt to add to the list */
 	q = context_new(ctx, name, rrtype, rrclass, callback, NULL, mydata);
@@ -883,7 +1098,7 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	lock_basic_unlock(&ctx->cfglock);
 	
 	lock_basic_lock(&ctx->qqpipe_lock);
-	if(!tube_write_msg(ctx->qq_pipe, msg, len, 0)) {
+	if(!tube_write_msg(ctx_next_qq(ctx), msg, len, 0)) {
 		lock_basic_unlock(&ctx->qqpipe_lock);
 		free(msg);
 		return UB_PIPE;
@@ -893,10 +1108,103 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	return UB_NOERROR;
 }
 
+/** the queries of a batch that could not be sent to the bg worker are
+ * answered with the error */
+static void
+batch_fail(struct ub_ctx* ctx, struct ctx_query** qs, int num, int err)
+{
+	struct ctx_batch* b = NULL;
+	int i;
+	lock_basic_lock(&ctx->cfglock);
+	for(i=0; i<num; i++) {
+		b = context_batch_enter_answer(qs[i], err, NULL);
+		(void)rbtree_delete(&ctx->queries, qs[i]->node.key);
+		ctx->num_async--;
+		context_query_delete(qs[i]);
+	}
+	lock_basic_unlock(&ctx->cfglock);
+	/* the other parts of the batch may be answered already */
+	if(b)
+		batch_callback(b);
+}
+
+int
+ub_resolve_batch(struct ub_ctx* ctx, struct ub_batch_query* queries,
+	int num, void* mydata, ub_batch_callback_type callback)
+{
+	struct ctx_batch* b;
+	struct ctx_query** qs;
+	uint8_t* msg;
+	uint32_t len = 0;
+	int r, i, parts, start, end;
+
+	if(num <= 0 || !queries || !callback)
+		return UB_SYNTAX;
+	if((r=ctx_start_bg(ctx)) != UB_NOERROR)
+		return r;
+
+	/* create the ctx_query entries with one lock for the batch */
+	b = context_batch_new(queries, num, callback, mydata);
+	if(!b)
+		return UB_NOMEM;
+	qs = context_new_batch(ctx, b);
+	if(!qs) {
+		context_batch_delete(b);
+		return UB_NOMEM;
+	}
+
+	/* write over the pipe to the background worker, in one message,
+	 * or if there are several bg worker threads, a part to each */
+	lock_basic_lock(&ctx->qqpipe_lock);
+	parts = (ctx->bg_num > 1 ? ctx->bg_num : 1);
+	lock_basic_unlock(&ctx->qqpipe_lock);
+	if(parts > num)
+		parts = num;
+	for(i=0; i<parts; i++) {
+		start = (int)(((size_t)num)*i/parts);
+		end = (int)(((size_t)num)*(i+1)/parts);
+		msg = context_serialize_new_batch(qs+start, end-start, &len);
+		if(!msg) {
+			r = UB_NOMEM;
+			break;
+		}
+		lock_basic_lock(&ctx->qqpipe_lock);
+		if(!tube_write_msg(ctx_next_qq(ctx), msg, len, 0)) {
+			lock_basic_unlock(&ctx->qqpipe_lock);
+			free(msg);
+			r = UB_PIPE;
+			break;
+		}
+		lock_basic_unlock(&ctx->qqpipe_lock);
+		free(msg);
+	}
+	if(i < parts) {
+		start = (int)(((size_t)num)*i/parts);
+		if(start == 0) {
+			/* nothing was sent */
+			lock_basic_lock(&ctx->cfglock);
+			for(i=0; i<num; i++) {
+				(void)rbtree_delete(&ctx->queries,
+					qs[i]->node.key);
+				ctx->num_async--;
+				context_query_delete(qs[i]);
+			}
+			lock_basic_unlock(&ctx->cfglock);
+			context_batch_delete(b);
+			free(qs);
+			return r;
+		}
+		batch_fail(ctx, qs+start, num-start, r);
+	}
+	free(qs);
+	return UB_NOERROR;
+}
+
 int 
 ub_cancel(struct ub_ctx* ctx, int async_id)
 {
 	struct ctx_query* q;
+	struct ctx_batch* batch = NULL;
 	uint8_t* msg = NULL;
 	uint32_t len = 0;
 	lock_basic_lock(&ctx->cfglock);
@@ -914,8 +1222,14 @@ ub_cancel(struct ub_ctx* ctx, int async_id)
 		(void)rbtree_delete(&ctx->queries, q->node.key);
 		ctx->num_async--;
 		msg = context_serialize_cancel(q, &len);
+		if(q->batch)
+			batch = context_batch_enter_answer(q, UB_CANCELLED,
+				NULL);
 		context_query_delete(q);
 		lock_basic_unlock(&ctx->cfglock);
+		/* the other queries of the batch may be answered already */
+		if(batch)
+			batch_callback(batch);
 		if(!msg) {
 			return UB_NOMEM;
 		}
@@ -967,6 +1281,8 @@ ub_strerror(int err)
 		case UB_PIPE: return "error in pipe communication with async";
 		case UB_READFILE: return "error reading file";
 		case UB_NOID: return "error async_id does not exist";
+		case UB_NOSPACE: return "buffer is too small for the result";
+		case UB_CANCELLED: return "query was cancelled";
 		default: return "unknown error";
 	}
 }
@@ -54,6 +54,7 @@
 #include "services/mesh.h"
 #include "services/localzone.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/outbound_list.h"
 #include "services/authzone.h"
 #include "util/fptr_wlist.h"
@@ -62,6 +63,7 @@
 #include "util/random.h"
 #include "util/config_file.h"
 #include "util/netevent.h"
+#include "util/ub_event.h"
 #include "util/proxy_protocol.h"
 #include "util/storage/lookup3.h"
 #include "util/storage/slabhash.h"
@@ -86,6 +88,8 @@
 
 /** handle new query command for bg worker */
 static void handle_newq(struct libworker* w, uint8_t* buf, uint32_t len);
+/** handle new batch command for bg worker */
+static void handle_newbatch(struct libworker* w, uint8_t* buf, uint32_t len);
 
 /** delete libworker env */
 static void
@@ -301,6 +305,9 @@ libworker_do_cmd(struct libworker* w, uint8_t* msg, uint32_t len)
 		case UB_LIBCMD_NEWQUERY:
 			handle_newq(w, msg, len);
 			break;
+		case UB_LIBCMD_NEWBATCH:
+			handle_newbatch(w, msg, len);
+			break;
 		case UB_LIBCMD_CANCEL:
 			handle_cancel(w, msg, len);
 			break;
@@ -331,6 +338,7 @@ libworker_dobg(void* arg)
 	uint32_t m;
 	struct libworker* w = (struct libworker*)arg;
 	struct ub_ctx* ctx;
+	int is_thread;
 	if(!w) {
 		log_err("libunbound bg worker init failed, nomem");
 		return NULL;
@@ -344,12 +352,14 @@ libworker_dobg(void* arg)
 	tube_close_write(ctx->qq_pipe);
 	tube_close_read(ctx->rr_pipe);
 #endif
-	if(!tube_setup_bg_listen(ctx->qq_pipe, w->base, 
+	is_thread = w->is_bg_thread;
+	if(!tube_setup_bg_listen(w->cmd, w->base, 
 		libworker_handle_control_cmd, w)) {
 		log_err("libunbound bg worker init failed, no bglisten");
 		return NULL;
 	}
-	if(!tube_setup_bg_write(ctx->rr_pipe, w->base)) {
+	/* the threads put the answers on the done list of the context */
+	if(!is_thread && !tube_setup_bg_write(ctx->rr_pipe, w->base)) {
 		log_err("libunbound bg worker init failed, no bgwrite");
 		return NULL;
 	}
@@ -360,11 +370,17 @@ libworker_dobg(void* arg)
 	/* cleanup */
 	m = UB_LIBCMD_QUIT;
 	w->want_quit = 1;
-	tube_remove_bg_listen(w->ctx->qq_pipe);
-	tube_remove_bg_write(w->ctx->rr_pipe);
+	tube_remove_bg_listen(w->cmd);
+	if(!is_thread)
+		tube_remove_bg_write(w->ctx->rr_pipe);
 	libworker_delete(w);
+	/* the other threads can write to the rr pipe at the same time */
+	if(is_thread)
+		lock_basic_lock(&ctx->donelock);
 	(void)tube_write_msg(ctx->rr_pipe, (uint8_t*)&m, 
 		(uint32_t)sizeof(m), 0);
+	if(is_thread)
+		lock_basic_unlock(&ctx->donelock);
 #ifdef THREADS_DISABLED
 	/* close pipes from forked process before exit */
 	tube_close_read(ctx->qq_pipe);
@@ -373,21 +389,78 @@ libworker_dobg(void* arg)
 	return NULL;
 }
 
+/** delete the bg worker threads that are set up, but not started */
+static void
+libworker_bg_threads_delete(struct ub_ctx* ctx, int num)
+{
+	int i;
+	for(i=0; i<num; i++) {
+		libworker_delete(ctx->thread_worker[i]);
+		if(i != 0)
+			tube_delete(ctx->bg_qq[i]);
+	}
+	free(ctx->bg_tid);
+	free(ctx->thread_worker);
+	free(ctx->bg_qq);
+	ctx->bg_tid = NULL;
+	ctx->thread_worker = NULL;
+	ctx->bg_qq = NULL;
+}
+
 int libworker_bg(struct ub_ctx* ctx)
 {
 	struct libworker* w;
 	/* fork or threadcreate */
 	lock_basic_lock(&ctx->cfglock);
 	if(ctx->dothread) {
+		int i, num = ctx->env->cfg->resolve_async_threads;
 		lock_basic_unlock(&ctx->cfglock);
-		w = libworker_setup(ctx, 1, NULL);
-		if(!w) return UB_NOMEM;
-		w->is_bg_thread = 1;
-		ctx->thread_worker = w;
+		if(num < 1)
+			num = 1;
+		ctx->bg_tid = (ub_thread_type*)calloc((size_t)num,
+			sizeof(*ctx->bg_tid));
+		ctx->thread_worker = (struct libworker**)calloc((size_t)num,
+			sizeof(*ctx->thread_worker));
+		ctx->bg_qq = (struct tube**)calloc((size_t)num,
+			sizeof(*ctx->bg_qq));
+		if(!ctx->bg_tid || !ctx->thread_worker || !ctx->bg_qq) {
+			libworker_bg_threads_delete(ctx, 0);
+			return UB_NOMEM;
+		}
+		/* set up all the workers before the threads start, the
+		 * first uses the qq pipe, the others get a pipe of their own */
+		for(i=0; i<num; i++) {
+			if(i == 0)
+				ctx->bg_qq[i] = ctx->qq_pipe;
+			else if(!(ctx->bg_qq[i] = tube_create())) {
+				libworker_bg_threads_delete(ctx, i);
+				return UB_NOMEM;
+			}
+			w = libworker_setup(ctx, 1, NULL);
+			if(!w) {
+				if(i != 0)
+					tube_delete(ctx->bg_qq[i]);
+				libworker_bg_threads_delete(ctx, i);
+				return UB_NOMEM;
+			}
+			w->is_bg_thread = 1;
+			w->cmd = ctx->bg_qq[i];
+			ctx->thread_worker[i] = w;
 #ifdef ENABLE_LOCK_CHECKS
-		w->thread_num = 1; /* for nicer DEBUG checklocks */
+			w->thread_num = 1+i; /* for nicer DEBUG checklocks */
 #endif
-		ub_thread_create(&ctx->bg_tid, libworker_dobg, w);
+		}
+		/* start the threads before the qqpipe_lock is taken, the
+		 * queries that are written in the meantime go to the first
+		 * thread, and a writer may hold the lock until that thread
+		 * reads from the full qq pipe */
+		for(i=0; i<num; i++)
+			ub_thread_create(&ctx->bg_tid[i], libworker_dobg,
+				ctx->thread_worker[i]);
+		lock_basic_lock(&ctx->qqpipe_lock);
+		ctx->bg_num = num;
+		ctx->bg_next = 0;
+		lock_basic_unlock(&ctx->qqpipe_lock);
 	} else {
 		lock_basic_unlock(&ctx->cfglock);
 #ifndef HAVE_FORK
@@ -398,6 +471,7 @@ int libworker_bg(struct ub_ctx* ctx)
 			case 0:
 				w = libworker_setup(ctx, 1, NULL);
 				if(!w) fatal_exit("out of memory");
+				w->cmd = ctx->qq_pipe;
 				/* close non-used parts of the pipes */
 				tube_close_write(ctx->qq_pipe);
 				tube_close_read(ctx->rr_pipe);
@@ -419,31 +493,53 @@ int libworker_bg(struct ub_ctx* ctx)
 	return UB_NOERROR;
 }
 
-/** insert canonname */
+/** insert canonname, if region is nonNULL it is allocated there */
 static int
-fill_canon(struct ub_result* res, uint8_t* s)
+fill_canon(struct ub_result* res, uint8_t* s, struct regional* region)
 {
 	char buf[255+2];
+	if(region) {
+		res->canonname = (char*)regional_alloc(region, sizeof(buf));
+		if(!res->canonname)
+			return 0;
+		dname_str(s, res->canonname);
+		return 1;
+	}
 	dname_str(s, buf);
 	res->canonname = strdup(buf);
 	return res->canonname != 0;
 }
 
-/** fill data into result */
+/** fill data into result. If region is nonNULL, the arrays are allocated
+ * in the region and the data points into the rrset, otherwise they are
+ * malloced. */
 static int
 fill_res(struct ub_result* res, struct ub_packed_rrset_key* answer,
-	uint8_t* finalcname, struct query_info* rq, struct reply_info* rep)
+	uint8_t* finalcname, struct query_info* rq, struct reply_info* rep,
+	struct regional* region)
 {
 	size_t i;
 	struct packed_rrset_data* data;
 	res->ttl = 0;
 	if(!answer) {
 		if(finalcname) {
-			if(!fill_canon(res, finalcname))
+			if(!fill_canon(res, finalcname, region))
 				return 0; /* out of memory */
 		}
 		if(rep->rrset_count != 0)
 			res->ttl = (int)rep->ttl;
+		if(region) {
+			res->data = (char**)regional_alloc_zero(region,
+				sizeof(char*));
+			res->len = (int*)regional_alloc_zero(region,
+				sizeof(int));
+			if(!res->data || !res->len) {
+				res->data = NULL;
+				res->len = NULL;
+				return 0; /* out of memory */
+			}
+			return 1;
+		}
 		res->data = (char**)calloc(1, sizeof(char*));
 		if(!res->data)
 			return 0; /* out of memory */
@@ -457,21 +553,37 @@ fill_res(struct ub_result* res, struct ub_packed_rrset_key* answer,
 	}
 	data = (struct packed_rrset_data*)answer->entry.data;
 	if(query_dname_compare(rq->qname, answer->rk.dname) != 0) {
-		if(!fill_canon(res, answer->rk.dname))
+		if(!fill_canon(res, answer->rk.dname, region))
 			return 0; /* out of memory */
 	} else	res->canonname = NULL;
-	res->data = (char**)calloc(data->count+1, sizeof(char*));
-	if(!res->data)
-		return 0; /* out of memory */
-	res->len = (int*)calloc(data->count+1, sizeof(int));
-	if(!res->len) {
-		free(res->data);
-		res->data = NULL;
-		return 0; /* out of memory */
+	if(region) {
+		res->data = (char**)regional_alloc_zero(region,
+			(data->count+1)*sizeof(char*));
+		res->len = (int*)regional_alloc_zero(region,
+			(data->count+1)*sizeof(int));
+		if(!res->data || !res->len) {
+			res->data = NULL;
+			res->len = NULL;
+			return 0; /* out of memory */
+		}
+	} else {
+		res->data = (char**)calloc(data->count+1, sizeof(char*));
+		if(!res->data)
+			return 0; /* out of memory */
+		res->len = (int*)calloc(data->count+1, sizeof(int));
+		if(!res->len) {
+			free(res->data);
+			res->data = NULL;
+			return 0; /* out of memory */
+		}
 	}
 	for(i=0; i<data->count; i++) {
 		/* remove rdlength from rdata */
 		res->len[i] = (int)(data->rr_len[i] - 2);
+		if(region) {
+			res->data[i] = (char*)data->rr_data[i]+2;
+			continue;
+		}
 		res->data[i] = memdup(data->rr_data[i]+2, (size_t)res->len[i]);
 		if(!res->data[i]) {
 			size_t j;
@@ -506,10 +618,11 @@ fill_res(struct ub_result* res, struct ub_packed_rrset_key* answer,
 	return 1;
 }
 
-/** fill result from parsed message, on error fills servfail */
-void
-libworker_enter_result(struct ub_result* res, sldns_buffer* buf,
-	struct regional* temp, enum sec_status msg_security)
+/** fill result from parsed message, on error fills servfail. If in_temp
+ * the result data is in the temp region */
+static void
+enter_result(struct ub_result* res, sldns_buffer* buf,
+	struct regional* temp, enum sec_status msg_security, int in_temp)
 {
 	struct query_info rq;
 	struct reply_info* rep;
@@ -520,7 +633,8 @@ libworker_enter_result(struct ub_result* res, sldns_buffer* buf,
 		return; /* error parsing buf, or out of memory */
 	}
 	if(!fill_res(res, reply_find_answer_rrset(&rq, rep), 
-		reply_find_final_cname_target(&rq, rep), &rq, rep))
+		reply_find_final_cname_target(&rq, rep), &rq, rep,
+		(in_temp?temp:NULL)))
 		return; /* out of memory */
 	/* rcode, havedata, nxdomain, secure, bogus */
 	res->rcode = (int)FLAGS_GET_RCODE(rep->flags);
@@ -535,11 +649,128 @@ libworker_enter_result(struct ub_result* res, sldns_buffer* buf,
 		res->bogus = 1;
 }
 
+void
+libworker_enter_result(struct ub_result* res, sldns_buffer* buf,
+	struct regional* temp, enum sec_status msg_security)
+{
+	enter_result(res, buf, temp, msg_security, 0);
+}
+
+/** align size for the pointers in the result buffer */
+#define RESBUF_ALIGN(x) (((x)+(sizeof(void*)-1))&~(sizeof(void*)-1))
+
+/** copy string into the result buffer */
+static char*
+resbuf_str(uint8_t** at, const char* s)
+{
+	char* r = (char*)*at;
+	size_t len = strlen(s)+1;
+	memmove(r, s, len);
+	*at += len;
+	return r;
+}
+
+/**
+ * Pack the result into the buffer, with the arrays, data and strings.
+ * @param src: the result to copy.
+ * @param buf: the buffer.
+ * @param len: the size of the buffer, on failure set to the size that is
+ *	needed for any alignment of the buffer, on success to the size that
+ *	is used.
+ * @return the result in the buffer, or NULL if it is too small.
+ */
+static struct ub_result*
+resbuf_pack(struct ub_result* src, uint8_t* buf, size_t* len)
+{
+	size_t n = 0, i, need, pad;
+	struct ub_result* res;
+	uint8_t* at;
+	pad = RESBUF_ALIGN((size_t)buf) - (size_t)buf;
+	need = pad + RESBUF_ALIGN(sizeof(*res));
+	if(src->data) {
+		while(src->data[n])
+			n++;
+		need += (n+1)*sizeof(char*) + RESBUF_ALIGN((n+1)*sizeof(int));
+		for(i=0; i<n; i++)
+			need += (size_t)src->len[i];
+	}
+	need += strlen(src->qname)+1;
+	if(src->canonname)
+		need += strlen(src->canonname)+1;
+	if(src->why_bogus)
+		need += strlen(src->why_bogus)+1;
+	if(src->answer_packet)
+		need += (size_t)src->answer_len;
+	if(need > *len) {
+		*len = need - pad + (sizeof(void*)-1);
+		return NULL;
+	}
+	*len = need;
+
+	res = (struct ub_result*)(buf + pad);
+	*res = *src;
+	at = (uint8_t*)res + RESBUF_ALIGN(sizeof(*res));
+	if(src->data) {
+		res->data = (char**)at;
+		at += (n+1)*sizeof(char*);
+		res->len = (int*)at;
+		at += RESBUF_ALIGN((n+1)*sizeof(int));
+		for(i=0; i<n; i++) {
+			res->len[i] = src->len[i];
+			res->data[i] = (char*)at;
+			memmove(at, src->data[i], (size_t)src->len[i]);
+			at += src->len[i];
+		}
+		res->data[n] = NULL;
+		res->len[n] = 0;
+	}
+	res->qname = resbuf_str(&at, src->qname);
+	if(src->canonname)
+		res->canonname = resbuf_str(&at, src->canonname);
+	if(src->why_bogus)
+		res->why_bogus = resbuf_str(&at, src->why_bogus);
+	if(src->answer_packet) {
+		res->answer_packet = at;
+		memmove(at, src->answer_packet, (size_t)src->answer_len);
+	}
+	return res;
+}
+
+/** fillup fg results in the buffer of the caller. The result is made in
+ * the scratch region, pointing into the parsed message, and copied in
+ * the buffer in one go. */
+static void
+libworker_fillup_resbuf(struct ctx_query* q, int rcode, sldns_buffer* buf,
+	enum sec_status s, char* why_bogus, int was_ratelimited)
+{
+	struct ub_result res;
+	memset(&res, 0, sizeof(res));
+	res.qname = q->res->qname;
+	res.qtype = q->res->qtype;
+	res.qclass = q->res->qclass;
+	res.was_ratelimited = was_ratelimited;
+	res.why_bogus = why_bogus;
+	q->msg_security = s;
+	if(rcode != 0) {
+		res.rcode = rcode;
+	} else {
+		res.answer_packet = sldns_buffer_begin(buf);
+		res.answer_len = (int)sldns_buffer_limit(buf);
+		enter_result(&res, buf, q->w->env->scratch, s, 1);
+	}
+	q->resbuf_res = resbuf_pack(&res, q->resbuf, &q->resbuf_len);
+}
+
 /** fillup fg results */
 static void
 libworker_fillup_fg(struct ctx_query* q, int rcode, sldns_buffer* buf, 
 	enum sec_status s, char* why_bogus, int was_ratelimited)
 {
+	if(q->resbuf) {
+		libworker_fillup_resbuf(q, rcode, buf, s, why_bogus,
+			was_ratelimited);
+		return;
+	}
 	q->res->was_ratelimited = was_ratelimited;
 	if(why_bogus)
 		q->res->why_bogus = strdup(why_bogus);
@@ -602,16 +833,68 @@ setup_qinfo_edns(struct libworker* w, struct ctx_query* q,
 	return 1;
 }
 
+/** get a worker for a synchronous resolve, from the pool or a new one */
+static struct libworker*
+libworker_fg_obtain(struct ub_ctx* ctx)
+{
+	struct libworker* w;
+	lock_basic_lock(&ctx->cfglock);
+	w = ctx->fg_pool;
+	if(w) {
+		ctx->fg_pool = w->pool_next;
+		ctx->fg_pool_num--;
+		w->pool_next = NULL;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+	if(!w)
+		return libworker_setup(ctx, 0, NULL);
+	/* the time has not been updated while it was idle */
+	ub_comm_base_now(w->base);
+	return w;
+}
+
+/** put the worker of a synchronous resolve in the pool, or delete it if
+ * the pool is full */
+static void
+libworker_fg_release(struct ub_ctx* ctx, struct libworker* w)
+{
+	lock_basic_lock(&ctx->cfglock);
+	if(ctx->fg_pool_num < ctx->env->cfg->resolve_worker_pool) {
+		w->pool_next = ctx->fg_pool;
+		ctx->fg_pool = w;
+		ctx->fg_pool_num++;
+		w = NULL;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+	libworker_delete(w);
+}
+
+void
+libworker_pool_delete(struct ub_ctx* ctx)
+{
+	struct libworker* w, *nw;
+	lock_basic_lock(&ctx->cfglock);
+	w = ctx->fg_pool;
+	ctx->fg_pool = NULL;
+	ctx->fg_pool_num = 0;
+	lock_basic_unlock(&ctx->cfglock);
+	while(w) {
+		nw = w->pool_next;
+		libworker_delete(w);
+		w = nw;
+	}
+}
+
 int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 {
-	struct libworker* w = libworker_setup(ctx, 0, NULL);
+	struct libworker* w = libworker_fg_obtain(ctx);
 	uint16_t qflags, qid;
 	struct query_info qinfo;
 	struct edns_data edns;
 	if(!w)
 		return UB_INITFAIL;
 	if(!setup_qinfo_edns(w, q, &qinfo, &edns)) {
-		libworker_delete(w);
+		libworker_fg_release(ctx, w);
 		return UB_SYNTAX;
 	}
 	qid = 0;
@@ -626,7 +909,7 @@ int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 		regional_free_all(w->env->scratch);
 		libworker_fillup_fg(q, LDNS_RCODE_NOERROR, 
 			w->back->udp_buff, sec_status_insecure, NULL, 0);
-		libworker_delete(w);
+		libworker_fg_release(ctx, w);
 		free(qinfo.qname);
 		return UB_NOERROR;
 	}
@@ -635,13 +918,14 @@ int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 		regional_free_all(w->env->scratch);
 		libworker_fillup_fg(q, LDNS_RCODE_NOERROR, 
 			w->back->udp_buff, sec_status_insecure, NULL, 0);
-		libworker_delete(w);
+		libworker_fg_release(ctx, w);
 		free(qinfo.qname);
 		return UB_NOERROR;
 	}
 	/* process new query */
 	if(!mesh_new_callback(w->env->mesh, &qinfo, qflags, &edns, 
 		w->back->udp_buff, qid, libworker_fg_done_cb, q, 0)) {
+		libworker_fg_release(ctx, w);
 		free(qinfo.qname);
 		return UB_NOMEM;
 	}
@@ -650,7 +934,8 @@ int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 	/* wait for reply */
 	comm_base_dispatch(w->base);
 
-	libworker_delete(w);
+	regional_free_all(w->env->scratch);
+	libworker_fg_release(ctx, w);
 	return UB_NOERROR;
 }
 
@@ -729,6 +1014,29 @@ int libworker_attach_mesh(struct ub_ctx* ctx, struct ctx_query* q,
 	return UB_NOERROR;
 }
 
+/** put the answered query on the done list of the context, and if the
+ * list was empty, wake up the reader of the results */
+static void
+add_bg_done(struct ub_ctx* ctx, struct ctx_query* q)
+{
+	uint8_t m[sizeof(uint32_t)];
+	q->done_next = NULL;
+	lock_basic_lock(&ctx->donelock);
+	if(ctx->done_last) {
+		/* the reader is woken up already for the list */
+		ctx->done_last->done_next = q;
+		ctx->done_last = q;
+		lock_basic_unlock(&ctx->donelock);
+		return;
+	}
+	ctx->done_first = q;
+	ctx->done_last = q;
+	sldns_write_uint32(m, UB_LIBCMD_DONE);
+	if(!tube_write_msg(ctx->rr_pipe, m, (uint32_t)sizeof(m), 0))
+		log_err("could not wake up the reader of async answers");
+	lock_basic_unlock(&ctx->donelock);
+}
+
 /** add result to the bg worker result queue */
 static void
 add_bg_result(struct libworker* w, struct ctx_query* q, sldns_buffer* pkt, 
@@ -741,33 +1049,37 @@ add_bg_result(struct libworker* w, struct ctx_query* q, sldns_buffer* pkt,
 		context_query_delete(q);
 		return;
 	}
-	/* serialize and delete unneeded q */
 	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
+		/* fill the result in this thread, and hand the q to the
+		 * reader, it is not serialized */
 		if(reason)
 			q->res->why_bogus = strdup(reason);
 		q->res->was_ratelimited = was_ratelimited;
-		if(pkt) {
+		q->err = err;
+		if(pkt && !err) {
 			q->msg_len = sldns_buffer_remaining(pkt);
 			q->msg = memdup(sldns_buffer_begin(pkt), q->msg_len);
 			if(!q->msg) {
-				msg = context_serialize_answer(q, UB_NOMEM, NULL, &len);
+				q->err = UB_NOMEM;
 			} else {
-				msg = context_serialize_answer(q, err, NULL, &len);
+				libworker_enter_result(q->res, pkt,
+					w->env->scratch, q->msg_security);
+				q->res->answer_packet = q->msg;
+				q->res->answer_len = (int)q->msg_len;
+				q->msg = NULL;
 			}
-		} else {
-			msg = context_serialize_answer(q, err, NULL, &len);
 		}
-		lock_basic_unlock(&w->ctx->cfglock);
-	} else {
-		if(reason)
-			q->res->why_bogus = strdup(reason);
-		q->res->was_ratelimited = was_ratelimited;
-		msg = context_serialize_answer(q, err, pkt, &len);
-		(void)rbtree_delete(&w->ctx->queries, q->node.key);
-		w->ctx->num_async--;
-		context_query_delete(q);
+		add_bg_done(w->ctx, q);
+		return;
 	}
+	/* serialize and delete unneeded q */
+	if(reason)
+		q->res->why_bogus = strdup(reason);
+	q->res->was_ratelimited = was_ratelimited;
+	msg = context_serialize_answer(q, err, pkt, &len);
+	(void)rbtree_delete(&w->ctx->queries, q->node.key);
+	w->ctx->num_async--;
+	context_query_delete(q);
 
 	if(!msg) {
 		log_err("out of memory for async answer");
@@ -786,14 +1098,27 @@ libworker_bg_done_cb(void* arg, int rcode, sldns_buffer* buf, enum sec_status s,
 	struct ctx_query* q = (struct ctx_query*)arg;
 
 	if(q->cancelled || q->w->back->want_to_quit) {
+		if(q->w->is_bg_thread && !q->w->back->want_to_quit) {
+			/* the reader thread deletes it, and the batch gets
+			 * the cancel. The reader is woken up, also when it
+			 * waits for this as the last query in ub_wait */
+			add_bg_result(q->w, q, NULL, UB_CANCELLED, NULL, 0);
+			return;
+		}
 		if(q->w->is_bg_thread) {
 			/* delete it now */
 			struct ub_ctx* ctx = q->w->ctx;
+			struct ctx_batch* batch = NULL;
 			lock_basic_lock(&ctx->cfglock);
+			if(q->batch)
+				batch = context_batch_enter_answer(q,
+					UB_CANCELLED, NULL);
 			(void)rbtree_delete(&ctx->queries, q->node.key);
 			ctx->num_async--;
 			context_query_delete(q);
 			lock_basic_unlock(&ctx->cfglock);
+			/* the context is deleted, no callback */
+			context_batch_delete(batch);
 		}
 		/* cancelled, do not give answer */
 		return;
@@ -809,26 +1134,13 @@ libworker_bg_done_cb(void* arg, int rcode, sldns_buffer* buf, enum sec_status s,
 }
 
 
-/** handle new query command for bg worker */
+/** start the resolution of a new query in the bg worker */
 static void
-handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
+libworker_bg_newq(struct libworker* w, struct ctx_query* q)
 {
 	uint16_t qflags, qid;
 	struct query_info qinfo;
 	struct edns_data edns;
-	struct ctx_query* q;
-	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
-		q = context_lookup_new_query(w->ctx, buf, len);
-		lock_basic_unlock(&w->ctx->cfglock);
-	} else {
-		q = context_deserialize_new_query(w->ctx, buf, len);
-	}
-	free(buf);
-	if(!q) {
-		log_err("failed to deserialize newq");
-		return;
-	}
 	if(!setup_qinfo_edns(w, q, &qinfo, &edns)) {
 		add_bg_result(w, q, NULL, UB_SYNTAX, NULL, 0);
 		return;
@@ -864,11 +1176,115 @@ handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
 	free(qinfo.qname);
 }
 
+/** handle new query command for bg worker */
+static void
+handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
+{
+	struct ctx_query* q;
+	if(w->is_bg_thread) {
+		lock_basic_lock(&w->ctx->cfglock);
+		q = context_lookup_new_query(w->ctx, buf, len);
+		lock_basic_unlock(&w->ctx->cfglock);
+	} else {
+		q = context_deserialize_new_query(w->ctx, buf, len);
+	}
+	free(buf);
+	if(!q) {
+		log_err("failed to deserialize newq");
+		return;
+	}
+	libworker_bg_newq(w, q);
+}
+
+/** answer the query with the id with an error, in the forked worker,
+ * when the query could not be set up */
+static void
+add_bg_error_id(struct libworker* w, int querynum, int err)
+{
+	struct ctx_query q;
+	struct ub_result res;
+	uint8_t* msg;
+	uint32_t len = 0;
+	memset(&q, 0, sizeof(q));
+	memset(&res, 0, sizeof(res));
+	q.querynum = querynum;
+	q.res = &res;
+	msg = context_serialize_answer(&q, err, NULL, &len);
+	if(!msg) {
+		log_err("out of memory for async answer");
+		return;
+	}
+	if(!tube_queue_item(w->ctx->rr_pipe, msg, len)) {
+		log_err("out of memory for async answer");
+		return;
+	}
+}
+
+/** handle new batch command for bg worker */
+static void
+handle_newbatch(struct libworker* w, uint8_t* buf, uint32_t len)
+{
+	struct ctx_query** qs;
+	uint32_t i, num, qlen;
+	size_t at = sizeof(uint32_t)*2;
+	if(len < sizeof(uint32_t)*2) {
+		free(buf);
+		log_err("failed to deserialize newbatch");
+		return;
+	}
+	num = sldns_read_uint32(buf+sizeof(uint32_t));
+	if(num > len/(sizeof(uint32_t)*5)) {
+		free(buf);
+		log_err("failed to deserialize newbatch");
+		return;
+	}
+	qs = (struct ctx_query**)calloc(num+1, sizeof(*qs));
+	if(!qs) {
+		free(buf);
+		log_err("failed to deserialize newbatch: out of memory");
+		return;
+	}
+	/* look up the queries with one lock for the batch */
+	if(w->is_bg_thread)
+		lock_basic_lock(&w->ctx->cfglock);
+	for(i=0; i<num; i++) {
+		if(at + sizeof(uint32_t) > len)
+			break;
+		qlen = sldns_read_uint32(buf+at);
+		at += sizeof(uint32_t);
+		if(qlen > len - at)
+			break;
+		if(w->is_bg_thread)
+			qs[i] = context_lookup_new_query(w->ctx, buf+at, qlen);
+		else	qs[i] = context_deserialize_new_query(w->ctx, buf+at,
+				qlen);
+		if(!qs[i] && !w->is_bg_thread && qlen >= sizeof(uint32_t)*2) {
+			/* the batch waits for every query, send it the
+			 * error */
+			log_err("failed to deserialize newq");
+			add_bg_error_id(w, (int)sldns_read_uint32(buf+at+
+				sizeof(uint32_t)), UB_NOMEM);
+		}
+		at += qlen;
+	}
+	if(w->is_bg_thread)
+		lock_basic_unlock(&w->ctx->cfglock);
+	free(buf);
+	for(i=0; i<num; i++) {
+		/* the bg thread finds no query if it was deleted */
+		if(!qs[i])
+			continue;
+		libworker_bg_newq(w, qs[i]);
+	}
+	free(qs);
+}
+
 void libworker_alloc_cleanup(void* arg)
 {
 	struct libworker* w = (struct libworker*)arg;
 	slabhash_clear(&w->env->rrset_cache->table);
         slabhash_clear(w->env->msg_cache);
+	deleg_cache_clear(w->env->deleg_cache);
 }
 
 struct outbound_entry* libworker_send_query(struct query_info* qinfo,
@@ -961,6 +1377,22 @@ int remote_control_callback(struct comm_point* ATTR_UNUSED(c),
 	return 0;
 }
 
+int metrics_accept_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
+int metrics_http_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
 void worker_sighandler(int ATTR_UNUSED(sig), void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -1029,6 +1461,11 @@ void remote_get_opt_ssl(char* ATTR_UNUSED(str), void* ATTR_UNUSED(arg))
         log_assert(0);
 }
 
+void remote_fast_reload_retired_delete(void* ATTR_UNUSED(arg))
+{
+        log_assert(0);
+}
+
 #ifdef UB_ON_WINDOWS
 void
 worker_win_stop_cb(int ATTR_UNUSED(fd), short ATTR_UNUSED(ev), void* 
@@ -88,6 +88,11 @@ struct libworker {
 	struct ub_randstate* rndstate;
 	/** sslcontext for SSL wrapped DNS over TCP queries */
 	void* sslctx;
+	/** for the bg worker, the pipe that the commands come in on */
+	struct tube* cmd;
+	/** next idle worker in the pool for synchronous resolves of the
+	 * context, protected by the ctx cfglock */
+	struct libworker* pool_next;
 };
 
 /**
@@ -111,6 +116,13 @@ int libworker_bg(struct ub_ctx* ctx);
  */
 int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q);
 
+/**
+ * Delete the idle workers in the pool of the context, that are kept
+ * for the synchronous resolves.
+ * @param ctx: the context.
+ */
+void libworker_pool_delete(struct ub_ctx* ctx);
+
 /**
  * create worker for event-based interface.
  * @param ctx: context with config.
@@ -232,6 +232,44 @@ struct ub_result {
  */
 typedef void (*ub_callback_type)(void*, int, struct ub_result*);
 
+/**
+ * A query of a batch for ub_resolve_batch.
+ * The qname, qtype and qclass are set by the caller, the err and result
+ * are filled in when the batch is done.
+ */
+struct ub_batch_query {
+	/** domain name in text format (a string) */
+	const char* qname;
+	/** type of RR in host order, 1 is A */
+	int qtype;
+	/** class of RR in host order, 1 is IN (for internet) */
+	int qclass;
+	/** the id of the query, set by ub_resolve_batch, it can be passed
+	 * to ub_cancel */
+	int async_id;
+	/** 0 when a result has been found, otherwise an error code,
+	 * and the result is NULL */
+	int err;
+	/** the result structure, allocated on the heap and it needs to
+	 * be freed with ub_resolve_free(result) */
+	struct ub_result* result;
+};
+
+/**
+ * Callback for a batch of async queries, called once when all the
+ * queries in the batch are done.
+ * The readable function definition looks like:
+ * void my_batch_callback(void* my_arg, struct ub_batch_query* queries,
+ *	int num);
+ * It is called with
+ *	void* my_arg: your pointer to a (struct of) data of your choice,
+ *		or NULL.
+ *	struct ub_batch_query* queries: the array that was passed to
+ *		ub_resolve_batch, with the err and result filled in.
+ *	int num: the number of queries in the array.
+ */
+typedef void (*ub_batch_callback_type)(void*, struct ub_batch_query*, int);
+
 /**
  * The error constants
  */
@@ -258,7 +296,11 @@ enum ub_ctx_err {
 	/** error reading from file (resolv.conf) */
 	UB_READFILE = -9,
 	/** error async_id does not exist or result already been delivered */
-	UB_NOID = -10
+	UB_NOID = -10,
+	/** the buffer is too small for the result */
+	UB_NOSPACE = -11,
+	/** the query of a batch was cancelled */
+	UB_CANCELLED = -12
 };
 
 /**
@@ -537,6 +579,37 @@ int ub_process(struct ub_ctx* ctx);
 int ub_resolve(struct ub_ctx* ctx, const char* name, int rrtype,
 	int rrclass, struct ub_result** result);
 
+/**
+ * Perform resolution and validation of the target name, and store the
+ * result in the buffer that is passed.
+ * Like ub_resolve, but the result is not allocated. The result structure,
+ * the data and len arrays, the rdata, the names, the why_bogus string and
+ * the answer packet are all placed in the buffer, so that the data points
+ * into the buffer.  The result is read only and is not freed with
+ * ub_resolve_free; it is gone when the buffer is reused or freed.
+ * @param ctx: context.
+ *	The context is finalized, and can no longer accept config changes.
+ * @param name: domain name in text format (a zero terminated text string).
+ * @param rrtype: type of RR in host order, 1 is A (address).
+ * @param rrclass: class of RR in host order, 1 is IN (for internet).
+ * @param buf: the buffer for the result.
+ * The query state is not allocated.  With the resolve-worker-pool option
+ * set, an answer from the cache takes one allocation, for the name in wire
+ * format.  Without it, every call sets up and deletes a worker, that is
+ * several hundred allocations.
+ * @param buflen: the size of the buffer.  On return it is set to the size
+ *	that the result uses.  If the buffer is too small, UB_NOSPACE is
+ *	returned and it is set to the size that is needed, the lookup can
+ *	then be done again with a larger buffer, likely from the cache.
+ *	The answer from the cache can be different, e.g. the packet of a
+ *	cached SERVFAIL, and then UB_NOSPACE can be returned again.
+ * @param result: the result in the buffer is returned here.  May be NULL
+ *	on return, return value is set to an error in that case.
+ * @return 0 if OK, else error.
+ */
+int ub_resolve_buf(struct ub_ctx* ctx, const char* name, int rrtype,
+	int rrclass, void* buf, int* buflen, struct ub_result** result);
+
 /**
  * Perform resolution and validation of the target name.
  * Asynchronous, after a while, the callback will be called with your
@@ -568,6 +641,36 @@ int ub_resolve(struct ub_ctx* ctx, const char* name, int rrtype,
 int ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	int rrclass, void* mydata, ub_callback_type callback, int* async_id);
 
+/**
+ * Perform resolution and validation of a batch of target names.
+ * Asynchronous, like ub_resolve_async, but the queries are handed to the
+ * background in one go, and the callback is called once, when all the
+ * queries in the batch are done.  The results are then processed with
+ * ub_process or ub_wait, like for ub_resolve_async.
+ * @param ctx: context.
+ *	If no thread or process has been created yet to perform the
+ *	work in the background, it is created now.
+ *	The context is finalized, and can no longer accept config changes.
+ * @param queries: array with the queries, the qname, qtype and qclass
+ *	of every entry is set.  The array has to stay valid until the
+ *	callback is called, the err and result are then filled in.
+ *	If the context is deleted before that, the callback is not called.
+ * @param num: number of queries in the array.
+ * @param mydata: this data is your own data (you can pass NULL),
+ * 	and is passed on to the callback function.
+ * @param callback: this is called when all the queries are done.
+ * 	It is called as:
+ * 	void callback(void* mydata, struct ub_batch_query* queries, int num)
+ * 	with the queries array from this call, the results in it are newly
+ *	allocated and freed by you with ub_resolve_free.
+ * @return 0 if OK, else error.  On error the callback is not called.
+ *	A query of the batch can be cancelled with ub_cancel and its
+ *	async_id, the batch callback is still called, with err
+ *	UB_CANCELLED for that query.
+ */
+int ub_resolve_batch(struct ub_ctx* ctx, struct ub_batch_query* queries,
+	int num, void* mydata, ub_batch_callback_type callback);
+
 /**
  * Cancel an async query in progress.
  * Its callback will not be called.
@@ -849,6 +952,12 @@ struct ub_server_stats {
 	long long mem_quic;
 	/** number of queries over (DNS over) QUIC */
 	long long qquic;
+	/** number of upstream TLS connections that resumed a session */
+	long long qtls_outgoing_resume;
+	/** number of upstream TLS connections with a full handshake */
+	long long qtls_outgoing_full;
+	/** number of hedged queries sent to upstream servers */
+	long long queries_hedged;
 };
 
 /**
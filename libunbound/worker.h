@@ -177,7 +177,16 @@ int remote_accept_callback(struct comm_point*, void*, int, struct comm_reply*);
 /** handle remote control data callbacks */
 int remote_control_callback(struct comm_point*, void*, int, struct comm_reply*);
 
+/** handle metrics listener accept callbacks */
+int metrics_accept_callback(struct comm_point*, void*, int, struct comm_reply*);
+
+/** handle metrics listener http connection callbacks */
+int metrics_http_callback(struct comm_point*, void*, int, struct comm_reply*);
+
 /** routine to printout option values over SSL */
 void  remote_get_opt_ssl(char* line, void* arg);
 
+/** delete the structures a fast reload replaced, when no query uses them */
+void remote_fast_reload_retired_delete(void* arg);
+
 #endif /* LIBUNBOUND_WORKER_H */
@@ -0,0 +1,239 @@
+/*
+ * services/cache/deleg.c - delegation cache, glue of the zone cuts
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the delegation cache, with the glue of the zone cuts
+ * as references into the rrset cache.
+ */
+#include "config.h"
+#include "services/cache/deleg.h"
+#include "util/storage/slabhash.h"
+#include "util/storage/lookup3.h"
+#include "util/data/dname.h"
+#include "util/regional.h"
+#include "util/config_file.h"
+#include "util/log.h"
+#include "util/net_help.h"
+
+size_t
+deleg_cache_sizefunc(void* k, void* d)
+{
+	struct deleg_cache_key* key = (struct deleg_cache_key*)k;
+	struct deleg_cache_data* data = (struct deleg_cache_data*)d;
+	return sizeof(*key) + key->namelen + data->size
+		+ lock_get_mem(&key->entry.lock);
+}
+
+int
+deleg_cache_compfunc(void* key1, void* key2)
+{
+	struct deleg_cache_key* k1 = (struct deleg_cache_key*)key1;
+	struct deleg_cache_key* k2 = (struct deleg_cache_key*)key2;
+	if(k1->dclass != k2->dclass) {
+		if(k1->dclass < k2->dclass)
+			return -1;
+		return 1;
+	}
+	return query_dname_compare(k1->name, k2->name);
+}
+
+void
+deleg_cache_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct deleg_cache_key* key = (struct deleg_cache_key*)k;
+	if(!key)
+		return;
+	lock_rw_destroy(&key->entry.lock);
+	free(key->name);
+	free(key);
+}
+
+void
+deleg_cache_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+{
+	/* the glue array and the names are in the same allocation */
+	free(d);
+}
+
+/** calculate the hash of the zone cut */
+static hashvalue_type
+deleg_cache_hash(uint8_t* name, uint16_t dclass)
+{
+	hashvalue_type h = 0xd31e;
+	h = hashlittle(&dclass, sizeof(dclass), h);
+	return dname_query_hash(name, h);
+}
+
+struct deleg_cache*
+deleg_cache_create(struct config_file* cfg)
+{
+	struct deleg_cache* dc;
+	if(cfg->deleg_cache_size == 0)
+		return NULL; /* disabled */
+	dc = (struct deleg_cache*)calloc(1, sizeof(*dc));
+	if(!dc) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	dc->slab = slabhash_create(cfg->rrset_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->deleg_cache_size,
+		&deleg_cache_sizefunc, &deleg_cache_compfunc,
+		&deleg_cache_delkeyfunc, &deleg_cache_deldatafunc, NULL);
+	if(!dc->slab) {
+		log_err("malloc failure");
+		free(dc);
+		return NULL;
+	}
+	return dc;
+}
+
+void
+deleg_cache_delete(struct deleg_cache* dc)
+{
+	if(!dc)
+		return;
+	slabhash_delete(dc->slab);
+	free(dc);
+}
+
+struct deleg_cache*
+deleg_cache_adjust(struct deleg_cache* dc, struct config_file* cfg)
+{
+	if(!dc || !slabhash_is_size(dc->slab, cfg->deleg_cache_size,
+		cfg->rrset_cache_slabs)) {
+		deleg_cache_delete(dc);
+		dc = deleg_cache_create(cfg);
+	}
+	return dc;
+}
+
+void
+deleg_cache_clear(struct deleg_cache* dc)
+{
+	if(!dc)
+		return;
+	slabhash_clear(dc->slab);
+}
+
+struct deleg_cache_glue*
+deleg_cache_lookup(struct deleg_cache* dc, uint8_t* name, size_t namelen,
+	uint16_t dclass, struct regional* region, size_t* num)
+{
+	struct deleg_cache_key lookfor;
+	struct deleg_cache_data* data;
+	struct deleg_cache_glue* glue;
+	struct lruhash_entry* e;
+	size_t i;
+	lookfor.entry.key = &lookfor;
+	lookfor.name = name;
+	lookfor.namelen = namelen;
+	lookfor.dclass = dclass;
+	e = slabhash_lookup(dc->slab, deleg_cache_hash(name, dclass),
+		&lookfor, 0);
+	if(!e)
+		return NULL;
+	data = (struct deleg_cache_data*)e->data;
+	glue = (struct deleg_cache_glue*)regional_alloc_init(region,
+		data->glue, sizeof(*glue)*data->num);
+	if(!glue) {
+		lock_rw_unlock(&e->lock);
+		return NULL;
+	}
+	for(i=0; i<data->num; i++) {
+		glue[i].name = regional_alloc_init(region, glue[i].name,
+			glue[i].namelen);
+		if(!glue[i].name) {
+			lock_rw_unlock(&e->lock);
+			return NULL;
+		}
+	}
+	*num = data->num;
+	lock_rw_unlock(&e->lock);
+	return glue;
+}
+
+void
+deleg_cache_insert(struct deleg_cache* dc, uint8_t* name, size_t namelen,
+	uint16_t dclass, struct deleg_cache_glue* glue, size_t num)
+{
+	struct deleg_cache_key* key;
+	struct deleg_cache_data* data;
+	uint8_t* p;
+	size_t i, size = sizeof(*data) + sizeof(*glue)*num;
+	for(i=0; i<num; i++)
+		size += glue[i].namelen;
+	data = (struct deleg_cache_data*)malloc(size);
+	if(!data)
+		return;
+	data->num = num;
+	data->size = size;
+	data->glue = (struct deleg_cache_glue*)(data+1);
+	p = (uint8_t*)(data->glue+num);
+	for(i=0; i<num; i++) {
+		data->glue[i] = glue[i];
+		memmove(p, glue[i].name, glue[i].namelen);
+		data->glue[i].name = p;
+		p += glue[i].namelen;
+	}
+	key = (struct deleg_cache_key*)calloc(1, sizeof(*key));
+	if(!key) {
+		free(data);
+		return;
+	}
+	key->name = memdup(name, namelen);
+	if(!key->name) {
+		free(key);
+		free(data);
+		return;
+	}
+	key->namelen = namelen;
+	key->dclass = dclass;
+	lock_rw_init(&key->entry.lock);
+	key->entry.key = key;
+	key->entry.data = data;
+	key->entry.hash = deleg_cache_hash(name, dclass);
+	slabhash_insert(dc->slab, key->entry.hash, &key->entry, data, NULL);
+}
+
+size_t
+deleg_cache_get_mem(struct deleg_cache* dc)
+{
+	if(!dc)
+		return 0;
+	return sizeof(*dc) + slabhash_get_mem(dc->slab);
+}
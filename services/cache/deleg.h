@@ -0,0 +1,183 @@
+/*
+ * services/cache/deleg.h - delegation cache, glue of the zone cuts
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the delegation cache. For every zone cut it has the
+ * A and AAAA rrsets of the nameserver names, as references into the rrset
+ * cache. The delegation point is then assembled without a cache lookup
+ * for every nameserver name. The references are checked with the rrset
+ * ids, like the message cache does, so changed or removed rrsets are
+ * noticed when the entry is used.
+ */
+
+#ifndef SERVICES_CACHE_DELEG_H
+#define SERVICES_CACHE_DELEG_H
+#include "util/storage/lruhash.h"
+#include "util/data/msgreply.h"
+struct slabhash;
+struct config_file;
+struct regional;
+
+/**
+ * The delegation cache.
+ */
+struct deleg_cache {
+	/** uses slabhash for storage, deleg_cache_key, deleg_cache_data */
+	struct slabhash* slab;
+};
+
+/**
+ * The glue of one nameserver name.
+ */
+struct deleg_cache_glue {
+	/** the nameserver name */
+	uint8_t* name;
+	/** length of the nameserver name */
+	size_t namelen;
+	/** the A rrset, key is NULL if it was not in the cache */
+	struct rrset_ref a;
+	/** the AAAA rrset, key is NULL if it was not in the cache */
+	struct rrset_ref aaaa;
+};
+
+/**
+ * Key of a delegation cache entry, the zone cut.
+ */
+struct deleg_cache_key {
+	/** the hash table entry, data is struct deleg_cache_data */
+	struct lruhash_entry entry;
+	/** the zone name, malloced */
+	uint8_t* name;
+	/** length of the zone name */
+	size_t namelen;
+	/** the class of the zone */
+	uint16_t dclass;
+};
+
+/**
+ * Data of a delegation cache entry.
+ */
+struct deleg_cache_data {
+	/** number of nameservers */
+	size_t num;
+	/** the glue per nameserver, in the order of the NS rrset. Allocated
+	 * together with this struct, and with the names after it. */
+	struct deleg_cache_glue* glue;
+	/** size of the allocation, in bytes */
+	size_t size;
+};
+
+/**
+ * Create the delegation cache.
+ * @param cfg: config settings for the size.
+ * @return new cache, or NULL on malloc failure, or if it is disabled
+ *	with a size of 0.
+ */
+struct deleg_cache* deleg_cache_create(struct config_file* cfg);
+
+/**
+ * Delete the delegation cache.
+ * @param dc: to delete.
+ */
+void deleg_cache_delete(struct deleg_cache* dc);
+
+/**
+ * Adjust the delegation cache to the config settings. Recreates it if the
+ * size changes.
+ * @param dc: the cache, or NULL.
+ * @param cfg: config settings.
+ * @return the cache, or NULL on malloc failure, or if it is disabled.
+ */
+struct deleg_cache* deleg_cache_adjust(struct deleg_cache* dc,
+	struct config_file* cfg);
+
+/**
+ * Remove all entries. Call when the rrset cache is cleared, or the
+ * rrset ids are reset.
+ * @param dc: the cache, or NULL.
+ */
+void deleg_cache_clear(struct deleg_cache* dc);
+
+/**
+ * Lookup the glue of a zone cut.
+ * @param dc: the cache.
+ * @param name: the zone name.
+ * @param namelen: length of the zone name.
+ * @param dclass: the class.
+ * @param region: the glue is copied into this region.
+ * @param num: returns the number of nameservers.
+ * @return the glue array, not locked, or NULL if not found. The rrset
+ *	references have to be checked with rrset_array_lock.
+ */
+struct deleg_cache_glue* deleg_cache_lookup(struct deleg_cache* dc,
+	uint8_t* name, size_t namelen, uint16_t dclass,
+	struct regional* region, size_t* num);
+
+/**
+ * Insert or replace the glue of a zone cut.
+ * @param dc: the cache.
+ * @param name: the zone name.
+ * @param namelen: length of the zone name.
+ * @param dclass: the class.
+ * @param glue: the glue array, it is copied.
+ * @param num: the number of nameservers.
+ */
+void deleg_cache_insert(struct deleg_cache* dc, uint8_t* name,
+	size_t namelen, uint16_t dclass, struct deleg_cache_glue* glue,
+	size_t num);
+
+/**
+ * Get memory used by the delegation cache.
+ * @param dc: the cache, or NULL.
+ * @return memory in bytes.
+ */
+size_t deleg_cache_get_mem(struct deleg_cache* dc);
+
+/** calculate size, for the hash table */
+size_t deleg_cache_sizefunc(void* k, void* d);
+
+/** compare keys, for the hash table */
+int deleg_cache_compfunc(void* key1, void* key2);
+
+/** delete key, for the hash table */
+void deleg_cache_delkeyfunc(void* k, void* arg);
+
+/** delete data, for the hash table */
+void deleg_cache_deldatafunc(void* d, void* arg);
+
+#endif /* SERVICES_CACHE_DELEG_H */
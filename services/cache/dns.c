@@ -45,6 +45,7 @@
 #include "validator/val_utils.h"
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "util/data/msgparse.h"
 #include "util/data/msgreply.h"
 #include "util/data/packed_rrset.h"
@@ -302,6 +303,116 @@ msg_cache_lookup(struct module_env* env, uint8_t* qname, size_t qnamelen,
 	return (struct msgreply_entry*)e->key;
 }
 
+/** compare rrset references by key, for the lock order */
+static int
+deleg_ref_cmp(const void* x, const void* y)
+{
+	struct rrset_ref* a = (struct rrset_ref*)x;
+	struct rrset_ref* b = (struct rrset_ref*)y;
+	if(a->key < b->key)
+		return -1;
+	if(a->key > b->key)
+		return 1;
+	return 0;
+}
+
+/** find the glue of the nameserver in the cached glue, it is likely at
+ * the same position, since both are in the order of the NS rrset */
+static struct deleg_cache_glue*
+deleg_glue_find(struct deleg_cache_glue* glue, size_t num, size_t i,
+	struct delegpt_ns* ns)
+{
+	size_t j;
+	if(i < num && glue[i].namelen == ns->namelen &&
+		query_dname_compare(glue[i].name, ns->name) == 0)
+		return &glue[i];
+	for(j=0; j<num; j++) {
+		if(glue[j].namelen == ns->namelen &&
+			query_dname_compare(glue[j].name, ns->name) == 0)
+			return &glue[j];
+	}
+	return NULL;
+}
+
+/**
+ * Add the A and AAAA rrsets of the nameservers from the delegation cache.
+ * The rrset references are checked, and if one is out of date, nothing
+ * is added.
+ * @param env: module environment with the caches.
+ * @param qclass: the class.
+ * @param region: where to allocate.
+ * @param dp: the delegation point with the nameservers.
+ * @param now: the time now.
+ * @param msg: the referral message, or NULL.
+ * @param found: per nameserver, returns the rrsets that are added. The
+ *	nameservers that have no glue in the entry have a NULL key.
+ * @param num: number of nameservers in dp and found.
+ * @return 1 if added, 0 if not in the cache or out of date, and -1 on
+ *	malloc failure, then the dp and msg are partly filled.
+ */
+static int
+find_add_addrs_deleg(struct module_env* env, uint16_t qclass,
+	struct regional* region, struct delegpt* dp, time_t now,
+	struct dns_msg** msg, struct deleg_cache_glue* found, size_t num)
+{
+	struct deleg_cache_glue* glue, *g;
+	struct delegpt_ns* ns;
+	struct rrset_ref* refs;
+	size_t gnum = 0, nref = 0, i;
+	glue = deleg_cache_lookup(env->deleg_cache, dp->name, dp->namelen,
+		qclass, region, &gnum);
+	if(!glue)
+		return 0;
+	refs = (struct rrset_ref*)regional_alloc(region,
+		sizeof(*refs)*num*2);
+	if(!refs)
+		return 0;
+	for(i=0, ns = dp->nslist; ns && i<num; ns = ns->next, i++) {
+		if(!(g = deleg_glue_find(glue, gnum, i, ns)))
+			continue;
+		found[i].a = g->a;
+		found[i].aaaa = g->aaaa;
+		if(g->a.key)
+			refs[nref++] = g->a;
+		if(g->aaaa.key)
+			refs[nref++] = g->aaaa;
+	}
+	if(nref == 0)
+		return 1;
+	/* lock in the order of the keys, like the message cache does */
+	qsort(refs, nref, sizeof(*refs), &deleg_ref_cmp);
+	if(!rrset_array_lock(refs, nref, now)) {
+		verbose(VERB_ALGO, "delegation cache entry is out of date");
+		return 0;
+	}
+	for(i=0; i<num; i++) {
+		if(found[i].a.key) {
+			if(!delegpt_add_rrset_A(dp, region, found[i].a.key, 0,
+				NULL)) {
+				rrset_array_unlock(refs, nref);
+				return -1;
+			}
+			if(msg)
+				addr_to_additional(found[i].a.key, region,
+					*msg, now);
+		}
+		if(found[i].aaaa.key) {
+			if(!delegpt_add_rrset_AAAA(dp, region,
+				found[i].aaaa.key, 0, NULL)) {
+				rrset_array_unlock(refs, nref);
+				return -1;
+			}
+			if(msg)
+				addr_to_additional(found[i].aaaa.key, region,
+					*msg, now);
+		}
+	}
+	rrset_array_unlock_touch(env->rrset_cache, region, refs, nref);
+	log_nametypeclass(VERB_ALGO, "glue from delegation cache", dp->name,
+		LDNS_RR_TYPE_NS, qclass);
+	return 1;
+}
+
 /** find and add A and AAAA records for nameservers in delegpt */
 static int
 find_add_addrs(struct module_env* env, uint16_t qclass, 
@@ -311,16 +422,43 @@ find_add_addrs(struct module_env* env, uint16_t qclass,
 	struct delegpt_ns* ns;
 	struct msgreply_entry* neg;
 	struct ub_packed_rrset_key* akey;
-	for(ns = dp->nslist; ns; ns = ns->next) {
-		akey = rrset_cache_lookup(env->rrset_cache, ns->name, 
-			ns->namelen, LDNS_RR_TYPE_A, qclass, 0, now, 0);
-		if(akey) {
+	struct deleg_cache_glue* found = NULL;
+	size_t num = 0, i;
+	int cached = 0, changed = 0;
+	if(env->deleg_cache) {
+		for(ns = dp->nslist; ns; ns = ns->next)
+			num++;
+		if(num != 0 && (found = (struct deleg_cache_glue*)
+			regional_alloc_zero(region, sizeof(*found)*num))) {
+			cached = find_add_addrs_deleg(env, qclass, region, dp,
+				now, msg, found, num);
+			if(cached == -1)
+				return 0;
+			if(!cached)
+				memset(found, 0, sizeof(*found)*num);
+		}
+	}
+	for(i = 0, ns = dp->nslist; ns; ns = ns->next, i++) {
+		if(found) {
+			found[i].name = ns->name;
+			found[i].namelen = ns->namelen;
+		}
+		if(found && found[i].a.key) {
+			/* added from the delegation cache */
+		} else if((akey = rrset_cache_lookup(env->rrset_cache,
+			ns->name, ns->namelen, LDNS_RR_TYPE_A, qclass, 0, now,
+			0))) {
 			if(!delegpt_add_rrset_A(dp, region, akey, 0, NULL)) {
 				lock_rw_unlock(&akey->entry.lock);
 				return 0;
 			}
 			if(msg)
 				addr_to_additional(akey, region, *msg, now);
+			if(found) {
+				found[i].a.key = akey;
+				found[i].a.id = akey->id;
+				changed = 1;
+			}
 			lock_rw_unlock(&akey->entry.lock);
 		} else {
 			/* BIT_CD on false because delegpt lookup does
@@ -332,15 +470,22 @@ find_add_addrs(struct module_env* env, uint16_t qclass,
 				lock_rw_unlock(&neg->entry.lock);
 			}
 		}
-		akey = rrset_cache_lookup(env->rrset_cache, ns->name, 
-			ns->namelen, LDNS_RR_TYPE_AAAA, qclass, 0, now, 0);
-		if(akey) {
+		if(found && found[i].aaaa.key) {
+			/* added from the delegation cache */
+		} else if((akey = rrset_cache_lookup(env->rrset_cache,
+			ns->name, ns->namelen, LDNS_RR_TYPE_AAAA, qclass, 0,
+			now, 0))) {
 			if(!delegpt_add_rrset_AAAA(dp, region, akey, 0, NULL)) {
 				lock_rw_unlock(&akey->entry.lock);
 				return 0;
 			}
 			if(msg)
 				addr_to_additional(akey, region, *msg, now);
+			if(found) {
+				found[i].aaaa.key = akey;
+				found[i].aaaa.id = akey->id;
+				changed = 1;
+			}
 			lock_rw_unlock(&akey->entry.lock);
 		} else {
 			/* BIT_CD on false because delegpt lookup does
@@ -360,6 +505,10 @@ find_add_addrs(struct module_env* env, uint16_t qclass,
 			}
 		}
 	}
+	/* store the glue of the zone cut, if it is new or more was found */
+	if(found && (!cached || changed))
+		deleg_cache_insert(env->deleg_cache, dp->name, dp->namelen,
+			qclass, found, num);
 	return 1;
 }
 
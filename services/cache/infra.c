@@ -338,6 +338,7 @@ infra_create(struct config_file* cfg)
 	}
 	infra->host_ttl = cfg->host_ttl;
 	infra->infra_keep_probing = cfg->infra_keep_probing;
+	infra->latency_selection = cfg->infra_latency_selection;
 	infra_dp_ratelimit = cfg->ratelimit;
 	infra->domain_rates = slabhash_create(cfg->ratelimit_slabs,
 		INFRA_HOST_STARTSIZE, cfg->ratelimit_size,
@@ -407,6 +408,7 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 		return infra_create(cfg);
 	infra->host_ttl = cfg->host_ttl;
 	infra->infra_keep_probing = cfg->infra_keep_probing;
+	infra->latency_selection = cfg->infra_latency_selection;
 	infra_dp_ratelimit = cfg->ratelimit;
 	infra_ip_ratelimit = cfg->ip_ratelimit;
 	infra_ip_ratelimit_cookie = cfg->ip_ratelimit_cookie;
@@ -804,6 +806,11 @@ infra_get_lame_rtt(struct infra_cache* infra,
 		return 0;
 	host = (struct infra_data*)e->data;
 	*rtt = rtt_unclamped(&host->rtt);
+	if(infra->latency_selection && rtt_p50(&host->rtt) != -1 &&
+		host->rtt.rto == rtt_notimeout(&host->rtt)) {
+		/* no backoff from timeouts, select on the median */
+		*rtt = rtt_p50(&host->rtt);
+	}
 	if(host->rtt.rto >= PROBE_MAXRTO && timenow >= host->probedelay
 		&& infra->infra_keep_probing) {
 		/* single probe, keep probing */
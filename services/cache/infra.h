@@ -116,6 +116,9 @@ struct infra_cache {
 	int host_ttl;
 	/** the hosts that are down are kept probed for recovery */
 	int infra_keep_probing;
+	/** servers are selected by their median reply time, the median
+	 * is used for the rtt in server selection when it is known */
+	int latency_selection;
 	/** hash table with query rates per name: rate_key, rate_data */
 	struct slabhash* domain_rates;
 	/** ratelimit settings for domains, struct domain_limit_data */
@@ -351,6 +354,8 @@ int infra_edns_update(struct infra_cache* infra,
  * @param reclame: if function returns true, this is if it is recursion lame.
  * @param rtt: if function returns true, this returns avg rtt of the server.
  * 	The rtt value is unclamped and reflects recent timeouts.
+ * 	With latency selection, it is the median reply time of the server,
+ * 	if that is known and there are no recent timeouts.
  * @param timenow: what time it is now.
  * @return if found in cache, or false if not (or TTL bad).
  */
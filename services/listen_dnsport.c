@@ -104,6 +104,9 @@
 #ifdef HAVE_LINUX_NET_TSTAMP_H
 #include <linux/net_tstamp.h>
 #endif
+#ifdef HAVE_LINUX_FILTER_H
+#include <linux/filter.h>
+#endif
 
 /** number of queued TCP connections for listen() */
 #define TCP_BACKLOG 256
@@ -2073,6 +2076,56 @@ void listening_ports_free(struct listen_port* list)
 	}
 }
 
+int listening_ports_doq_steer(struct listen_port* list, int num)
+{
+#if defined(HAVE_NGTCP2) && defined(HAVE_LINUX_FILTER_H) && defined(SO_ATTACH_REUSEPORT_CBPF)
+	/* The program runs on the UDP payload, the QUIC packet. The long
+	 * header has the dcid after the flags, version and dcid length.
+	 * The short header has it after the flags. The socket index in the
+	 * reuseport group is the thread number, the order in which the
+	 * threads opened the ports. For the client chosen dcid in the
+	 * initial packet, this picks one at random. */
+	struct sock_filter code[] = {
+		/* A = flags byte */
+		BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 0),
+		/* long header form bit */
+		BPF_JUMP(BPF_JMP | BPF_JSET | BPF_K, 0x80, 0, 2),
+		BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 6),
+		BPF_JUMP(BPF_JMP | BPF_JA, 1, 0, 0),
+		BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 1),
+		BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, (uint32_t)num),
+		BPF_STMT(BPF_RET | BPF_A, 0)
+	};
+	struct sock_fprog prog;
+	int have_doq = 0;
+	if(num <= 1 || num > 256)
+		return 0;
+	memset(&prog, 0, sizeof(prog));
+	prog.len = (unsigned short)(sizeof(code)/sizeof(code[0]));
+	prog.filter = code;
+	for(; list; list = list->next) {
+		if(list->ftype != listen_type_doq)
+			continue;
+		if(setsockopt(list->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+			(void*)&prog, (socklen_t)sizeof(prog)) < 0) {
+			log_warn("setsockopt(.. SO_ATTACH_REUSEPORT_CBPF ..) "
+				"failed: %s, doq connections are not steered "
+				"to their thread", sock_strerror(errno));
+			return 0;
+		}
+		have_doq = 1;
+	}
+	if(have_doq)
+		verbose(VERB_ALGO, "doq packets are steered to %d threads "
+			"by connection id", num);
+	return have_doq;
+#else
+	(void)list;
+	(void)num;
+	return 0;
+#endif
+}
+
 size_t listen_get_mem(struct listen_dnsport* listen)
 {
 	struct listen_list* p;
@@ -2511,11 +2564,56 @@ size_t http2_get_response_buffer_size(void)
 }
 
 #ifdef HAVE_NGHTTP2
-/** nghttp2 callback. Used to copy response from rbuffer to nghttp2 session */
+int http2_session_wbuf_create(struct http2_session* h2_session)
+{
+	if(h2_session->wbuf)
+		return 1;
+	lock_basic_lock(&http2_response_buffer_count_lock);
+	if(http2_response_buffer_count + HTTP2_WRITE_BUFFER_SIZE >
+		http2_response_buffer_max) {
+		lock_basic_unlock(&http2_response_buffer_count_lock);
+		verbose(VERB_ALGO, "http2: no write buffer, no space left "
+			"in https-response-buffer-size");
+		return 0;
+	}
+	http2_response_buffer_count += HTTP2_WRITE_BUFFER_SIZE;
+	lock_basic_unlock(&http2_response_buffer_count_lock);
+
+	if(!(h2_session->wbuf = sldns_buffer_new(HTTP2_WRITE_BUFFER_SIZE))) {
+		lock_basic_lock(&http2_response_buffer_count_lock);
+		http2_response_buffer_count -= HTTP2_WRITE_BUFFER_SIZE;
+		lock_basic_unlock(&http2_response_buffer_count_lock);
+		log_err("http2: malloc failure for the write buffer");
+		return 0;
+	}
+	h2_session->wbuf_sent = 0;
+	h2_session->wbuf_blocked = 0;
+	return 1;
+}
+
+void http2_session_wbuf_delete(struct http2_session* h2_session)
+{
+	if(!h2_session->wbuf)
+		return;
+	lock_basic_lock(&http2_response_buffer_count_lock);
+	http2_response_buffer_count -=
+		sldns_buffer_capacity(h2_session->wbuf);
+	lock_basic_unlock(&http2_response_buffer_count_lock);
+	sldns_buffer_free(h2_session->wbuf);
+	h2_session->wbuf = NULL;
+	h2_session->wbuf_sent = 0;
+	h2_session->wbuf_blocked = 0;
+}
+
+/** nghttp2 callback. Used to tell the length of the DATA frame with the
+ * response in rbuffer. With a session write buffer, the data is not copied
+ * to the nghttp2 session but written by http2_send_data_cb, if there is no
+ * space for the write buffer it is copied to nghttp2 */
 static ssize_t http2_submit_response_read_callback(
 	nghttp2_session* ATTR_UNUSED(session),
-	int32_t stream_id, uint8_t* buf, size_t length, uint32_t* data_flags,
-	nghttp2_data_source* source, void* ATTR_UNUSED(cb_arg))
+	int32_t stream_id, uint8_t* buf, size_t length,
+	uint32_t* data_flags, nghttp2_data_source* source,
+	void* ATTR_UNUSED(cb_arg))
 {
 	struct http2_stream* h2_stream;
 	struct http2_session* h2_session = source->ptr;
@@ -2539,6 +2637,13 @@ static ssize_t http2_submit_response_read_callback(
 	if(copylen > SSIZE_MAX)
 		copylen = SSIZE_MAX; /* will probably never happen */
 
+	if(http2_session_wbuf_create(h2_session)) {
+		*data_flags |= NGHTTP2_DATA_FLAG_NO_COPY;
+		if(copylen == sldns_buffer_remaining(h2_stream->rbuffer))
+			*data_flags |= NGHTTP2_DATA_FLAG_EOF;
+		return copylen;
+	}
+
 	memcpy(buf, sldns_buffer_current(h2_stream->rbuffer), copylen);
 	sldns_buffer_skip(h2_stream->rbuffer, copylen);
 
@@ -2555,6 +2660,53 @@ static ssize_t http2_submit_response_read_callback(
 	return copylen;
 }
 
+/** nghttp2 callback. Write the DATA frame with the response from rbuffer
+ * into the session write buffer, without a copy to nghttp2 first. */
+static int http2_send_data_cb(nghttp2_session* ATTR_UNUSED(session),
+	nghttp2_frame* frame, const uint8_t* framehd, size_t length,
+	nghttp2_data_source* ATTR_UNUSED(source), void* cb_arg)
+{
+	struct http2_session* h2_session = (struct http2_session*)cb_arg;
+	struct http2_stream* h2_stream;
+	size_t padlen = frame->data.padlen;
+	int r;
+	if(!(h2_stream = nghttp2_session_get_stream_user_data(
+		h2_session->session, frame->hd.stream_id)) ||
+		!h2_stream->rbuffer ||
+		sldns_buffer_remaining(h2_stream->rbuffer) < length) {
+		verbose(VERB_QUERY, "http2: cannot send data, no response "
+			"in rbuffer");
+		return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+	}
+	/* the frame header, pad length, data and padding */
+	r = http2_write_reserve(h2_session, 9 + length + padlen);
+	if(r == 0)
+		return NGHTTP2_ERR_WOULDBLOCK;
+	else if(r < 0)
+		return NGHTTP2_ERR_CALLBACK_FAILURE;
+
+	sldns_buffer_write(h2_session->wbuf, framehd, 9);
+	if(padlen > 0)
+		sldns_buffer_write_u8(h2_session->wbuf, (uint8_t)(padlen-1));
+	sldns_buffer_write(h2_session->wbuf,
+		sldns_buffer_current(h2_stream->rbuffer), length);
+	sldns_buffer_skip(h2_stream->rbuffer, (ssize_t)length);
+	if(padlen > 1) {
+		memset(sldns_buffer_current(h2_session->wbuf), 0, padlen-1);
+		sldns_buffer_skip(h2_session->wbuf, (ssize_t)(padlen-1));
+	}
+
+	if(sldns_buffer_remaining(h2_stream->rbuffer) == 0) {
+		lock_basic_lock(&http2_response_buffer_count_lock);
+		http2_response_buffer_count -=
+			sldns_buffer_capacity(h2_stream->rbuffer);
+		lock_basic_unlock(&http2_response_buffer_count_lock);
+		sldns_buffer_free(h2_stream->rbuffer);
+		h2_stream->rbuffer = NULL;
+	}
+	return 0;
+}
+
 /**
  * Send RST_STREAM frame for stream.
  * @param h2_session: http2 session to submit frame to
@@ -3249,6 +3401,8 @@ nghttp2_session_callbacks* http2_req_callbacks_create(void)
 	/* generic HTTP2 callbacks */
 	nghttp2_session_callbacks_set_recv_callback(callbacks, http2_recv_cb);
 	nghttp2_session_callbacks_set_send_callback(callbacks, http2_send_cb);
+	nghttp2_session_callbacks_set_send_data_callback(callbacks,
+		http2_send_data_cb);
 	nghttp2_session_callbacks_set_on_stream_close_callback(callbacks,
 		http2_stream_close_cb);
 
@@ -3258,11 +3412,14 @@ nghttp2_session_callbacks* http2_req_callbacks_create(void)
 
 #ifdef HAVE_NGTCP2
 struct doq_table*
-doq_table_create(struct config_file* cfg, struct ub_randstate* rnd)
+doq_table_create(struct config_file* cfg, struct ub_randstate* rnd,
+	int owner, int num_tables)
 {
 	struct doq_table* table = calloc(1, sizeof(*table));
 	if(!table)
 		return NULL;
+	table->owner = owner;
+	table->num_tables = (num_tables>0?num_tables:1);
 	table->idle_timeout = ((uint64_t)cfg->tcp_idle_timeout)*
 		NGTCP2_MILLISECONDS;
 	table->sv_scidlen = 16;
@@ -4158,6 +4315,8 @@ doq_conn_generate_new_conid(struct doq_conn* conn, uint8_t* data,
 	int i;
 	for(i=0; i<max_try; i++) {
 		doq_fill_rand(conn->doq_socket->rnd, data, datalen);
+		if(conn->table->owner != -1 && datalen > 0)
+			data[0] = (uint8_t)conn->table->owner;
 		if(!doq_conid_find(conn->table, data, datalen)) {
 			/* Found an unused connection id. */
 			return 1;
@@ -5279,6 +5438,20 @@ doq_stream_write_is_done(struct doq_conn* conn, struct doq_stream* stream)
 	doq_stream_off_write_list(conn, stream);
 }
 
+/** send the batch of packets in the gso_buf, they are gso_size long,
+ * except for the last one, that can be shorter. */
+static void
+doq_conn_send_batch(struct comm_point* c, struct doq_conn* conn,
+	uint32_t ecn, size_t gso_size)
+{
+	struct sldns_buffer* buf = c->doq_socket->gso_buf;
+	if(sldns_buffer_position(buf) == 0)
+		return;
+	sldns_buffer_flip(buf);
+	doq_send_pkts(c, &conn->key.paddr, ecn, buf, gso_size);
+	sldns_buffer_clear(buf);
+}
+
 int
 doq_conn_write_streams(struct comm_point* c, struct doq_conn* conn,
 	int* err_drop)
@@ -5287,7 +5460,13 @@ doq_conn_write_streams(struct comm_point* c, struct doq_conn* conn,
 	ngtcp2_path_storage ps;
 	ngtcp2_tstamp ts = doq_get_timestamp_nanosec();
 	size_t num_packets = 0, max_packets = 65535;
+	/* the packets are collected in the gso_buf and sent together,
+	 * with segmentation offload if available. */
+	struct sldns_buffer* gso_buf = c->doq_socket->gso_buf;
+	size_t gso_size = 0, gso_num = 0;
+	uint32_t gso_ecn = 0;
 	ngtcp2_path_storage_zero(&ps);
+	sldns_buffer_clear(gso_buf);
 
 	for(;;) {
 		int64_t stream_id;
@@ -5334,10 +5513,9 @@ doq_conn_write_streams(struct comm_point* c, struct doq_conn* conn,
 		if(fin)
 			flags |= NGTCP2_WRITE_STREAM_FLAG_FIN;
 
-		sldns_buffer_clear(c->doq_socket->pkt_buf);
 		ret = ngtcp2_conn_writev_stream(conn->conn, &ps.path, &pi,
-			sldns_buffer_begin(c->doq_socket->pkt_buf),
-			sldns_buffer_remaining(c->doq_socket->pkt_buf),
+			sldns_buffer_current(gso_buf),
+			sldns_buffer_capacity(c->doq_socket->pkt_buf),
 			&ndatalen, flags, stream_id, datav, datav_count, ts);
 		if(ret < 0) {
 			if(ret == NGTCP2_ERR_WRITE_MORE) {
@@ -5351,7 +5529,10 @@ doq_conn_write_streams(struct comm_point* c, struct doq_conn* conn,
 					stream = stream->write_next;
 				}
 				continue;
-			} else if(ret == NGTCP2_ERR_STREAM_DATA_BLOCKED) {
+			}
+			/* the packets before the close go out first */
+			doq_conn_send_batch(c, conn, gso_ecn, gso_size);
+			if(ret == NGTCP2_ERR_STREAM_DATA_BLOCKED) {
 				verbose(VERB_ALGO, "doq: ngtcp2_conn_writev_stream returned NGTCP2_ERR_STREAM_DATA_BLOCKED");
 #ifdef HAVE_NGTCP2_CCERR_DEFAULT
 				ngtcp2_ccerr_set_application_error(
@@ -5409,13 +5590,43 @@ doq_conn_write_streams(struct comm_point* c, struct doq_conn* conn,
 		}
 		if(ret == 0) {
 			/* congestion limited */
+			doq_conn_send_batch(c, conn, gso_ecn, gso_size);
 			doq_conn_write_disable(conn);
 			ngtcp2_conn_update_pkt_tx_time(conn->conn, ts);
 			return 1;
 		}
-		sldns_buffer_set_position(c->doq_socket->pkt_buf, ret);
-		sldns_buffer_flip(c->doq_socket->pkt_buf);
-		doq_send_pkt(c, &conn->key.paddr, pi.ecn);
+		if(gso_num != 0 && ((size_t)ret > gso_size ||
+			(uint32_t)pi.ecn != gso_ecn)) {
+			/* The packet cannot be a segment of this batch, send
+			 * the batch and start a new one with the packet. */
+			uint8_t* pkt = sldns_buffer_current(gso_buf);
+			doq_conn_send_batch(c, conn, gso_ecn, gso_size);
+			gso_num = 0;
+			if(c->doq_socket->have_blocked_pkt) {
+				/* The packet is kept, to go out after the
+				 * blocked batch. The gso_buf is cleared
+				 * by the send, but the data is not
+				 * overwritten. */
+				doq_store_blocked_next(c, (uint32_t)pi.ecn,
+					pkt, (size_t)ret);
+				break;
+			}
+			memmove(sldns_buffer_begin(gso_buf), pkt, (size_t)ret);
+		}
+		if(gso_num == 0) {
+			gso_size = (size_t)ret;
+			gso_ecn = (uint32_t)pi.ecn;
+		}
+		sldns_buffer_skip(gso_buf, (ssize_t)ret);
+		gso_num++;
+		/* A shorter packet is the last segment. Send when full, or
+		 * when the socket has no segmentation offload. */
+		if((size_t)ret < gso_size || gso_num >= DOQ_GSO_MAX_SEGMENTS
+			|| !c->doq_socket->gso || sldns_buffer_remaining(gso_buf)
+			< sldns_buffer_capacity(c->doq_socket->pkt_buf)) {
+			doq_conn_send_batch(c, conn, gso_ecn, gso_size);
+			gso_num = 0;
+		}
 
 		if(c->doq_socket->have_blocked_pkt)
 			break;
@@ -5424,6 +5635,7 @@ doq_conn_write_streams(struct comm_point* c, struct doq_conn* conn,
 		if(stream)
 			stream = stream->write_next;
 	}
+	doq_conn_send_batch(c, conn, gso_ecn, gso_size);
 	ngtcp2_conn_update_pkt_tx_time(conn->conn, ts);
 	return 1;
 }
@@ -5604,7 +5816,8 @@ doq_table_quic_size_available(struct doq_table* table,
 	cur = table->current_size;
 	lock_basic_unlock(&table->size_lock);
 
-	if(cur + mem > cfg->quic_size)
+	/* the per worker tables each have their part of the memory */
+	if(cur + mem > cfg->quic_size / (size_t)table->num_tables)
 		return 0;
 	return 1;
 }
@@ -166,6 +166,16 @@ struct listen_port* listening_ports_open(struct config_file* cfg,
  */
 void listening_ports_free(struct listen_port* list);
 
+/**
+ * Attach the packet steering program to the reuseport groups of the doq
+ * ports. It picks the socket from the first byte of the destination
+ * connection id, that is the worker number in the server connection ids.
+ * @param list: the ports of the first thread.
+ * @param num: number of sockets in the reuseport groups, one per thread.
+ * @return false if not possible, and the packets are not steered.
+ */
+int listening_ports_doq_steer(struct listen_port* list, int num);
+
 struct config_strlist;
 /**
  * Resolve interface names in config and store result IP addresses
@@ -455,6 +465,19 @@ nghttp2_session_callbacks* http2_req_callbacks_create(void);
 /** Free http2 stream buffers and decrease buffer counters */
 void http2_req_stream_clear(struct http2_stream* h2_stream);
 
+/**
+ * Allocate the write buffer of the http2 session, if it has none. It is
+ * counted in the https-response-buffer-size.
+ * @param h2_session: http2 session.
+ * @return 0 if there is no space left or on malloc failure, 1 if the
+ *	session has a write buffer.
+ */
+int http2_session_wbuf_create(struct http2_session* h2_session);
+
+/** Free the write buffer of the http2 session, if any, and decrease the
+ * buffer counter */
+void http2_session_wbuf_delete(struct http2_session* h2_session);
+
 /**
  * DNS response ready to be submitted to nghttp2, to be prepared for sending
  * out. Response is stored in c->buffer. Copy to rbuffer because the c->buffer
@@ -510,11 +533,25 @@ struct doq_table {
 	 * The doq_conn ngtcp2_conn structure, SSL structure and conid structs
 	 * are not counted. */
 	size_t current_size;
+	/** the worker that owns the table, its number is the first byte
+	 * of the server connection ids, so that the packets are steered
+	 * to it. -1 if the table is shared by the workers. */
+	int owner;
+	/** number of tables that share the quic-size memory limit */
+	int num_tables;
 };
 
-/** create doq table */
+/**
+ * Create doq table.
+ * @param cfg: config, for the idle timeout.
+ * @param rnd: random state for the static secret.
+ * @param owner: the worker number if the table is for one worker,
+ *	or -1 if it is shared by the workers.
+ * @param num_tables: number of tables that divide the quic-size.
+ * @return new table or NULL on alloc failure.
+ */
 struct doq_table* doq_table_create(struct config_file* cfg,
-	struct ub_randstate* rnd);
+	struct ub_randstate* rnd, int owner, int num_tables);
 
 /** delete doq table */
 void doq_table_delete(struct doq_table* table);
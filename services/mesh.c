@@ -54,6 +54,7 @@
 #include "util/regional.h"
 #include "util/data/msgencode.h"
 #include "util/timehist.h"
+#include "util/storage/lookup3.h"
 #include "util/fptr_wlist.h"
 #include "util/alloc.h"
 #include "util/config_file.h"
@@ -187,6 +188,134 @@ mesh_state_ref_compare(const void* ap, const void* bp)
 	return mesh_state_compare(a->s, b->s);
 }
 
+int
+mesh_client_compare(const void* ap, const void* bp)
+{
+	struct mesh_client* a = (struct mesh_client*)ap;
+	struct mesh_client* b = (struct mesh_client*)bp;
+	return sockaddr_cmp_addr(&a->addr, a->addrlen, &b->addr, b->addrlen);
+}
+
+/** hash value of the mesh state, for the fields that mesh_state_compare
+ * uses, apart from the client info and unique pointer. */
+static hashvalue_type
+mesh_state_hash(struct mesh_state* m)
+{
+	uint8_t bits = (m->s.is_priming?1:0) | (m->s.is_valrec?2:0) |
+		((m->s.query_flags&BIT_RD)?4:0) |
+		((m->s.query_flags&BIT_CD)?8:0);
+	return hashlittle(&bits, sizeof(bits),
+		query_info_hash(&m->s.qinfo, m->s.query_flags));
+}
+
+/** double the number of bins in the mesh hash index */
+static void
+mesh_hash_grow(struct mesh_area* mesh)
+{
+	size_t i, newsize = mesh->hash_size*2;
+	struct mesh_state** bins = (struct mesh_state**)calloc(newsize,
+		sizeof(struct mesh_state*));
+	struct mesh_state* m, *nm;
+	if(!bins)
+		return; /* continue with longer bins */
+	for(i=0; i<mesh->hash_size; i++) {
+		for(m = mesh->hash_bins[i]; m; m = nm) {
+			nm = m->hash_next;
+			m->hash_next = bins[m->hash & (newsize-1)];
+			bins[m->hash & (newsize-1)] = m;
+		}
+	}
+	free(mesh->hash_bins);
+	mesh->hash_bins = bins;
+	mesh->hash_size = newsize;
+}
+
+/** insert the state in the all list, and the hash index */
+static void
+mesh_all_insert(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct mesh_state** bin;
+	m->all_prev = NULL;
+	m->all_next = mesh->all_first;
+	if(mesh->all_first)
+		mesh->all_first->all_prev = m;
+	mesh->all_first = m;
+	mesh->all_count++;
+	if(mesh->all_count > mesh->hash_size*2)
+		mesh_hash_grow(mesh);
+	m->hash = mesh_state_hash(m);
+	bin = &mesh->hash_bins[m->hash & (mesh->hash_size-1)];
+	m->hash_next = *bin;
+	*bin = m;
+}
+
+/** remove the state from the all list and the hash index, if it is in */
+static void
+mesh_all_remove(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct mesh_state** p;
+	if(!m->all_prev && mesh->all_first != m)
+		return;
+	if(m->all_prev)
+		m->all_prev->all_next = m->all_next;
+	else	mesh->all_first = m->all_next;
+	if(m->all_next)
+		m->all_next->all_prev = m->all_prev;
+	m->all_prev = NULL;
+	m->all_next = NULL;
+	log_assert(mesh->all_count > 0);
+	mesh->all_count--;
+	for(p = &mesh->hash_bins[m->hash & (mesh->hash_size-1)]; *p;
+		p = &(*p)->hash_next) {
+		if(*p == m) {
+			*p = m->hash_next;
+			m->hash_next = NULL;
+			return;
+		}
+	}
+}
+
+/** delete a fair weight or mesh client tree node */
+static void
+mesh_fair_delfunc(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	free(n);
+}
+
+/** setup the fair-share weights tree from the config, false on failure */
+static int
+mesh_fair_weights_setup(struct mesh_area* mesh, struct config_file* cfg)
+{
+	struct config_str2list* p;
+	for(p = cfg->fair_share_weight; p; p = p->next) {
+		struct sockaddr_storage addr;
+		socklen_t addrlen;
+		int net;
+		struct mesh_fair_weight* w;
+		if(!netblockstrtoaddr(p->str, 0, &addr, &addrlen, &net)) {
+			log_err("cannot parse fair-share-weight netblock '%s'",
+				p->str);
+			return 0;
+		}
+		w = (struct mesh_fair_weight*)calloc(1, sizeof(*w));
+		if(!w) {
+			log_err("mesh fair-share-weight: out of memory");
+			return 0;
+		}
+		w->weight = atoi(p->str2);
+		if(w->weight < 1)
+			w->weight = 1;
+		if(!addr_tree_insert(&mesh->fair_weights, &w->node, &addr,
+			addrlen, net)) {
+			verbose(VERB_QUERY, "duplicate fair-share-weight "
+				"netblock %s, ignored", p->str);
+			free(w);
+		}
+	}
+	addr_tree_init_parents(&mesh->fair_weights);
+	return 1;
+}
+
 struct mesh_area*
 mesh_create(struct module_stack* stack, struct module_env* env)
 {
@@ -197,7 +326,18 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	}
 	mesh->histogram = timehist_setup();
 	mesh->qbuf_bak = sldns_buffer_new(env->cfg->msg_buffer_size);
-	if(!mesh->histogram || !mesh->qbuf_bak) {
+	mesh->hash_size = MESH_HASH_START;
+	mesh->hash_bins = (struct mesh_state**)calloc(mesh->hash_size,
+		sizeof(struct mesh_state*));
+	if(env->cfg->stat_latency)
+		mesh->latency = (struct latency_client*)calloc(1,
+			sizeof(struct latency_client));
+	if(!mesh->histogram || !mesh->qbuf_bak || !mesh->hash_bins ||
+		(env->cfg->stat_latency && !mesh->latency)) {
+		timehist_delete(mesh->histogram);
+		sldns_buffer_free(mesh->qbuf_bak);
+		free(mesh->hash_bins);
+		free(mesh->latency);
 		free(mesh);
 		log_err("mesh area alloc: out of memory");
 		return NULL;
@@ -205,7 +345,15 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	mesh->mods = *stack;
 	mesh->env = env;
 	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	mesh->all_first = NULL;
+	mesh->all_count = 0;
+	rbtree_init(&mesh->clients, &mesh_client_compare);
+	addr_tree_init(&mesh->fair_weights);
+	mesh->fair_share = env->cfg->fair_share;
+	if(mesh->fair_share && !mesh_fair_weights_setup(mesh, env->cfg)) {
+		mesh_delete(mesh);
+		return NULL;
+	}
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -226,15 +374,14 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 
 /** help mesh delete delete mesh states */
 static void
-mesh_delete_helper(rbnode_type* n)
+mesh_delete_helper(struct mesh_state* mstate)
 {
-	struct mesh_state* mstate = (struct mesh_state*)n->key;
 	/* perform a full delete, not only 'cleanup' routine,
 	 * because other callbacks expect a clean state in the mesh.
 	 * For 're-entrant' calls */
 	mesh_state_delete(&mstate->s);
-	/* but because these delete the items from the tree, postorder
-	 * traversal and rbtree rebalancing do not work together */
+	/* but because these delete other items from the list, take
+	 * the first one again */
 }
 
 void
@@ -243,10 +390,19 @@ mesh_delete(struct mesh_area* mesh)
 	if(!mesh)
 		return;
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	while(mesh->all_first)
+		mesh_delete_helper(mesh->all_first);
 	timehist_delete(mesh->histogram);
 	sldns_buffer_free(mesh->qbuf_bak);
+	free(mesh->latency);
+	free(mesh->hash_bins);
+	traverse_postorder(&mesh->clients, &mesh_fair_delfunc, NULL);
+	traverse_postorder(&mesh->fair_weights, &mesh_fair_delfunc, NULL);
+	while(mesh->pool) {
+		struct mesh_state* m = mesh->pool;
+		mesh->pool = m->next;
+		regional_destroy(m->s.region);
+	}
 	free(mesh);
 }
 
@@ -254,12 +410,17 @@ void
 mesh_delete_all(struct mesh_area* mesh)
 {
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	while(mesh->all_first)
+		mesh_delete_helper(mesh->all_first);
 	mesh->stats_dropped += mesh->num_reply_addrs;
 	/* clear mesh area references */
 	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	mesh->all_first = NULL;
+	mesh->all_count = 0;
+	memset(mesh->hash_bins, 0, sizeof(struct mesh_state*)*mesh->hash_size);
+	traverse_postorder(&mesh->clients, &mesh_fair_delfunc, NULL);
+	rbtree_init(&mesh->clients, &mesh_client_compare);
+	mesh->clients_weight = 0;
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -270,6 +431,27 @@ mesh_delete_all(struct mesh_area* mesh)
 	mesh->jostle_last = NULL;
 }
 
+/** jostle out the query state to make space for a new one */
+static void
+mesh_jostle_state(struct mesh_area* mesh, struct mesh_state* m,
+	sldns_buffer* qbuf)
+{
+	/* backup the query */
+	if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
+	/* notify supers */
+	if(m->super_set.count > 0) {
+		verbose(VERB_ALGO, "notify supers of failure");
+		m->s.return_msg = NULL;
+		m->s.return_rcode = LDNS_RCODE_SERVFAIL;
+		mesh_walk_supers(mesh, m);
+	}
+	mesh->stats_jostled ++;
+	mesh_state_delete(&m->s);
+	/* restore the query - note that the qinfo ptr to
+	 * the querybuffer is then correct again. */
+	if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+}
+
 int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 {
 	struct mesh_state* m = mesh->jostle_first;
@@ -288,20 +470,7 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 				"make space for a new one",
 				m->s.qinfo.qname, m->s.qinfo.qtype,
 				m->s.qinfo.qclass);
-			/* backup the query */
-			if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
-			/* notify supers */
-			if(m->super_set.count > 0) {
-				verbose(VERB_ALGO, "notify supers of failure");
-				m->s.return_msg = NULL;
-				m->s.return_rcode = LDNS_RCODE_SERVFAIL;
-				mesh_walk_supers(mesh, m);
-			}
-			mesh->stats_jostled ++;
-			mesh_state_delete(&m->s);
-			/* restore the query - note that the qinfo ptr to
-			 * the querybuffer is then correct again. */
-			if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+			mesh_jostle_state(mesh, m, qbuf);
 			return 1;
 		}
 	}
@@ -309,6 +478,150 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 	return 0;
 }
 
+/** the fair-share weight of the client address */
+static int
+mesh_fair_weight(struct mesh_area* mesh, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	struct mesh_fair_weight* w = (struct mesh_fair_weight*)
+		addr_tree_lookup(&mesh->fair_weights, addr, addrlen);
+	if(w)
+		return w->weight;
+	return 1;
+}
+
+/** find the mesh client for the reply address, or NULL */
+static struct mesh_client*
+mesh_client_find(struct mesh_area* mesh, struct comm_reply* rep)
+{
+	struct mesh_client key;
+	if(rep->client_addrlen > (socklen_t)sizeof(key.addr))
+		return NULL;
+	memcpy(&key.addr, &rep->client_addr, rep->client_addrlen);
+	key.addrlen = rep->client_addrlen;
+	key.node.key = &key;
+	return (struct mesh_client*)rbtree_search(&mesh->clients, &key);
+}
+
+/**
+ * The share of the requestlist for a client with the weight.
+ * @param mesh: the mesh area.
+ * @param weight: weight of the client.
+ * @param extra: weight to add to the total, of a client that is not in
+ *	the clients tree yet.
+ * @return the number of replies the client can have waiting.
+ */
+static size_t
+mesh_fair_share(struct mesh_area* mesh, int weight, int extra)
+{
+	size_t total = mesh->clients_weight + (size_t)extra;
+	size_t share;
+	if(total == 0)
+		return mesh->max_reply_states;
+	share = mesh->max_reply_states*(size_t)weight/total;
+	if(share < 1)
+		share = 1;
+	return share;
+}
+
+/** see if a new query from the client fits in its fair share. Once half
+ * the requestlist is in use, the client can use its share of it. */
+static int
+mesh_fair_allowed(struct mesh_area* mesh, struct comm_reply* rep)
+{
+	struct mesh_client* c;
+	if(mesh->num_reply_states < mesh->max_reply_states/2)
+		return 1;
+	c = mesh_client_find(mesh, rep);
+	if(!c)
+		return 1;
+	return c->num < mesh_fair_share(mesh, c->weight, 0);
+}
+
+/** make space for a new query, of a client within its share, by jostling
+ * out the oldest query of a client that is over its share. Only looks at
+ * query states with one reply, and no callbacks. */
+static int
+mesh_fair_make_space(struct mesh_area* mesh, struct comm_reply* rep,
+	sldns_buffer* qbuf)
+{
+	struct mesh_state* lists[2];
+	struct mesh_state* m;
+	int i, n = 0, extra = 0;
+	if(!mesh_client_find(mesh, rep))
+		extra = mesh_fair_weight(mesh, &rep->client_addr,
+			rep->client_addrlen);
+	lists[0] = mesh->jostle_first;
+	lists[1] = mesh->forever_first;
+	for(i=0; i<2; i++) {
+		for(m = lists[i]; m && n < MESH_FAIR_SCAN; m = m->next, n++) {
+			struct mesh_client* c;
+			if(!m->reply_list || m->reply_list->next || m->cb_list)
+				continue;
+			c = mesh_client_find(mesh, &m->reply_list->query_reply);
+			if(!c || c->num <= mesh_fair_share(mesh, c->weight,
+				extra))
+				continue;
+			log_nametypeclass(VERB_ALGO, "query of a client over "
+				"its fair share jostled out to make space for "
+				"a new one", m->s.qinfo.qname, m->s.qinfo.qtype,
+				m->s.qinfo.qclass);
+			mesh_jostle_state(mesh, m, qbuf);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/** account a reply that waits in the mesh, for the wait limit and for
+ * the fair share of the client */
+static void
+mesh_reply_wait_inc(struct mesh_area* mesh, struct comm_reply* rep)
+{
+	struct mesh_client* c;
+	infra_wait_limit_inc(mesh->env->infra_cache, rep, *mesh->env->now,
+		mesh->env->cfg);
+	if(!mesh->fair_share)
+		return;
+	c = mesh_client_find(mesh, rep);
+	if(!c) {
+		if(rep->client_addrlen > (socklen_t)sizeof(c->addr))
+			return;
+		c = (struct mesh_client*)calloc(1, sizeof(*c));
+		if(!c) {
+			log_err("mesh fair-share client: out of memory");
+			return;
+		}
+		memcpy(&c->addr, &rep->client_addr, rep->client_addrlen);
+		c->addrlen = rep->client_addrlen;
+		c->node.key = c;
+		c->weight = mesh_fair_weight(mesh, &c->addr, c->addrlen);
+		(void)rbtree_insert(&mesh->clients, &c->node);
+		mesh->clients_weight += (size_t)c->weight;
+	}
+	c->num++;
+}
+
+/** a reply no longer waits in the mesh, remove it from the accounting */
+static void
+mesh_reply_wait_dec(struct mesh_area* mesh, struct comm_reply* rep)
+{
+	struct mesh_client* c;
+	infra_wait_limit_dec(mesh->env->infra_cache, rep, mesh->env->cfg);
+	if(!mesh->fair_share)
+		return;
+	c = mesh_client_find(mesh, rep);
+	if(!c)
+		return;
+	if(c->num > 0)
+		c->num--;
+	if(c->num == 0) {
+		(void)rbtree_delete(&mesh->clients, c);
+		mesh->clients_weight -= (size_t)c->weight;
+		free(c);
+	}
+}
+
 struct dns_msg*
 mesh_serve_expired_lookup(struct module_qstate* qstate,
 	struct query_info* lookup_qinfo, int* is_expired)
@@ -431,7 +744,16 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 		s = mesh_area_find(mesh, cinfo, qinfo, mesh_flags, 0, 0);
 	/* does this create a new reply state? */
 	if(!s || s->list_select == mesh_no_list) {
-		if(!mesh_make_new_space(mesh, rep->c->buffer)) {
+		if(mesh->fair_share && !mesh_fair_allowed(mesh, rep)) {
+			verbose(VERB_ALGO, "Client is over its fair share of "
+				"the requestlist. dropping incoming query.");
+			comm_point_drop_reply(rep);
+			mesh->stats_dropped++;
+			return;
+		}
+		if(!mesh_make_new_space(mesh, rep->c->buffer) &&
+			!(mesh->fair_share && mesh_fair_make_space(mesh, rep,
+			rep->c->buffer))) {
 			verbose(VERB_ALGO, "Too many queries. dropping "
 				"incoming query.");
 			comm_point_drop_reply(rep);
@@ -452,9 +774,6 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	}
 	/* see if it already exists, if not, create one */
 	if(!s) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		s = mesh_state_create(mesh->env, qinfo, cinfo,
 			mesh_flags, 0, 0);
 		if(!s) {
@@ -489,13 +808,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			}
 		}
 
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &s->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, s);
 		added = 1;
 	}
 	if(!s->reply_list && !s->cb_list) {
@@ -534,8 +847,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 		}
 	}
 #endif
-	infra_wait_limit_inc(mesh->env->infra_cache, rep, *mesh->env->now,
-		mesh->env->cfg);
+	mesh_reply_wait_inc(mesh, rep);
 	/* update statistics */
 	if(was_detached) {
 		log_assert(mesh->num_detached_states > 0);
@@ -596,9 +908,6 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 
 	/* see if it already exists, if not, create one */
 	if(!s) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		s = mesh_state_create(mesh->env, qinfo, NULL,
 			mesh_flags, 0, 0);
 		if(!s) {
@@ -617,13 +926,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 				return 0;
 			}
 		}
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &s->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, s);
 		added = 1;
 	}
 	if(!s->reply_list && !s->cb_list) {
@@ -709,13 +1012,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 		log_err("prefetch mesh_state_create: out of memory");
 		return;
 	}
-#ifdef UNBOUND_DEBUG
-	n =
-#else
-	(void)
-#endif
-	rbtree_insert(&mesh->all, &s->node);
-	log_assert(n != NULL);
+	mesh_all_insert(mesh, s);
 	/* set detached (it is now) */
 	mesh->num_detached_states++;
 	/* make it ignore the cache */
@@ -796,13 +1093,7 @@ static void mesh_schedule_prefetch_subnet(struct mesh_area* mesh,
 		 */
 		s->s.client_addr =  *addr;
 	}
-#ifdef UNBOUND_DEBUG
-	n =
-#else
-	(void)
-#endif
-	rbtree_insert(&mesh->all, &s->node);
-	log_assert(n != NULL);
+	mesh_all_insert(mesh, s);
 	/* set detached (it is now) */
 	mesh->num_detached_states++;
 	/* make it ignore the cache */
@@ -868,14 +1159,21 @@ void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
 	mesh_run(mesh, e->qstate->mesh_info, event, e);
 }
 
-struct mesh_state*
-mesh_state_create(struct module_env* env, struct query_info* qinfo,
-	struct respip_client_info* cinfo, uint16_t qflags, int prime,
-	int valrec)
+/** get a free mesh state from the pool, or allocate one at the start of
+ * a new region. The s.region of the returned state is set. */
+static struct mesh_state*
+mesh_state_pool_get(struct mesh_area* mesh, struct module_env* env)
 {
-	struct regional* region = alloc_reg_obtain(env->alloc);
+	struct regional* region;
 	struct mesh_state* mstate;
-	int i;
+	if(mesh->all_count+1 > mesh->pool_hiwater)
+		mesh->pool_hiwater = mesh->all_count+1;
+	if((mstate = mesh->pool) != NULL) {
+		mesh->pool = mstate->next;
+		mesh->pool_num--;
+		return mstate;
+	}
+	region = alloc_reg_obtain(env->alloc);
 	if(!region)
 		return NULL;
 	mstate = (struct mesh_state*)regional_alloc(region,
@@ -884,10 +1182,74 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 		alloc_reg_release(env->alloc, region);
 		return NULL;
 	}
+	mstate->s.region = region;
+	return mstate;
+}
+
+/** the number of mesh states to keep, in use and in the pool */
+static size_t
+mesh_pool_limit(struct mesh_area* mesh)
+{
+	if(mesh->pool_hiwater_prev > mesh->pool_hiwater)
+		return mesh->pool_hiwater_prev;
+	return mesh->pool_hiwater;
+}
+
+/** put a mesh state that is cleaned up in the pool, or give its region
+ * back to the alloc if the pool is over the high water mark. */
+static void
+mesh_state_pool_put(struct mesh_area* mesh, struct mesh_state* mstate)
+{
+	struct module_env* env = mstate->s.env;
+	struct regional* region = mstate->s.region;
+	if(*env->now >= mesh->pool_interval_start + MESH_POOL_INTERVAL ||
+		*env->now < mesh->pool_interval_start) {
+		/* start a new interval, and return the memory that the
+		 * last two intervals did not need */
+		mesh->pool_hiwater_prev = mesh->pool_hiwater;
+		mesh->pool_hiwater = mesh->all_count;
+		mesh->pool_interval_start = *env->now;
+		while(mesh->pool && mesh->pool_num + mesh->all_count >=
+			mesh_pool_limit(mesh)) {
+			struct mesh_state* m = mesh->pool;
+			mesh->pool = m->next;
+			mesh->pool_num--;
+			alloc_reg_release(env->alloc, m->s.region);
+		}
+	}
+	if(mesh->pool_num + mesh->all_count >= mesh_pool_limit(mesh)) {
+		alloc_reg_release(env->alloc, region);
+		return;
+	}
+	/* reset the region, the state is allocated again at its start */
+	regional_free_all(region);
+	mstate = (struct mesh_state*)regional_alloc(region,
+		sizeof(struct mesh_state));
+	log_assert(mstate);
+	if(!mstate) {
+		alloc_reg_release(env->alloc, region);
+		return;
+	}
+	mstate->s.region = region;
+	mstate->next = mesh->pool;
+	mesh->pool = mstate;
+	mesh->pool_num++;
+}
+
+struct mesh_state*
+mesh_state_create(struct module_env* env, struct query_info* qinfo,
+	struct respip_client_info* cinfo, uint16_t qflags, int prime,
+	int valrec)
+{
+	struct regional* region;
+	struct mesh_state* mstate;
+	int i;
+	mstate = mesh_state_pool_get(env->mesh, env);
+	if(!mstate)
+		return NULL;
+	region = mstate->s.region;
 	memset(mstate, 0, sizeof(*mstate));
-	mstate->node = *RBTREE_NULL;
 	mstate->run_node = *RBTREE_NULL;
-	mstate->node.key = mstate;
 	mstate->run_node.key = mstate;
 	mstate->reply_list = NULL;
 	mstate->list_select = mesh_no_list;
@@ -896,6 +1258,7 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	rbtree_init(&mstate->sub_set, &mesh_state_ref_compare);
 	mstate->num_activated = 0;
 	mstate->unique = NULL;
+	mstate->retired = NULL;
 	/* init module qstate */
 	mstate->s.qinfo.qtype = qinfo->qtype;
 	mstate->s.qinfo.qclass = qinfo->qclass;
@@ -954,6 +1317,20 @@ mesh_state_make_unique(struct mesh_state* mstate)
 	mstate->unique = mstate;
 }
 
+void
+mesh_retired_release(struct mesh_retired* r)
+{
+	size_t refs;
+	lock_basic_lock(&r->lock);
+	log_assert(r->refs > 0);
+	refs = --r->refs;
+	lock_basic_unlock(&r->lock);
+	if(refs == 0) {
+		fptr_ok(fptr_whitelist_mesh_retired_del(r->del));
+		(*r->del)(r->arg);
+	}
+}
+
 void
 mesh_state_cleanup(struct mesh_state* mstate)
 {
@@ -976,8 +1353,7 @@ mesh_state_cleanup(struct mesh_state* mstate)
 		 * takes no time and also it does not do the mesh accounting */
 		mstate->reply_list = NULL;
 		for(; rep; rep=rep->next) {
-			infra_wait_limit_dec(mesh->env->infra_cache,
-				&rep->query_reply, mesh->env->cfg);
+			mesh_reply_wait_dec(mesh, &rep->query_reply);
 			if(rep->query_reply.c->use_h2)
 				http2_stream_remove_mesh_state(rep->h2_stream);
 			comm_point_drop_reply(&rep->query_reply);
@@ -1001,7 +1377,11 @@ mesh_state_cleanup(struct mesh_state* mstate)
 		mstate->s.minfo[i] = NULL;
 		mstate->s.ext_state[i] = module_finished;
 	}
-	alloc_reg_release(mstate->s.env->alloc, mstate->s.region);
+	if(mstate->retired) {
+		mesh_retired_release(mstate->retired);
+		mstate->retired = NULL;
+	}
+	mesh_state_pool_put(mesh, mstate);
 }
 
 void
@@ -1038,7 +1418,7 @@ mesh_state_delete(struct module_qstate* qstate)
 		(void)rbtree_delete(&super->s->sub_set, &ref);
 	}
 	(void)rbtree_delete(&mesh->run, mstate);
-	(void)rbtree_delete(&mesh->all, mstate);
+	mesh_all_remove(mesh, mstate);
 	mesh_state_cleanup(mstate);
 }
 
@@ -1093,7 +1473,7 @@ void mesh_detach_subs(struct module_qstate* qstate)
 			&& ref->s->super_set.count == 0) {
 			mesh->num_detached_states++;
 			log_assert(mesh->num_detached_states +
-				mesh->num_reply_states <= mesh->all.count);
+				mesh->num_reply_states <= mesh->all_count);
 		}
 	}
 	rbtree_init(&qstate->mesh_info->sub_set, &mesh_state_ref_compare);
@@ -1122,13 +1502,7 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 			log_err("mesh_attach_sub: out of memory");
 			return 0;
 		}
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &(*sub)->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, (*sub));
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		/* set new query state to run */
@@ -1463,8 +1837,7 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 		comm_point_send_reply(&r->query_reply);
 		m->reply_list = rlist;
 	}
-	infra_wait_limit_dec(m->s.env->infra_cache, &r->query_reply,
-		m->s.env->cfg);
+	mesh_reply_wait_dec(m->s.env->mesh, &r->query_reply);
 	/* account */
 	log_assert(m->s.env->mesh->num_reply_addrs > 0);
 	m->s.env->mesh->num_reply_addrs--;
@@ -1472,9 +1845,21 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 	timeval_subtract(&duration, &end_time, &r->start_time);
 	verbose(VERB_ALGO, "query took " ARG_LL "d.%6.6d sec",
 		(long long)duration.tv_sec, (int)duration.tv_usec);
+#ifdef HAVE_UB_MEMORY_BARRIER
+	if(m->s.env->mesh->stats_seq)
+		ub_seq_write_begin(m->s.env->mesh->stats_seq);
+#endif
 	m->s.env->mesh->replies_sent++;
 	timeval_add(&m->s.env->mesh->replies_sum_wait, &duration);
 	timehist_insert(m->s.env->mesh->histogram, &duration);
+#ifdef HAVE_UB_MEMORY_BARRIER
+	if(m->s.env->mesh->stats_seq)
+		ub_seq_write_end(m->s.env->mesh->stats_seq);
+#endif
+	if(m->s.env->mesh->latency)
+		latency_client_insert(m->s.env->mesh->latency, &duration,
+			m->s.qinfo.qtype, (int)FLAGS_GET_RCODE(
+			sldns_buffer_read_u16_at(r_buffer, 2)), 1);
 	if(m->s.env->cfg->stat_extended) {
 		uint16_t rc = FLAGS_GET_RCODE(sldns_buffer_read_u16_at(
 			r_buffer, 2));
@@ -1533,8 +1918,7 @@ void mesh_query_done(struct mesh_state* mstate)
 			 * done there, but instead we do that here. */
 			struct mesh_reply* reply_list = mstate->reply_list;
 			verbose(VERB_ALGO, "drop reply, it is older than discard-timeout");
-			infra_wait_limit_dec(mstate->s.env->infra_cache,
-				&r->query_reply, mstate->s.env->cfg);
+			mesh_reply_wait_dec(mstate->s.env->mesh, &r->query_reply);
 			mstate->reply_list = NULL;
 			if(r->query_reply.c->use_h2)
 				http2_stream_remove_mesh_state(r->h2_stream);
@@ -1567,8 +1951,7 @@ void mesh_query_done(struct mesh_state* mstate)
 			 * because the list is NULL and also accounting is not
 			 * done there, but instead we do that here. */
 			struct mesh_reply* reply_list = mstate->reply_list;
-			infra_wait_limit_dec(mstate->s.env->infra_cache,
-				&r->query_reply, mstate->s.env->cfg);
+			mesh_reply_wait_dec(mstate->s.env->mesh, &r->query_reply);
 			mstate->reply_list = NULL;
 			if(r->query_reply.c->use_h2) {
 				http2_stream_remove_mesh_state(r->h2_stream);
@@ -1666,8 +2049,8 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 {
 	struct mesh_state key;
 	struct mesh_state* result;
+	hashvalue_type hash;
 
-	key.node.key = &key;
 	key.s.is_priming = prime;
 	key.s.is_valrec = valrec;
 	key.s.qinfo = *qinfo;
@@ -1678,8 +2061,13 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 	key.unique = NULL;
 	key.s.client_info = cinfo;
 
-	result = (struct mesh_state*)rbtree_search(&mesh->all, &key);
-	return result;
+	hash = mesh_state_hash(&key);
+	for(result = mesh->hash_bins[hash & (mesh->hash_size-1)]; result;
+		result = result->hash_next) {
+		if(result->hash == hash && mesh_state_compare(result, &key) == 0)
+			return result;
+	}
+	return NULL;
 }
 
 int mesh_state_add_cb(struct mesh_state* s, struct edns_data* edns,
@@ -1978,15 +2366,44 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 	}
 }
 
+/** qsort compare of mesh state pointers, like mesh_state_compare */
+static int
+mesh_state_ptr_compare(const void* a, const void* b)
+{
+	return mesh_state_compare(*(struct mesh_state* const*)a,
+		*(struct mesh_state* const*)b);
+}
+
+struct mesh_state**
+mesh_all_sorted(struct mesh_area* mesh)
+{
+	struct mesh_state** arr, *m;
+	size_t i = 0;
+	if(mesh->all_count == 0)
+		return NULL;
+	arr = (struct mesh_state**)reallocarray(NULL, mesh->all_count,
+		sizeof(*arr));
+	if(!arr)
+		return NULL;
+	for(m = mesh->all_first; m; m = m->all_next)
+		arr[i++] = m;
+	log_assert(i == mesh->all_count);
+	qsort(arr, i, sizeof(*arr), &mesh_state_ptr_compare);
+	return arr;
+}
+
 void
 mesh_log_list(struct mesh_area* mesh)
 {
 	char buf[30];
-	struct mesh_state* m;
+	struct mesh_state* l, *m, **arr;
 	int num = 0;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+	/* without memory for the sort, log them in list order */
+	arr = mesh_all_sorted(mesh);
+	for(l = mesh->all_first; l; l = l->all_next) {
+		m = arr?arr[num]:l;
 		snprintf(buf, sizeof(buf), "%d%s%s%s%s%s%s mod%d %s%s",
-			num++, (m->s.is_priming)?"p":"",  /* prime */
+			num, (m->s.is_priming)?"p":"",  /* prime */
 			(m->s.is_valrec)?"v":"",  /* prime */
 			(m->s.query_flags&BIT_RD)?"RD":"",
 			(m->s.query_flags&BIT_CD)?"CD":"",
@@ -1996,7 +2413,9 @@ mesh_log_list(struct mesh_area* mesh)
 			(m->cb_list)?"cb":"" /* callbacks */
 			);
 		log_query_info(VERB_ALGO, buf, &m->s.qinfo);
+		num++;
 	}
+	free(arr);
 }
 
 void
@@ -2005,7 +2424,7 @@ mesh_stats(struct mesh_area* mesh, const char* str)
 	verbose(VERB_DETAIL, "%s %u recursion states (%u with reply, "
 		"%u detached), %u waiting replies, %u recursion replies "
 		"sent, %d replies dropped, %d states jostled out",
-		str, (unsigned)mesh->all.count,
+		str, (unsigned)mesh->all_count,
 		(unsigned)mesh->num_reply_states,
 		(unsigned)mesh->num_detached_states,
 		(unsigned)mesh->num_reply_addrs,
@@ -2050,11 +2469,16 @@ mesh_get_mem(struct mesh_area* mesh)
 	struct mesh_state* m;
 	size_t s = sizeof(*mesh) + sizeof(struct timehist) +
 		sizeof(struct th_buck)*mesh->histogram->num +
-		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak);
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak) +
+		(mesh->latency?sizeof(struct latency_client):0);
+	for(m = mesh->all_first; m; m = m->all_next) {
 		/* all, including m itself allocated in qstate region */
 		s += regional_get_mem(m->s.region);
 	}
+	for(m = mesh->pool; m; m = m->next) {
+		s += regional_get_mem(m->s.region);
+	}
+	s += sizeof(struct mesh_state*)*mesh->hash_size;
 	return s;
 }
 
@@ -2107,8 +2531,7 @@ void mesh_state_remove_reply(struct mesh_area* mesh, struct mesh_state* m,
 			/* delete it, but allocated in m region */
 			log_assert(mesh->num_reply_addrs > 0);
 			mesh->num_reply_addrs--;
-			infra_wait_limit_dec(mesh->env->infra_cache,
-				&n->query_reply, mesh->env->cfg);
+			mesh_reply_wait_dec(mesh, &n->query_reply);
 
 			/* prev = prev; */
 			n = n->next;
@@ -2263,8 +2686,7 @@ mesh_serve_expired_callback(void* arg)
 			 * done there, but instead we do that here. */
 			struct mesh_reply* reply_list = mstate->reply_list;
 			verbose(VERB_ALGO, "drop reply, it is older than discard-timeout");
-			infra_wait_limit_dec(mstate->s.env->infra_cache,
-				&r->query_reply, mstate->s.env->cfg);
+			mesh_reply_wait_dec(mstate->s.env->mesh, &r->query_reply);
 			mstate->reply_list = NULL;
 			if(r->query_reply.c->use_h2)
 				http2_stream_remove_mesh_state(r->h2_stream);
@@ -2304,8 +2726,7 @@ mesh_serve_expired_callback(void* arg)
 		if(r->query_reply.c->tcp_req_info)
 			tcp_req_info_remove_mesh_state(r->query_reply.c->tcp_req_info, mstate);
 		/* mesh_send_reply removed mesh state from http2_stream. */
-		infra_wait_limit_dec(mstate->s.env->infra_cache,
-			&r->query_reply, mstate->s.env->cfg);
+		mesh_reply_wait_dec(mstate->s.env->mesh, &r->query_reply);
 		prev = r;
 		prev_buffer = r_buffer;
 	}
@@ -2362,7 +2783,7 @@ mesh_respond_serve_expired(struct mesh_state* mstate)
 
 int mesh_jostle_exceeded(struct mesh_area* mesh)
 {
-	if(mesh->all.count < mesh->max_reply_states)
+	if(mesh->all_count < mesh->max_reply_states)
 		return 0;
 	return 1;
 }
@@ -48,6 +48,8 @@
 
 #include "util/rbtree.h"
 #include "util/netevent.h"
+#include "util/storage/lruhash.h"
+#include "util/storage/dnstree.h"
 #include "util/data/msgparse.h"
 #include "util/module.h"
 #include "services/modstack.h"
@@ -76,6 +78,22 @@ struct respip_client_info;
  */
 #define MESH_MAX_SUBSUB 1024
 
+/**
+ * Seconds in the interval of the high water mark of the mesh state pool.
+ * The pool keeps the free mesh states up to the high water mark of the
+ * last two intervals, the rest is given back.
+ */
+#define MESH_POOL_INTERVAL 60
+
+/** initial number of bins in the hash index of the mesh states */
+#define MESH_HASH_START 1024
+
+/**
+ * Number of query states, from the start of the jostle and forever lists,
+ * that fair-share looks at to find a query of a client over its share.
+ */
+#define MESH_FAIR_SCAN 64
+
 /** 
  * Mesh of query states
  */
@@ -87,8 +105,18 @@ struct mesh_area {
 
 	/** set of runnable queries (mesh_state.run_node) */
 	rbtree_type run;
-	/** rbtree of all current queries (mesh_state.node)*/
-	rbtree_type all;
+	/** list of all current queries, in no order, linked with
+	 * mesh_state.all_next and all_prev. An insert or delete is not a
+	 * compare of the query names. The dump and log of the list sort
+	 * it, with mesh_all_sorted. */
+	struct mesh_state* all_first;
+	/** number of states in the all list */
+	size_t all_count;
+	/** hash index of the states in the all list, for mesh_area_find.
+	 * Array of bins, the states are linked with hash_next. */
+	struct mesh_state** hash_bins;
+	/** number of bins in hash_bins, a power of 2 */
+	size_t hash_size;
 
 	/** count of the total number of mesh_reply entries */
 	size_t num_reply_addrs;
@@ -122,6 +150,12 @@ struct mesh_area {
 	struct timeval replies_sum_wait;
 	/** histogram of time values */
 	struct timehist* histogram;
+	/** the statistics sequence counter of the worker, or NULL. It is
+	 * odd while the reply time and histogram are updated, so that
+	 * lockless stats readers copy the histogram whole. */
+	volatile unsigned int* stats_seq;
+	/** latency histograms of the response times, NULL if not enabled */
+	struct latency_client* latency;
 	/** (extended stats) secure replies */
 	size_t ans_secure;
 	/** (extended stats) bogus replies */
@@ -155,6 +189,54 @@ struct mesh_area {
 	int use_response_ip;
 	/** If we need to use RPZ (value passed from daemon) */
 	int use_rpz;
+
+	/** free mesh states, each at the start of its region, that new
+	 * states reuse. Linked with the next pointer. */
+	struct mesh_state* pool;
+	/** number of mesh states in the pool */
+	size_t pool_num;
+	/** high water mark of the mesh states in use, in this interval */
+	size_t pool_hiwater;
+	/** high water mark of the mesh states in use, previous interval */
+	size_t pool_hiwater_prev;
+	/** start time of the high water mark interval */
+	time_t pool_interval_start;
+
+	/** if the requestlist is shared fairly between the clients */
+	int fair_share;
+	/** the clients with replies waiting, struct mesh_client, sorted by
+	 * address. Only kept with fair_share. */
+	rbtree_type clients;
+	/** the sum of the weights of the clients in the clients tree */
+	size_t clients_weight;
+	/** addr tree of struct mesh_fair_weight, from fair-share-weight */
+	rbtree_type fair_weights;
+};
+
+/**
+ * A client address with replies waiting in the mesh, for fair-share.
+ */
+struct mesh_client {
+	/** node in the clients tree, key is this structure */
+	rbnode_type node;
+	/** the client address */
+	struct sockaddr_storage addr;
+	/** length of the address */
+	socklen_t addrlen;
+	/** number of replies waiting for this client */
+	size_t num;
+	/** the weight of the client */
+	int weight;
+};
+
+/**
+ * The fair-share weight for a netblock.
+ */
+struct mesh_fair_weight {
+	/** node in the fair weights addr tree */
+	struct addr_tree_node node;
+	/** the weight of the clients in the netblock */
+	int weight;
 };
 
 /**
@@ -167,8 +249,10 @@ struct mesh_area {
  * region. All parts (rbtree nodes etc) are also allocated in the region.
  */
 struct mesh_state {
-	/** node in mesh_area all tree, key is this struct. Must be first. */
-	rbnode_type node;
+	/** next in the mesh_area all list */
+	struct mesh_state* all_next;
+	/** previous in the mesh_area all list, NULL for the first */
+	struct mesh_state* all_prev;
 	/** node in mesh_area runnable tree, key is this struct */
 	rbnode_type run_node;
 	/** the query state. Note that the qinfo and query_flags 
@@ -197,10 +281,36 @@ struct mesh_state {
 	/** pointer to this state for uniqueness or NULL */
 	struct mesh_state* unique;
 
+	/** hash value of the state, for the hash index in the mesh area */
+	hashvalue_type hash;
+	/** next state in the hash bin */
+	struct mesh_state* hash_next;
+	/** the structures replaced by a fast reload that the client info
+	 * refers to, released when the state is deleted. NULL if the
+	 * client info refers to the structures in use. */
+	struct mesh_retired* retired;
+
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
 };
 
+/**
+ * The count of the mesh states whose client info refers to structures
+ * that a fast reload replaced, the access control list, views and
+ * response ip set of that moment. The mesh states of all threads
+ * release it, the last one deletes the structures.
+ */
+struct mesh_retired {
+	/** lock on the count */
+	lock_basic_type lock;
+	/** number of mesh states that refer to the structures */
+	size_t refs;
+	/** deletes the structures, called when refs drops to 0 */
+	void (*del)(void* arg);
+	/** argument for del */
+	void* arg;
+};
+
 /**
  * Rbtree reference to a mesh_state.
  * Used in super_set and sub_set. 
@@ -487,6 +597,13 @@ struct mesh_state* mesh_state_create(struct module_env* env,
  */
 void mesh_state_make_unique(struct mesh_state* mstate);
 
+/**
+ * Release a reference of a mesh state on the structures that a fast
+ * reload replaced. Deletes them if it was the last reference.
+ * @param r: the count of references.
+ */
+void mesh_retired_release(struct mesh_retired* r);
+
 /**
  * Cleanup a mesh state and its query state. Does not do rbtree or 
  * reference cleanup.
@@ -589,6 +706,15 @@ void mesh_stats_clear(struct mesh_area* mesh);
  */
 void mesh_log_list(struct mesh_area* mesh);
 
+/**
+ * The states of the all list in an array, sorted like mesh_state_compare,
+ * for the dump and log of the list.
+ * @param mesh: the mesh.
+ * @return malloced array of mesh->all_count states, the caller frees it.
+ *	NULL if there are no states or out of memory.
+ */
+struct mesh_state** mesh_all_sorted(struct mesh_area* mesh);
+
 /**
  * Calculate memory size in use by mesh and all queries inside it.
  * @param mesh: the mesh to examine.
@@ -619,6 +745,9 @@ int mesh_state_compare(const void* ap, const void* bp);
 /** compare two mesh references */
 int mesh_state_ref_compare(const void* ap, const void* bp);
 
+/** compare two mesh clients, by address */
+int mesh_client_compare(const void* ap, const void* bp);
+
 /**
  * Make space for another recursion state for a reply in the mesh
  * @param mesh: mesh area
@@ -59,6 +59,9 @@
 #include "util/random.h"
 #include "util/fptr_wlist.h"
 #include "util/edns.h"
+#include "util/storage/lookup3.h"
+#include "util/timeval_func.h"
+#include "util/topk.h"
 #include "sldns/sbuffer.h"
 #include "dnstap/dnstap.h"
 #ifdef HAVE_OPENSSL_SSL_H
@@ -627,6 +630,110 @@ outnet_tcp_take_query_setup(int s, struct pending_tcp* pend,
 	comm_timer_set(w->timer, &tv);
 }
 
+/** find the TLS session slot for the upstream */
+static struct outnet_tls_session*
+outnet_tls_session_slot(struct outside_network* outnet,
+	struct sockaddr_storage* addr, socklen_t addrlen, char* auth_name)
+{
+	uint32_t h = hashlittle(addr, (size_t)addrlen, 0);
+	if(auth_name)
+		h = hashlittle(auth_name, strlen(auth_name), h);
+	return &outnet->tls_sessions[h % OUTNET_TLS_SESSION_NUM];
+}
+
+/** see if the TLS session slot is for the upstream */
+static int
+outnet_tls_session_match(struct outnet_tls_session* slot,
+	struct sockaddr_storage* addr, socklen_t addrlen, char* auth_name)
+{
+	if(slot->addrlen == 0 || !slot->session)
+		return 0;
+	if(sockaddr_cmp(&slot->addr, slot->addrlen, addr, addrlen) != 0)
+		return 0;
+	if(!slot->auth_name || !auth_name)
+		return slot->auth_name == auth_name;
+	return strcmp(slot->auth_name, auth_name) == 0;
+}
+
+/** set the stored TLS session of the upstream on the ssl, to resume it */
+static void
+outnet_tls_session_resume(struct outside_network* outnet, void* ssl,
+	struct sockaddr_storage* addr, socklen_t addrlen, char* auth_name)
+{
+#ifdef HAVE_SSL
+	struct outnet_tls_session* slot;
+	if(!outnet->tls_sessions || !ssl)
+		return;
+	slot = outnet_tls_session_slot(outnet, addr, addrlen, auth_name);
+	if(!outnet_tls_session_match(slot, addr, addrlen, auth_name))
+		return;
+	if(!SSL_set_session((SSL*)ssl, (SSL_SESSION*)slot->session)) {
+		log_crypto_err("could not SSL_set_session");
+	}
+#else
+	(void)outnet; (void)ssl; (void)addr; (void)addrlen; (void)auth_name;
+#endif
+}
+
+/** count the TLS handshake and store the session of the upstream */
+static void
+outnet_tls_session_store(struct outside_network* outnet, void* ssl,
+	struct sockaddr_storage* addr, socklen_t addrlen, char* auth_name)
+{
+#ifdef HAVE_SSL
+	struct outnet_tls_session* slot;
+	SSL_SESSION* sess;
+	char* nm = NULL;
+	if(!outnet->tls_sessions || !ssl)
+		return;
+	if(SSL_session_reused((SSL*)ssl))
+		outnet->num_tls_resume++;
+	else	outnet->num_tls_full++;
+	slot = outnet_tls_session_slot(outnet, addr, addrlen, auth_name);
+	sess = SSL_get1_session((SSL*)ssl);
+	if(!sess)
+		return;
+	if(sess == (SSL_SESSION*)slot->session) {
+		/* resumed the stored session, it is still stored */
+		SSL_SESSION_free(sess);
+		return;
+	}
+	if(auth_name && !(nm = strdup(auth_name))) {
+		log_err("malloc failure for TLS session");
+		SSL_SESSION_free(sess);
+		return;
+	}
+	if(slot->session)
+		SSL_SESSION_free((SSL_SESSION*)slot->session);
+	free(slot->auth_name);
+	slot->session = sess;
+	slot->auth_name = nm;
+	memmove(&slot->addr, addr, addrlen);
+	slot->addrlen = addrlen;
+#else
+	(void)outnet; (void)ssl; (void)addr; (void)addrlen; (void)auth_name;
+#endif
+}
+
+/** delete the stored TLS sessions */
+static void
+outnet_tls_sessions_delete(struct outside_network* outnet)
+{
+	int i;
+	if(!outnet->tls_sessions)
+		return;
+	for(i=0; i<OUTNET_TLS_SESSION_NUM; i++) {
+#ifdef HAVE_SSL
+		if(outnet->tls_sessions[i].session)
+			SSL_SESSION_free((SSL_SESSION*)
+				outnet->tls_sessions[i].session);
+#endif
+		free(outnet->tls_sessions[i].auth_name);
+	}
+	free(outnet->tls_sessions);
+	outnet->tls_sessions = NULL;
+}
+
 /** use next free buffer to service a tcp query */
 static int
 outnet_tcp_take_into_use(struct waiting_tcp* w)
@@ -741,6 +848,11 @@ outnet_tcp_take_into_use(struct waiting_tcp* w)
 			comm_point_close(pend->c);
 			return 0;
 		}
+		outnet_tls_session_resume(w->outnet, pend->c->ssl, &w->addr,
+			w->addrlen, w->tls_auth_name);
+		pend->tls_session_new = 1;
+	} else {
+		pend->tls_session_new = 0;
 	}
 	w->next_waiting = (void*)pend;
 	w->outnet->num_tcp_outgoing++;
@@ -1374,6 +1486,14 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 	if(w) {
 		log_assert(!w->on_tcp_waiting_list);
 		log_assert(!w->write_wait_queued);
+		if(error == NETEVENT_NOERROR && pend->tls_session_new) {
+			/* the handshake is done, and the session tickets
+			 * are sent before the reply */
+			pend->tls_session_new = 0;
+			outnet_tls_session_store(outnet, pend->c->ssl,
+				&pend->reuse.addr, pend->reuse.addrlen,
+				w->tls_auth_name);
+		}
 		reuse_tree_by_id_delete(&pend->reuse, w);
 		verbose(VERB_CLIENT, "outnet tcp callback query err %d buflen %d",
 			error, (int)sldns_buffer_limit(c->buffer));
@@ -1679,6 +1799,8 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->tcp_reuse_timeout= tcp_reuse_timeout;
 	outnet->tcp_auth_query_timeout = tcp_auth_query_timeout;
 	outnet->num_tcp_outgoing = 0;
+	outnet->num_tls_resume = 0;
+	outnet->num_tls_full = 0;
 	outnet->num_udp_outgoing = 0;
 	outnet->infra = infra;
 	outnet->rnd = rnd;
@@ -1742,6 +1864,12 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 		outside_network_delete(outnet);
 		return NULL;
 	}
+	if(sslctx && !(outnet->tls_sessions = (struct outnet_tls_session*)
+		calloc(OUTNET_TLS_SESSION_NUM, sizeof(struct outnet_tls_session)))) {
+		log_err("malloc failed");
+		outside_network_delete(outnet);
+		return NULL;
+	}
 	rbtree_init(&outnet->tcp_reuse, reuse_cmp);
 	outnet->tcp_reuse_max = num_tcp;
 
@@ -1854,6 +1982,7 @@ outside_network_delete(struct outside_network* outnet)
 	}
 	if(outnet->udp_buff)
 		sldns_buffer_free(outnet->udp_buff);
+	outnet_tls_sessions_delete(outnet);
 	if(outnet->unused_fds) {
 		struct port_comm* p = outnet->unused_fds, *np;
 		while(p) {
@@ -1934,9 +2063,76 @@ outside_network_delete(struct outside_network* outnet)
 			p = np;
 		}
 	}
+	free(outnet->latency);
 	free(outnet);
 }
 
+int
+outnet_latency_setup(struct outside_network* outnet)
+{
+	outnet->latency = (struct upstream_latency*)calloc(
+		UPSTREAM_LATENCY_NUM+1, sizeof(struct upstream_latency));
+	return (outnet->latency != NULL);
+}
+
+/** count an upstream server address in a heavy hitter sketch */
+static void
+outnet_top_count(struct outside_network* outnet, enum topk_kind kind,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	/* family, port, address */
+	uint8_t key[3+INET6_SIZE];
+	size_t keylen;
+	if(addr_is_ip6(addr, addrlen)) {
+		struct sockaddr_in6* sa6 = (struct sockaddr_in6*)addr;
+		key[0] = 6;
+		memmove(key+1, &sa6->sin6_port, 2);
+		memmove(key+3, &sa6->sin6_addr, INET6_SIZE);
+		keylen = 3+INET6_SIZE;
+	} else {
+		struct sockaddr_in* sa = (struct sockaddr_in*)addr;
+		key[0] = 4;
+		memmove(key+1, &sa->sin_port, 2);
+		memmove(key+3, &sa->sin_addr, INET_SIZE);
+		keylen = 3+INET_SIZE;
+	}
+	lock_basic_lock(&outnet->top->lock);
+	topk_insert(outnet->top->t[kind], key, keylen);
+	lock_basic_unlock(&outnet->top->lock);
+}
+
+/** add round trip time of an upstream to the latency histograms */
+static void
+outnet_latency_insert(struct outside_network* outnet,
+	struct sockaddr_storage* addr, socklen_t addrlen, struct timeval* rtt)
+{
+	struct upstream_latency* u = &outnet->latency[UPSTREAM_LATENCY_NUM];
+	uint32_t h = hashlittle(addr, (size_t)addrlen, 0);
+	int i;
+	for(i=0; i<UPSTREAM_LATENCY_PROBE; i++) {
+		struct upstream_latency* s = &outnet->latency[
+			(h+(uint32_t)i)%UPSTREAM_LATENCY_NUM];
+		if(!s->used) {
+			/* claim the slot, the address is visible before the
+			 * used flag to the statistics reader */
+			memcpy(&s->addr, addr, addrlen);
+			s->addrlen = addrlen;
+#ifdef HAVE_UB_MEMORY_BARRIER
+			ub_write_barrier();
+#endif
+			s->used = 1;
+			u = s;
+			break;
+		}
+		if(sockaddr_cmp(addr, addrlen, &s->addr, s->addrlen) == 0) {
+			u = s;
+			break;
+		}
+	}
+	lathist_insert(&u->hist, ((long long)rtt->tv_sec)*1000000 +
+		(long long)rtt->tv_usec);
+}
+
 void 
 pending_delete(struct outside_network* outnet, struct pending* p)
 {
@@ -3000,6 +3196,12 @@ serviced_callbacks(struct serviced_query* sq, int error, struct comm_point* c,
 	log_assert(rem); /* should have been present */
 	sq->to_be_deleted = 1; 
 	verbose(VERB_ALGO, "svcd callbacks start");
+	if(sq->outnet->top && error == NETEVENT_NOERROR && c &&
+		sldns_buffer_limit(c->buffer) >= LDNS_HEADER_SIZE &&
+		LDNS_RCODE_WIRE(sldns_buffer_begin(c->buffer)) ==
+		LDNS_RCODE_SERVFAIL)
+		outnet_top_count(sq->outnet, topk_servfail, &sq->addr,
+			sq->addrlen);
 	if(sq->outnet->use_caps_for_id && error == NETEVENT_NOERROR && c &&
 		!sq->nocaps && sq->qtype != LDNS_RR_TYPE_PTR) {
 		/* for type PTR do not check perturbed name in answer,
@@ -3376,6 +3578,12 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		  + ((int)now.tv_usec - (int)sq->last_sent_time.tv_usec)/1000;
 		verbose(VERB_ALGO, "measured roundtrip at %d msec", roundtime);
 		log_assert(roundtime >= 0);
+		if(outnet->latency) {
+			struct timeval rtt;
+			timeval_subtract(&rtt, &now, &sq->last_sent_time);
+			outnet_latency_insert(outnet, &sq->addr, sq->addrlen,
+				&rtt);
+		}
 		/* in case the system hibernated, do not enter a huge value,
 		 * above this value gives trouble with server selection */
 		if(roundtime < 60000) {
@@ -3509,6 +3717,8 @@ outnet_serviced_query(struct outside_network* outnet,
 			serviced_node_del(&sq->node, NULL);
 			return NULL;
 		}
+		if(outnet->top)
+			outnet_top_count(outnet, topk_upstream, addr, addrlen);
 		/* No network action at this point; it will be invoked with the
 		 * serviced_query timer instead to run outside of the mesh. */
 	} else {
@@ -47,6 +47,7 @@
 #include "util/rbtree.h"
 #include "util/regional.h"
 #include "util/netevent.h"
+#include "util/timehist.h"
 #include "dnstap/dnstap_config.h"
 struct pending;
 struct pending_timeout;
@@ -66,6 +67,48 @@ struct module_env;
 struct module_qstate;
 struct query_info;
 struct config_file;
+struct topk_set;
+
+/** number of upstream addresses with a latency histogram, per thread */
+#define UPSTREAM_LATENCY_NUM 64
+/** number of slots that are probed for an upstream latency address */
+#define UPSTREAM_LATENCY_PROBE 8
+
+/**
+ * Round trip time latency histogram for an upstream server address.
+ * The slot is claimed by the first address that hashes to it, and is not
+ * reused, so that the statistics reader can see it without locks.
+ */
+struct upstream_latency {
+	/** if the slot is in use, set after the address is filled in */
+	volatile int used;
+	/** address of the upstream server */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the round trip times */
+	struct lathist hist;
+};
+
+/** number of upstream TLS sessions that are kept for resumption, per
+ * thread */
+#define OUTNET_TLS_SESSION_NUM 64
+
+/**
+ * TLS session of an upstream server, to resume on the next connection.
+ * The slot is by hash of the address and authentication name, and a
+ * new session for another upstream replaces it.
+ */
+struct outnet_tls_session {
+	/** address of the upstream server */
+	struct sockaddr_storage addr;
+	/** length of addr, 0 if the slot is empty */
+	socklen_t addrlen;
+	/** the tls auth name of the connection, malloced, or NULL */
+	char* auth_name;
+	/** the session, SSL_SESSION* */
+	void* session;
+};
 
 /**
  * Send queries to outside servers and wait for answers from servers.
@@ -163,6 +206,13 @@ struct outside_network {
 	size_t num_tcp;
 	/** number of tcp communication points in use. */
 	size_t num_tcp_outgoing;
+	/** number of TLS connections that resumed a session */
+	size_t num_tls_resume;
+	/** number of TLS connections that made a full handshake */
+	size_t num_tls_full;
+	/** the TLS sessions of upstream servers, OUTNET_TLS_SESSION_NUM,
+	 * NULL if there is no sslctx */
+	struct outnet_tls_session* tls_sessions;
 	/** max number of queries on a reuse connection */
 	size_t max_reuse_tcp_queries;
 	/** timeout for REUSE entries in milliseconds. */
@@ -190,6 +240,12 @@ struct outside_network {
 	struct waiting_tcp* tcp_wait_first;
 	/** last of waiting query list */
 	struct waiting_tcp* tcp_wait_last;
+	/** heavy hitter sketches of the thread, not owned by outnet, or NULL.
+	 * Counts the upstream servers by queries and by SERVFAILs. */
+	struct topk_set* top;
+	/** upstream round trip time histograms, UPSTREAM_LATENCY_NUM
+	 * address slots and one for the others. NULL if not enabled. */
+	struct upstream_latency* latency;
 };
 
 /**
@@ -361,6 +417,9 @@ struct pending_tcp {
 	 * It is here for memory pre-allocation, and used to make this
 	 * pending_tcp wait for reuse. */
 	struct reuse_tcp reuse;
+	/** if the TLS session of the connection is counted and stored at
+	 * the first reply */
+	int tls_session_new;
 };
 
 /**
@@ -572,6 +631,13 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	int udp_connect, int max_reuse_tcp_queries, int tcp_reuse_timeout,
 	int tcp_auth_query_timeout);
 
+/**
+ * Setup the upstream latency histograms, for statistics-latency.
+ * @param outnet: outside network.
+ * @return false on alloc failure.
+ */
+int outnet_latency_setup(struct outside_network* outnet);
+
 /**
  * Delete outside_network structure.
  * @param outnet: object to delete.
@@ -109,12 +109,21 @@ usage(void)
 	printf("  				That means the caches sizes and\n");
 	printf("  				the number of threads must not\n");
 	printf("  				change between reloads.\n");
+	printf("  fast_reload [+v]		reloads the local zones, views,\n");
+	printf("  				access control, forwards, stubs\n");
+	printf("  				and response ip while the server\n");
+	printf("  				keeps running, with caches and\n");
+	printf("  				connections. +v prints timing.\n");
 	printf("  stats				print statistics\n");
 	printf("  stats_noreset			peek at statistics\n");
 #ifdef HAVE_SHMGET
 	printf("  stats_shm			print statistics using shm\n");
 #endif
 	printf("  status			display status of server\n");
+	printf("  top [kind] [number]		print the heavy hitters, of kind\n");
+	printf("  				client, qname, zone, upstream\n");
+	printf("  				or servfail\n");
+	printf("  top_clear			reset the heavy hitter counts\n");
 	printf("  verbosity <number>		change logging detail\n");
 	printf("  log_reopen			close and open the logfile\n");
 	printf("  local_zone <name> <type>	add new local zone\n");
@@ -360,6 +369,8 @@ static void print_extended(struct ub_stats_info* s, int inhibit_zero)
 	PR_UL("num.query.udpout", s->svr.qudp_outgoing);
 	PR_UL("num.query.tls", s->svr.qtls);
 	PR_UL("num.query.tls_resume", s->svr.qtls_resume);
+	PR_UL("num.query.tlsout.resume", s->svr.qtls_outgoing_resume);
+	PR_UL("num.query.tlsout.full", s->svr.qtls_outgoing_full);
 	PR_UL("num.query.ipv6", s->svr.qipv6);
 	PR_UL("num.query.https", s->svr.qhttps);
 #ifdef HAVE_NGTCP2
@@ -391,6 +402,7 @@ static void print_extended(struct ub_stats_info* s, int inhibit_zero)
 	}
 	/* iteration */
 	PR_UL("num.query.ratelimited", s->svr.queries_ratelimited);
+	PR_UL("num.query.hedged", s->svr.queries_hedged);
 	/* validation */
 	PR_UL("num.answer.secure", s->svr.ans_secure);
 	PR_UL("num.answer.bogus", s->svr.ans_bogus);
@@ -99,14 +99,20 @@ static void usage(char* argv[])
 	printf("usage: %s [options] name ...\n", argv[0]);
 	printf("names are looked up at the same time, asynchronously.\n");
 	printf("	-b : use blocking requests\n");
-	printf("	-c : cancel the requests\n");
+	printf("	-B : look up the names in one batch\n");
+	printf("	-c : cancel the requests, with -B only the first\n");
 	printf("	-d : enable debug output\n");
 	printf("	-f addr : use addr, forward to that server\n");
 	printf("	-h : this help message\n");
 	printf("	-H fname : read hosts from fname\n");
+	printf("	-n num : with -x, number of queries per thread\n");
+	printf("	-o opt:val : set option, like resolve-worker-pool:4\n");
 	printf("	-r fname : read resolv.conf from fname\n");
+	printf("	-R size : look up the names in a result buffer of size\n");
 	printf("	-t : use a resolver thread instead of forking a process\n");
-	printf("	-x : perform extended threaded test\n");
+	printf("	-u : with -R, use an unaligned result buffer\n");
+	printf("	-x : perform extended threaded test, the names have to\n"
+	       "	     resolve to an address\n");
 	exit(1);
 }
 
@@ -160,6 +166,159 @@ checkerr(const char* desc, int err)
 	}
 }
 
+/** number of times the batch callback is called */
+static int batch_done = 0;
+
+/** this is a function of type ub_batch_callback_type */
+static void
+batch_is_done(void* ATTR_UNUSED(mydata),
+	struct ub_batch_query* ATTR_UNUSED(queries), int num)
+{
+	fprintf(stderr, "batch of %d resolved\n", num);
+	batch_done++;
+}
+
+/** look up the names in one batch, and cancel the first if asked */
+static int
+batch_test(struct ub_ctx* ctx, int argc, char** argv, int cancel)
+{
+	struct ub_batch_query* queries;
+	struct lookinfo info;
+	int i, r;
+	queries = (struct ub_batch_query*)calloc((size_t)argc,
+		sizeof(*queries));
+	if(!queries) {
+		printf("out of memory\n");
+		return 1;
+	}
+	for(i=0; i<argc; i++) {
+		queries[i].qname = argv[i];
+		queries[i].qtype = LDNS_RR_TYPE_A;
+		queries[i].qclass = LDNS_RR_CLASS_IN;
+	}
+	fprintf(stderr, "start batch lookup of %d names\n", argc);
+	r = ub_resolve_batch(ctx, queries, argc, NULL, &batch_is_done);
+	checkerr("ub_resolve_batch", r);
+	if(cancel) {
+		fprintf(stderr, "cancel %s\n", argv[0]);
+		r = ub_cancel(ctx, queries[0].async_id);
+		checkerr("ub_cancel", r);
+	}
+
+	for(i=0; i<1000; i++) {
+		usleep(100000);
+		fprintf(stderr, "%g seconds passed\n", 0.1*(double)i);
+		r = ub_process(ctx);
+		checkerr("ub_process", r);
+		if(batch_done)
+			break;
+	}
+	if(!batch_done) {
+		printf("timed out\n");
+		return 0;
+	}
+	/* the callback is not called again */
+	r = ub_process(ctx);
+	checkerr("ub_process", r);
+	printf("batch complete, callback called %d times\n", batch_done);
+
+	for(i=0; i<argc; i++) {
+		memset(&info, 0, sizeof(info));
+		info.name = argv[i];
+		info.err = queries[i].err;
+		info.result = queries[i].result;
+		print_result(&info);
+		ub_resolve_free(queries[i].result);
+	}
+	ub_ctx_delete(ctx);
+	free(queries);
+	checklock_stop();
+	return 0;
+}
+
+/** check that the item of l bytes at p is inside the buffer */
+static int
+resbuf_in(void* p, size_t l, uint8_t* buf, int len)
+{
+	return (uint8_t*)p >= buf && (uint8_t*)p + l <= buf + len;
+}
+
+/** check that the result and its data are inside the buffer */
+static int
+resbuf_inside(struct ub_result* res, uint8_t* buf, int len)
+{
+	int i;
+	if(!resbuf_in(res, sizeof(*res), buf, len) ||
+		((size_t)res)%sizeof(void*) != 0 ||
+		!resbuf_in(res->qname, strlen(res->qname)+1, buf, len))
+		return 0;
+	if(res->answer_packet && !resbuf_in(res->answer_packet,
+		(size_t)res->answer_len, buf, len))
+		return 0;
+	if(!res->data)
+		return res->rcode != 0; /* no data list for an error */
+	for(i=0; res->data[i]; i++) {
+		if(!resbuf_in(res->data[i], (size_t)res->len[i], buf, len))
+			return 0;
+	}
+	return resbuf_in(res->data, sizeof(char*)*(size_t)(i+1), buf, len)
+		&& resbuf_in(res->len, sizeof(int)*(size_t)i, buf, len);
+}
+
+/** look up the names with the result in a buffer of the given size,
+ * and if it is too small again with the size that is returned, the
+ * answer from the cache can be larger, so that is tried a few times */
+static int
+resbuf_test(struct ub_ctx* ctx, int argc, char** argv, int size,
+	int unaligned)
+{
+	struct lookinfo info;
+	uint8_t* buf;
+	int i, r, len, buflen, try;
+	for(i=0; i<argc; i++) {
+		memset(&info, 0, sizeof(info));
+		info.name = argv[i];
+		len = buflen = size;
+		buf = (uint8_t*)malloc((size_t)len + unaligned);
+		if(!buf) {
+			printf("out of memory\n");
+			return 1;
+		}
+		fprintf(stderr, "lookup %s\n", argv[i]);
+		r = ub_resolve_buf(ctx, argv[i], LDNS_RR_TYPE_A,
+			LDNS_RR_CLASS_IN, buf+unaligned, &len, &info.result);
+		for(try=0; r == UB_NOSPACE && try<3; try++) {
+			printf("%s: buffer of %d too small, needs %d\n",
+				argv[i], buflen, len);
+			buflen = len;
+			free(buf);
+			buf = (uint8_t*)malloc((size_t)len + unaligned);
+			if(!buf) {
+				printf("out of memory\n");
+				return 1;
+			}
+			r = ub_resolve_buf(ctx, argv[i], LDNS_RR_TYPE_A,
+				LDNS_RR_CLASS_IN, buf+unaligned, &len,
+				&info.result);
+		}
+		info.err = r;
+		if(r == 0) {
+			if(!resbuf_inside(info.result, buf+unaligned, len)) {
+				printf("%s: result is not inside the buffer\n",
+					argv[i]);
+				return 1;
+			}
+			printf("%s: result in the buffer\n", argv[i]);
+		}
+		/* the result is not freed, it is in the buffer */
+		print_result(&info);
+		free(buf);
+	}
+	ub_ctx_delete(ctx);
+	checklock_stop();
+	return 0;
+}
+
 #ifdef THREADS_DISABLED
 /** only one process can communicate with async worker */
 #define NUMTHR 1
@@ -184,8 +343,14 @@ struct ext_thr_info {
 	int numq;
 	/** list of ids to free once threads are done */
 	struct track_id* id_list;
+	/** number of queries that were cancelled before the answer */
+	int num_cancel;
 };
 
+/** number of queries per thread in the extended test, the threads that
+ * cancel their queries start to do so after 100 queries */
+static int ext_numq = 100;
+
 /** if true, we are testing against 'localhost' and extra checking is done */
 static int q_is_localhost = 0;
 
@@ -259,6 +424,10 @@ ext_check_result(const char* desc, int err, struct ub_result* result)
 				desc);
 			exit(1);
 		}
+	} else if(result->rcode != 0 || !result->havedata) {
+		printf("%s: error %s has no answer, rcode %d.\n", desc,
+			result->qname, result->rcode);
+		exit(1);
 	}
 }
 
@@ -323,8 +492,10 @@ ext_thread(void* arg)
 			if(i > 100) {
 				lock_basic_lock(&async_ids[i-100].lock);
 				r = ub_cancel(inf->ctx, async_ids[i-100].id);
-				if(r != UB_NOID)
+				if(r != UB_NOID) {
 					async_ids[i-100].cancel=1;
+					inf->num_cancel++;
+				}
 				lock_basic_unlock(&async_ids[i-100].lock);
 				if(r != UB_NOID) 
 					checkerr("ub_cancel", r);
@@ -359,7 +530,7 @@ static int
 ext_test(struct ub_ctx* ctx, int argc, char** argv)
 {
 	struct ext_thr_info inf[NUMTHR];
-	int i;
+	int i, num_cancel;
 	if(argc == 1 && strcmp(argv[0], "localhost") == 0)
 		q_is_localhost = 1;
 	printf("extended test start (%d threads)\n", NUMTHR);
@@ -369,15 +540,18 @@ ext_test(struct ub_ctx* ctx, int argc, char** argv)
 		inf[i].ctx = ctx;
 		inf[i].argc = argc;
 		inf[i].argv = argv;
-		inf[i].numq = 100;
+		inf[i].numq = ext_numq;
 		inf[i].id_list = NULL;
+		inf[i].num_cancel = 0;
 		ub_thread_create(&inf[i].tid, ext_thread, &inf[i]);
 	}
 	/* the work happens here */
 	for(i=0; i<NUMTHR; i++) {
 		ub_thread_join(inf[i].tid);
 	}
-	printf("extended test end\n");
+	for(i=0, num_cancel=0; i<NUMTHR; i++)
+		num_cancel += inf[i].num_cancel;
+	printf("extended test end, %d queries cancelled\n", num_cancel);
 	/* free the id lists */
 	for(i=0; i<NUMTHR; i++) {
 		if(inf[i].id_list) {
@@ -393,6 +567,30 @@ ext_test(struct ub_ctx* ctx, int argc, char** argv)
 	return 0;
 }
 
+/** set an option in the form opt:val, like resolve-worker-pool:4 */
+static int
+set_option(struct ub_ctx* ctx, char* arg)
+{
+	char opt[128];
+	char* val = strchr(arg, ':');
+	int r;
+	if(!val || (size_t)(val-arg)+2 > sizeof(opt)) {
+		printf("bad option %s, use opt:val\n", arg);
+		return 0;
+	}
+	/* the option name is passed with the colon */
+	memmove(opt, arg, (size_t)(val-arg)+1);
+	opt[(val-arg)+1] = 0;
+	val++;
+	r = ub_ctx_set_option(ctx, opt, val);
+	if(r != 0) {
+		printf("ub_ctx_set_option %s %s: %s\n", opt, val,
+			ub_strerror(r));
+		return 0;
+	}
+	return 1;
+}
+
 /** getopt global, in case header files fail to declare it. */
 extern int optind;
 /** getopt global, in case header files fail to declare it. */
@@ -404,7 +602,8 @@ int main(int argc, char** argv)
 	int c;
 	struct ub_ctx* ctx;
 	struct lookinfo* lookups;
-	int i, r, cancel=0, blocking=0, ext=0;
+	int i, r, cancel=0, blocking=0, ext=0, batch=0, resbuf=0,
+		unaligned=0;
 
 	checklock_start();
 	/* init log now because solaris thr_key_create() is not threadsafe */
@@ -422,7 +621,7 @@ int main(int argc, char** argv)
 	if(argc == 1) {
 		usage(argv);
 	}
-	while( (c=getopt(argc, argv, "bcdf:hH:r:tx")) != -1) {
+	while( (c=getopt(argc, argv, "bBcdf:hH:n:o:r:R:tux")) != -1) {
 		switch(c) {
 			case 'd':
 				r = ub_ctx_debuglevel(ctx, 3);
@@ -438,6 +637,9 @@ int main(int argc, char** argv)
 			case 'b':
 				blocking = 1;
 				break;
+			case 'B':
+				batch = 1;
+				break;
 			case 'r':
 				r = ub_ctx_resolvconf(ctx, optarg);
 				if(r != 0) {
@@ -448,6 +650,12 @@ int main(int argc, char** argv)
 					return 1;
 				}
 				break;
+			case 'R':
+				resbuf = atoi(optarg);
+				break;
+			case 'u':
+				unaligned = 1;
+				break;
 			case 'H':
 				r = ub_ctx_hosts(ctx, optarg);
 				if(r != 0) {
@@ -462,6 +670,13 @@ int main(int argc, char** argv)
 				r = ub_ctx_set_fwd(ctx, optarg);
 				checkerr("ub_ctx_set_fwd", r);
 				break;
+			case 'n':
+				ext_numq = atoi(optarg);
+				break;
+			case 'o':
+				if(!set_option(ctx, optarg))
+					return 1;
+				break;
 			case 'x':
 				ext = 1;
 				break;
@@ -499,6 +714,10 @@ int main(int argc, char** argv)
 
 	if(ext)
 		return ext_test(ctx, argc, argv);
+	if(batch)
+		return batch_test(ctx, argc, argv, cancel);
+	if(resbuf)
+		return resbuf_test(ctx, argc, argv, resbuf, unaligned);
 
 	/* allocate array for results. */
 	lookups = (struct lookinfo*)calloc((size_t)argc, 
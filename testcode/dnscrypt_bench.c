@@ -0,0 +1,398 @@
+/*
+ * testcode/dnscrypt_bench.c - microbenchmark of the DNSCrypt packet path.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program measures what the DNSCrypt server code costs per packet.
+ * The key agreement for a new client, the crypto of a query and its reply,
+ * and the packets through dnsc_handle_curved_request and
+ * dnsc_handle_uncurved_request, like the worker does, with and without the
+ * shared secret cache of the thread. The certs and keys are read from the
+ * dnscrypt clause of a config file.
+ */
+
+#include "config.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#include <sys/time.h>
+#include "util/log.h"
+#include "util/locks.h"
+#include "util/config_file.h"
+#include "util/netevent.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#ifdef USE_DNSCRYPT
+#include "dnscrypt/dnscrypt.h"
+#include "dnscrypt/cert.h"
+
+/** usage information for dnscrypt-bench */
+static void usage(char* nm)
+{
+	printf("usage: %s [options] config\n", nm);
+	printf("config: with a dnscrypt clause, its certs and keys are used,\n");
+	printf("	like the one of testdata/dnscrypt_cert.tdir.\n");
+	printf("-n num	packets per thread, default 100000\n");
+	printf("-k num	client keys per thread, default 16\n");
+	printf("-t num	number of threads, default 1\n");
+	exit(1);
+}
+
+/** the query, www.example.com. A IN with RD */
+static const uint8_t bench_query[] = {
+	0x12, 0x34, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 'w', 'w', 'w', 0x07, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+	0x03, 'c', 'o', 'm', 0x00, 0x00, 0x01, 0x00, 0x01 };
+
+/** padded length of the query, the minimum of the protocol */
+#define BENCH_QUERY_PAD 256
+/** length of an encrypted query packet */
+#define BENCH_PKT_LEN (DNSCRYPT_QUERY_HEADER_SIZE + BENCH_QUERY_PAD)
+/** offset of the box in the packet, after the mac that it starts with */
+#define BENCH_BOX_OFFSET (DNSCRYPT_QUERY_HEADER_SIZE - crypto_box_MACBYTES)
+/** number of key agreements that are timed */
+#define BENCH_NUM_BEFORENM 1000
+
+/** the packets for a thread */
+struct bench_thr {
+	/** dnscrypt environment */
+	struct dnsc_env* env;
+	/** thread number for the log */
+	int thread_num;
+	/** thread id */
+	ub_thread_type tid;
+	/** if the thread uses a shared secret cache of its own */
+	int use_cache;
+	/** number of packets */
+	int num;
+	/** the packets, num of BENCH_PKT_LEN */
+	uint8_t* pkts;
+	/** number of packets that failed */
+	int failed;
+};
+
+/** time now, in microseconds */
+static double
+now_usec(void)
+{
+	struct timeval tv;
+	if(gettimeofday(&tv, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)tv.tv_sec*1000000. + (double)tv.tv_usec;
+}
+
+/** key agreement for the cert */
+static int
+bench_beforenm(const dnsccert* cert, uint8_t* nm, const uint8_t* pk,
+	const uint8_t* sk)
+{
+#ifdef USE_DNSCRYPT_XCHACHA20
+	if(cert->es_version[1] == 2)
+		return crypto_box_curve25519xchacha20poly1305_beforenm(nm,
+			pk, sk);
+#endif
+	return crypto_box_beforenm(nm, pk, sk);
+}
+
+/** encrypt for the cert */
+static int
+bench_seal(const dnsccert* cert, uint8_t* c, const uint8_t* m, size_t mlen,
+	const uint8_t* n, const uint8_t* nm)
+{
+#ifdef USE_DNSCRYPT_XCHACHA20
+	if(cert->es_version[1] == 2)
+		return crypto_box_curve25519xchacha20poly1305_easy_afternm(c,
+			m, mlen, n, nm);
+#endif
+	return crypto_box_easy_afternm(c, m, mlen, n, nm);
+}
+
+/** decrypt for the cert */
+static int
+bench_open(const dnsccert* cert, uint8_t* m, const uint8_t* c, size_t clen,
+	const uint8_t* n, const uint8_t* nm)
+{
+#ifdef USE_DNSCRYPT_XCHACHA20
+	if(cert->es_version[1] == 2)
+		return crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
+			m, c, clen, n, nm);
+#endif
+	return crypto_box_open_easy_afternm(m, c, clen, n, nm);
+}
+
+/** encrypted query packets from the clients for the cert, from keys client
+ * keys that take turns */
+static void
+bench_make_packets(const dnsccert* cert, struct bench_thr* t, int keys)
+{
+	uint8_t* pk = (uint8_t*)malloc((size_t)keys*crypto_box_PUBLICKEYBYTES);
+	uint8_t* nm = (uint8_t*)malloc((size_t)keys*crypto_box_BEFORENMBYTES);
+	uint8_t sk[crypto_box_SECRETKEYBYTES];
+	uint8_t m[BENCH_QUERY_PAD];
+	uint8_t nonce[crypto_box_NONCEBYTES];
+	int i, k;
+	t->pkts = (uint8_t*)malloc((size_t)t->num*BENCH_PKT_LEN);
+	if(!pk || !nm || !t->pkts)
+		fatal_exit("out of memory");
+	for(k=0; k<keys; k++) {
+		crypto_box_keypair(pk+k*crypto_box_PUBLICKEYBYTES, sk);
+		if(bench_beforenm(cert, nm+k*crypto_box_BEFORENMBYTES,
+			cert->keypair->crypt_publickey, sk) != 0)
+			fatal_exit("key agreement failed");
+	}
+	/* the query, the 0x80 byte and zeroes for padding */
+	memset(m, 0, sizeof(m));
+	memcpy(m, bench_query, sizeof(bench_query));
+	m[sizeof(bench_query)] = 0x80;
+	memset(nonce, 0, sizeof(nonce));
+	for(i=0; i<t->num; i++) {
+		uint8_t* p = t->pkts + (size_t)i*BENCH_PKT_LEN;
+		struct dnscrypt_query_header* h =
+			(struct dnscrypt_query_header*)p;
+		k = i%keys;
+		memcpy(h->magic_query, cert->magic_query,
+			DNSCRYPT_MAGIC_HEADER_LEN);
+		memcpy(h->publickey, pk+k*crypto_box_PUBLICKEYBYTES,
+			crypto_box_PUBLICKEYBYTES);
+		/* every packet has a new nonce, else it is a replay */
+		randombytes_buf(h->nonce, crypto_box_HALF_NONCEBYTES);
+		memcpy(nonce, h->nonce, crypto_box_HALF_NONCEBYTES);
+		if(bench_seal(cert, p+BENCH_BOX_OFFSET, m, sizeof(m), nonce,
+			nm+k*crypto_box_BEFORENMBYTES) != 0)
+			fatal_exit("encrypt failed");
+	}
+	free(pk);
+	free(nm);
+}
+
+/** handle the packets of the thread, like the worker does */
+static void*
+bench_thread(void* arg)
+{
+	struct bench_thr* t = (struct bench_thr*)arg;
+	struct dnsc_thread_cache* tc = NULL;
+	struct comm_point c;
+	struct comm_reply rep;
+	int i;
+	log_thread_set(&t->thread_num);
+	memset(&c, 0, sizeof(c));
+	c.type = comm_udp;
+	c.dnscrypt = 1;
+	c.buffer = sldns_buffer_new(65535);
+	c.dnscrypt_buffer = sldns_buffer_new(65535);
+	if(!c.buffer || !c.dnscrypt_buffer)
+		fatal_exit("out of memory");
+	if(t->use_cache && !(tc = dnsc_thread_cache_create()))
+		fatal_exit("out of memory");
+	for(i=0; i<t->num; i++) {
+		memset(&rep, 0, sizeof(rep));
+		rep.c = &c;
+		rep.max_udp_size = 1232;
+		sldns_buffer_clear(c.buffer);
+		sldns_buffer_write(c.buffer, t->pkts + (size_t)i*BENCH_PKT_LEN,
+			BENCH_PKT_LEN);
+		sldns_buffer_flip(c.buffer);
+		if(!dnsc_handle_curved_request(t->env, tc, &rep) ||
+			!rep.is_dnscrypted) {
+			t->failed++;
+			continue;
+		}
+		/* the reply is the query with the QR bit */
+		LDNS_QR_SET(sldns_buffer_begin(c.buffer));
+		if(!dnsc_handle_uncurved_request(&rep))
+			t->failed++;
+	}
+	dnsc_thread_cache_delete(tc);
+	sldns_buffer_free(c.buffer);
+	sldns_buffer_free(c.dnscrypt_buffer);
+	return NULL;
+}
+
+/** run the threads over their packets, prints the wall time per packet of
+ * all the threads */
+static void
+bench_packets(struct dnsc_env* env, const dnsccert* cert, int num, int keys,
+	int threads, int use_cache)
+{
+	struct bench_thr* t = (struct bench_thr*)calloc((size_t)threads,
+		sizeof(*t));
+	double start, usec;
+	int i, failed = 0;
+	if(!t)
+		fatal_exit("out of memory");
+	for(i=0; i<threads; i++) {
+		t[i].env = env;
+		t[i].thread_num = i+1;
+		t[i].use_cache = use_cache;
+		t[i].num = num;
+		bench_make_packets(cert, &t[i], keys);
+	}
+	start = now_usec();
+	if(threads == 1) {
+		(void)bench_thread(&t[0]);
+	} else {
+		for(i=0; i<threads; i++)
+			ub_thread_create(&t[i].tid, bench_thread, &t[i]);
+		for(i=0; i<threads; i++)
+			ub_thread_join(t[i].tid);
+	}
+	usec = now_usec() - start;
+	for(i=0; i<threads; i++) {
+		failed += t[i].failed;
+		free(t[i].pkts);
+	}
+	free(t);
+	printf("  packet, %s thread cache %9.3f usec, %d threads %.0f "
+		"packets/s\n", (use_cache?"with   ":"without"),
+		usec/((double)num*threads), threads,
+		(double)num*threads/usec*1000000.);
+	if(failed)
+		printf("  error: %d packets failed\n", failed);
+}
+
+/** time the crypto functions for the cert */
+static void
+bench_crypto(const dnsccert* cert, int num)
+{
+	uint8_t pk[crypto_box_PUBLICKEYBYTES], sk[crypto_box_SECRETKEYBYTES];
+	uint8_t nm[crypto_box_BEFORENMBYTES];
+	uint8_t m[BENCH_QUERY_PAD], c[BENCH_QUERY_PAD+crypto_box_MACBYTES];
+	uint8_t nonce[crypto_box_NONCEBYTES];
+	double start;
+	int i;
+
+	crypto_box_keypair(pk, sk);
+	start = now_usec();
+	for(i=0; i<BENCH_NUM_BEFORENM; i++) {
+		if(bench_beforenm(cert, nm, pk,
+			cert->keypair->crypt_secretkey) != 0)
+			fatal_exit("key agreement failed");
+		/* another client key every time */
+		pk[i%crypto_box_PUBLICKEYBYTES] ^= nm[0];
+	}
+	printf("  key agreement, new client   %9.3f usec\n",
+		(now_usec()-start)/BENCH_NUM_BEFORENM);
+
+	memset(m, 0, sizeof(m));
+	memset(nonce, 0, sizeof(nonce));
+	start = now_usec();
+	for(i=0; i<num; i++) {
+		/* the query is opened and the reply sealed */
+		nonce[0] = (uint8_t)i;
+		if(bench_seal(cert, c, m, sizeof(m), nonce, nm) != 0)
+			fatal_exit("encrypt failed");
+		if(bench_open(cert, m, c, sizeof(c), nonce, nm) != 0)
+			fatal_exit("decrypt failed");
+	}
+	printf("  crypto of query and reply   %9.3f usec\n",
+		(now_usec()-start)/num);
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for dnscrypt-bench */
+int main(int argc, char* argv[])
+{
+	int c, num = 100000, keys = 16, threads = 1;
+	struct config_file* cfg;
+	struct dnsc_env* env;
+	size_t i;
+	char* nm = argv[0];
+	log_init(NULL, 0, NULL);
+	while( (c=getopt(argc, argv, "hk:n:t:")) != -1) {
+		switch(c) {
+		case 'k':
+			keys = atoi(optarg);
+			break;
+		case 'n':
+			num = atoi(optarg);
+			break;
+		case 't':
+			threads = atoi(optarg);
+			break;
+		case 'h':
+		case '?':
+		default:
+			usage(nm);
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc != 1 || num < 1 || keys < 1 || threads < 1)
+		usage(nm);
+
+	if(!(cfg = config_create()))
+		fatal_exit("out of memory");
+	if(!config_read(cfg, argv[0], NULL))
+		fatal_exit("could not read config file %s", argv[0]);
+	if(!(env = dnsc_create()))
+		fatal_exit("dnsc_create failed");
+	(void)dnsc_apply_cfg(env, cfg);
+
+	printf("%d packets of %d bytes per thread, from %d client keys\n",
+		num, (int)BENCH_PKT_LEN, keys);
+	for(i=0; i<env->signed_certs_count; i++) {
+		const dnsccert* cert = &env->certs[i];
+#ifndef USE_DNSCRYPT_XCHACHA20
+		if(cert->es_version[1] == 2)
+			continue;
+#endif
+		printf("cert %d %s\n", (int)i, (cert->es_version[1] == 2?
+			"XChaCha20-Poly1305":"XSalsa20-Poly1305"));
+		bench_crypto(cert, num);
+		bench_packets(env, cert, num, keys, threads, 1);
+		bench_packets(env, cert, num, keys, threads, 0);
+	}
+	printf("shared secret cache misses %d, replays %d\n",
+		(int)env->num_query_dnscrypt_secret_missed_cache,
+		(int)env->num_query_dnscrypt_replay);
+	dnsc_delete(env);
+	config_delete(cfg);
+	return 0;
+}
+
+#else /* USE_DNSCRYPT */
+
+/** main program for dnscrypt-bench, without dnscrypt */
+int main(int ATTR_UNUSED(argc), char* ATTR_UNUSED(argv[]))
+{
+	printf("dnscrypt is not enabled, use configure --enable-dnscrypt\n");
+	return 1;
+}
+#endif /* USE_DNSCRYPT */
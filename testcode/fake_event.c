@@ -66,6 +66,7 @@
 #include "sldns/wire2str.h"
 #include "sldns/str2wire.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "daemon/daemon.h"
 #include "util/timeval_func.h"
 #include <signal.h>
@@ -1145,6 +1146,13 @@ outside_network_delete(struct outside_network* outnet)
 	free(outnet);
 }
 
+int
+outnet_latency_setup(struct outside_network* ATTR_UNUSED(outnet))
+{
+	/* the fake outside network has no upstream round trips */
+	return 1;
+}
+
 void
 outside_network_quit_prepare(struct outside_network* ATTR_UNUSED(outnet))
 {
@@ -1723,6 +1731,14 @@ void daemon_remote_stop_accept(struct daemon_remote* ATTR_UNUSED(rc))
 {
 }
 
+void daemon_metrics_start_accept(struct daemon_metrics* ATTR_UNUSED(m))
+{
+}
+
+void daemon_metrics_stop_accept(struct daemon_metrics* ATTR_UNUSED(m))
+{
+}
+
 int create_udp_sock(int ATTR_UNUSED(family), int ATTR_UNUSED(socktype),
 	struct sockaddr* ATTR_UNUSED(addr), socklen_t ATTR_UNUSED(addrlen),
 	int ATTR_UNUSED(v6only), int* ATTR_UNUSED(inuse),
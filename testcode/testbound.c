@@ -515,6 +515,22 @@ void daemon_remote_clear(struct daemon_remote* ATTR_UNUSED(rc))
 	/* nothing */
 }
 
+void daemon_remote_fast_reload_pause(struct worker* ATTR_UNUSED(worker))
+{
+	/* nothing */
+}
+
+void daemon_remote_fast_reload_done(struct worker* ATTR_UNUSED(worker))
+{
+	/* nothing */
+}
+
+void daemon_remote_fast_reload_cleanup(struct daemon_remote*
+	ATTR_UNUSED(rc))
+{
+	/* nothing */
+}
+
 int daemon_remote_open_accept(struct daemon_remote* ATTR_UNUSED(rc),
         struct listen_port* ATTR_UNUSED(ports), struct worker* worker)
 {
@@ -523,6 +539,37 @@ int daemon_remote_open_accept(struct daemon_remote* ATTR_UNUSED(rc),
 	return 1;
 }
 
+/* fake metrics listener */
+struct listen_port* daemon_metrics_open_ports(struct config_file*
+	ATTR_UNUSED(cfg))
+{
+	return NULL;
+}
+
+struct daemon_metrics* daemon_metrics_create(struct config_file*
+	ATTR_UNUSED(cfg))
+{
+	return (struct daemon_metrics*)calloc(1,
+		sizeof(struct daemon_metrics));
+}
+
+void daemon_metrics_delete(struct daemon_metrics* m)
+{
+	free(m);
+}
+
+void daemon_metrics_clear(struct daemon_metrics* ATTR_UNUSED(m))
+{
+	/* nothing */
+}
+
+int daemon_metrics_open_accept(struct daemon_metrics* ATTR_UNUSED(m),
+	struct listen_port* ATTR_UNUSED(ports),
+	struct worker* ATTR_UNUSED(worker))
+{
+	return 1;
+}
+
 int remote_accept_callback(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(repinfo))
@@ -539,11 +586,32 @@ int remote_control_callback(struct comm_point* ATTR_UNUSED(c),
 	return 0;
 }
 
+int metrics_accept_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
+int metrics_http_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
 void remote_get_opt_ssl(char* ATTR_UNUSED(str), void* ATTR_UNUSED(arg))
 {
         log_assert(0);
 }
 
+void remote_fast_reload_retired_delete(void* ATTR_UNUSED(arg))
+{
+        log_assert(0);
+}
+
 #ifdef UB_ON_WINDOWS
 void wsvc_command_option(const char* ATTR_UNUSED(wopt), 
 	const char* ATTR_UNUSED(cfgfile), int ATTR_UNUSED(v), 
@@ -629,11 +697,18 @@ int doq_stream_cmp(const void* ATTR_UNUSED(key1), const void* ATTR_UNUSED(key2))
 }
 
 struct doq_table* doq_table_create(struct config_file* ATTR_UNUSED(cfg),
-	struct ub_randstate* ATTR_UNUSED(rnd))
+	struct ub_randstate* ATTR_UNUSED(rnd), int ATTR_UNUSED(owner),
+	int ATTR_UNUSED(num_tables))
 {
 	return calloc(1, sizeof(struct doq_table));
 }
 
+int listening_ports_doq_steer(struct listen_port* ATTR_UNUSED(list),
+	int ATTR_UNUSED(num))
+{
+	return 0;
+}
+
 void doq_table_delete(struct doq_table* table)
 {
 	free(table);
@@ -44,8 +44,16 @@
 #ifdef HAVE_NGTCP2
 
 #include "util/netevent.h"
+#include "util/config_file.h"
+#include "util/random.h"
+#include "util/net_help.h"
+#include "util/log.h"
 #include "services/listen_dnsport.h"
+#include "sldns/sbuffer.h"
 #include "testcode/unitmain.h"
+#ifdef HAVE_NETINET_UDP_H
+#include <netinet/udp.h>
+#endif
 
 /** check the size of a connection for doq */
 static void
@@ -76,9 +84,494 @@ doq_size_conn_check()
 		conid_size*3 + stream_size));
 }
 
+/** check the doq tables of the workers, the owner and the memory part */
+static void
+doq_table_owner_check(void)
+{
+	struct config_file* cfg = config_create();
+	struct ub_randstate* rnd = ub_initstate(NULL);
+	struct doq_table* shared, *owned;
+	unit_assert(cfg && rnd);
+	cfg->quic_size = 4000;
+	shared = doq_table_create(cfg, rnd, -1, 1);
+	owned = doq_table_create(cfg, rnd, 2, 4);
+	unit_assert(shared && owned);
+	unit_assert(shared->owner == -1 && shared->num_tables == 1);
+	unit_assert(owned->owner == 2 && owned->num_tables == 4);
+	/* the shared table has all of quic-size, the worker a quarter */
+	unit_assert(doq_table_quic_size_available(shared, cfg, 3000));
+	unit_assert(doq_table_quic_size_available(owned, cfg, 1000));
+	unit_assert(!doq_table_quic_size_available(owned, cfg, 1001));
+	doq_table_delete(shared);
+	doq_table_delete(owned);
+	ub_randfree(rnd);
+	config_delete(cfg);
+}
+
+/** number of sockets in the reuseport group of the steer check */
+#define STEER_NUM 4
+
+/** send a quic packet with the first dcid byte, and return the number
+ * of the socket that receives it, or -1 */
+static int
+doq_steer_recv(int* fds, int cfd, struct sockaddr_in* addr, int longhdr,
+	uint8_t cid0)
+{
+	uint8_t pkt[64], buf[64];
+	fd_set rset;
+	struct timeval tv;
+	int i, maxfd = -1;
+	memset(pkt, 0, sizeof(pkt));
+	if(longhdr) {
+		/* flags, version, dcid len, dcid */
+		pkt[0] = 0xc0;
+		pkt[4] = 1;
+		pkt[5] = 16;
+		pkt[6] = cid0;
+	} else {
+		/* flags, dcid */
+		pkt[0] = 0x40;
+		pkt[1] = cid0;
+	}
+	if(sendto(cfd, (void*)pkt, sizeof(pkt), 0, (struct sockaddr*)addr,
+		(socklen_t)sizeof(*addr)) < 0)
+		return -1;
+	FD_ZERO(&rset);
+	for(i=0; i<STEER_NUM; i++) {
+		FD_SET(fds[i], &rset);
+		if(fds[i] > maxfd)
+			maxfd = fds[i];
+	}
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+	if(select(maxfd+1, &rset, NULL, NULL, &tv) <= 0)
+		return -1;
+	for(i=0; i<STEER_NUM; i++) {
+		if(FD_ISSET(fds[i], &rset)) {
+			(void)recv(fds[i], (void*)buf, sizeof(buf), 0);
+			return i;
+		}
+	}
+	return -1;
+}
+
+/** check that the steering program sends the packets to the socket
+ * with the number in the first byte of the connection id */
+static void
+doq_steer_check(void)
+{
+#ifdef SO_REUSEPORT
+	struct listen_port port;
+	struct sockaddr_in addr;
+	socklen_t len = (socklen_t)sizeof(addr);
+	int fds[STEER_NUM], cfd, i, on = 1;
+	memset(&port, 0, sizeof(port));
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	/* the sockets join the group in order, like the threads */
+	for(i=0; i<STEER_NUM; i++) {
+		fds[i] = socket(AF_INET, SOCK_DGRAM, 0);
+		unit_assert(fds[i] != -1);
+		unit_assert(setsockopt(fds[i], SOL_SOCKET, SO_REUSEPORT,
+			(void*)&on, (socklen_t)sizeof(on)) == 0);
+		unit_assert(bind(fds[i], (struct sockaddr*)&addr,
+			(socklen_t)sizeof(addr)) == 0);
+		if(i == 0)
+			unit_assert(getsockname(fds[0], (struct sockaddr*)
+				&addr, &len) == 0);
+	}
+	/* the program is for the group, it is attached with one socket */
+	port.fd = fds[0];
+	port.ftype = listen_type_doq;
+	if(!listening_ports_doq_steer(&port, STEER_NUM)) {
+		printf("doq steering is not available\n");
+	} else {
+		cfd = socket(AF_INET, SOCK_DGRAM, 0);
+		unit_assert(cfd != -1);
+		for(i=0; i<STEER_NUM*2; i++) {
+			unit_assert(doq_steer_recv(fds, cfd, &addr, 0,
+				(uint8_t)i) == i%STEER_NUM);
+			unit_assert(doq_steer_recv(fds, cfd, &addr, 1,
+				(uint8_t)i) == i%STEER_NUM);
+		}
+		sock_close(cfd);
+	}
+	for(i=0; i<STEER_NUM; i++)
+		sock_close(fds[i]);
+#endif /* SO_REUSEPORT */
+}
+
+/** create a comm point with the doq socket buffers that the packet send
+ * and receive routines use, for the fd */
+static struct comm_point*
+doq_test_cp_create(int fd)
+{
+	struct comm_point* c = calloc(1, sizeof(*c));
+	unit_assert(c);
+	c->fd = fd;
+	c->doq_socket = calloc(1, sizeof(*c->doq_socket));
+	unit_assert(c->doq_socket);
+	c->doq_socket->pkt_buf = sldns_buffer_new(4096);
+	c->doq_socket->blocked_pkt = sldns_buffer_new(DOQ_GSO_BUFFER_SIZE);
+	c->doq_socket->blocked_paddr = calloc(1,
+		sizeof(*c->doq_socket->blocked_paddr));
+	c->doq_socket->blocked_next = sldns_buffer_new(4096);
+	c->doq_socket->gro_paddr = calloc(1,
+		sizeof(*c->doq_socket->gro_paddr));
+	unit_assert(c->doq_socket->pkt_buf && c->doq_socket->blocked_pkt &&
+		c->doq_socket->blocked_paddr && c->doq_socket->blocked_next &&
+		c->doq_socket->gro_paddr);
+	return c;
+}
+
+/** delete the comm point of the packet checks, and close the fd */
+static void
+doq_test_cp_delete(struct comm_point* c)
+{
+	sldns_buffer_free(c->doq_socket->pkt_buf);
+	sldns_buffer_free(c->doq_socket->blocked_pkt);
+	free(c->doq_socket->blocked_paddr);
+	sldns_buffer_free(c->doq_socket->blocked_next);
+	sldns_buffer_free(c->doq_socket->gro_buf);
+	free(c->doq_socket->gro_paddr);
+	sock_close(c->fd);
+	free(c->doq_socket);
+	free(c);
+}
+
+/** make a batch of num packets of len bytes, the last is lastlen bytes.
+ * Every byte of a packet is the packet number. */
+static void
+doq_test_batch(struct sldns_buffer* buf, int num, size_t len, size_t lastlen)
+{
+	int i;
+	sldns_buffer_clear(buf);
+	for(i=0; i<num; i++) {
+		size_t n = (i == num-1)?lastlen:len;
+		memset(sldns_buffer_current(buf), i, n);
+		sldns_buffer_skip(buf, (ssize_t)n);
+	}
+	sldns_buffer_flip(buf);
+}
+
+/** wait until the fd is readable, with a timeout of a second */
+static int
+doq_test_wait(int fd)
+{
+	fd_set rset;
+	struct timeval tv;
+	FD_ZERO(&rset);
+	FD_SET(fd, &rset);
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+	return select(fd+1, &rset, NULL, NULL, &tv) > 0;
+}
+
+/** receive a packet and check the packet number and the length */
+static void
+doq_test_recv_pkt(int fd, int num, size_t len)
+{
+	uint8_t buf[4096];
+	ssize_t r;
+	unit_assert(doq_test_wait(fd));
+	r = recv(fd, (void*)buf, sizeof(buf), MSG_DONTWAIT);
+	unit_assert(r == (ssize_t)len);
+	unit_assert(buf[0] == (uint8_t)num && buf[len-1] == (uint8_t)num);
+}
+
+/** create the sending and receiving UDP socket on the loopback, for the
+ * protocol. Returns false if the socket cannot be created. */
+static int
+doq_test_udp_pair(int proto, int* sfd, int* rfd, struct sockaddr_in* addr)
+{
+	socklen_t len = (socklen_t)sizeof(*addr);
+	memset(addr, 0, sizeof(*addr));
+	addr->sin_family = AF_INET;
+	addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if((*rfd = socket(AF_INET, SOCK_DGRAM, proto)) == -1)
+		return 0;
+	unit_assert(bind(*rfd, (struct sockaddr*)addr,
+		(socklen_t)sizeof(*addr)) == 0);
+	unit_assert(getsockname(*rfd, (struct sockaddr*)addr, &len) == 0);
+	*sfd = socket(AF_INET, SOCK_DGRAM, proto);
+	unit_assert(*sfd != -1);
+	return 1;
+}
+
+/** set the packet address to send to addr, from the loopback */
+static void
+doq_test_paddr(struct doq_pkt_addr* paddr, struct sockaddr_in* addr)
+{
+	struct sockaddr_in* local = (struct sockaddr_in*)&paddr->localaddr;
+	memset(paddr, 0, sizeof(*paddr));
+	memmove(&paddr->addr, addr, sizeof(*addr));
+	paddr->addrlen = (socklen_t)sizeof(*addr);
+	local->sin_family = AF_INET;
+	local->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	paddr->localaddrlen = (socklen_t)sizeof(*local);
+}
+
+/** check the send of a batch of packets with UDP GSO, and the send one by
+ * one when the kernel rejects the segmented send */
+static void
+doq_gso_send_check(void)
+{
+#ifdef UDP_SEGMENT
+	struct comm_point* c;
+	struct doq_pkt_addr paddr;
+	struct sockaddr_in addr;
+	struct sldns_buffer* buf = sldns_buffer_new(DOQ_GSO_BUFFER_SIZE);
+	int sfd, rfd, i;
+	unit_assert(buf);
+
+	/* the loopback takes the segmented send, the packets arrive
+	 * one by one */
+	unit_assert(doq_test_udp_pair(0, &sfd, &rfd, &addr));
+	c = doq_test_cp_create(sfd);
+	c->doq_socket->gso = 1;
+	doq_test_paddr(&paddr, &addr);
+	doq_test_batch(buf, 3, 100, 50);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	unit_assert(c->doq_socket->gso == 1);
+	unit_assert(!c->doq_socket->have_blocked_pkt);
+	for(i=0; i<3; i++)
+		doq_test_recv_pkt(rfd, i, (i==2?50:100));
+	doq_test_cp_delete(c);
+	sock_close(rfd);
+
+#ifdef IPPROTO_UDPLITE
+	/* UDP-Lite has no segmentation offload, the send fails with EIO
+	 * like a device without checksum offload. Then gso is turned off,
+	 * and the batch is sent one by one. */
+	if(!doq_test_udp_pair(IPPROTO_UDPLITE, &sfd, &rfd, &addr)) {
+		printf("doq gso fallback not checked, no udplite\n");
+		sldns_buffer_free(buf);
+		return;
+	}
+	c = doq_test_cp_create(sfd);
+	c->doq_socket->gso = 1;
+	doq_test_paddr(&paddr, &addr);
+	doq_test_batch(buf, 3, 100, 50);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	unit_assert(c->doq_socket->gso == 0);
+	unit_assert(!c->doq_socket->have_blocked_pkt);
+	for(i=0; i<3; i++)
+		doq_test_recv_pkt(rfd, i, (i==2?50:100));
+	/* and the next batch goes one by one straight away */
+	doq_test_batch(buf, 2, 100, 100);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	for(i=0; i<2; i++)
+		doq_test_recv_pkt(rfd, i, 100);
+	doq_test_cp_delete(c);
+	sock_close(rfd);
+#endif /* IPPROTO_UDPLITE */
+	sldns_buffer_free(buf);
+#endif /* UDP_SEGMENT */
+}
+
+/** fill the receive queue of the datagram socket pair until the send
+ * blocks, return the number of datagrams */
+static int
+doq_test_fill(int sfd)
+{
+	uint8_t b = 0xff;
+	int num = 0;
+	while(send(sfd, (void*)&b, 1, MSG_DONTWAIT) == 1) {
+		num++;
+		unit_assert(num < 100000);
+	}
+	unit_assert(errno == EAGAIN || errno == EWOULDBLOCK);
+	return num;
+}
+
+/** drain num fill datagrams from the socket */
+static void
+doq_test_drain(int rfd, int num)
+{
+	uint8_t b;
+	int i;
+	for(i=0; i<num; i++) {
+		unit_assert(recv(rfd, (void*)&b, 1, MSG_DONTWAIT) == 1);
+		unit_assert(b == 0xff);
+	}
+}
+
+/** check that packets are stored when the send blocks part way through a
+ * batch, with the packet after the batch, and sent in order later */
+static void
+doq_blocked_send_check(void)
+{
+	struct comm_point* c;
+	struct doq_pkt_addr paddr;
+	struct sockaddr_in addr;
+	struct sldns_buffer* buf = sldns_buffer_new(DOQ_GSO_BUFFER_SIZE);
+	uint8_t next[50];
+	uint8_t big[1024];
+	int fds[2], num, sent, i;
+	unit_assert(buf);
+	/* A unix datagram socket pair blocks the send when the receive
+	 * queue is full, that is hard to get on the UDP loopback. The
+	 * pair has no use for the addresses, the send ignores the IP
+	 * ancillary data, and the ecn setsockopt fails, that is logged. */
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	memset(next, 6, sizeof(next));
+	log_file(NULL);
+
+	/* the packets are sent one by one, and the send blocks after
+	 * a couple */
+	unit_assert(socketpair(AF_UNIX, SOCK_DGRAM, 0, fds) == 0);
+	c = doq_test_cp_create(fds[0]);
+	c->doq_socket->gso = 0;
+	doq_test_paddr(&paddr, &addr);
+	paddr.addrlen = 0;
+	num = doq_test_fill(fds[0]);
+	doq_test_drain(fds[1], 2);
+	num -= 2;
+	doq_test_batch(buf, 6, 100, 100);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	unit_assert(c->doq_socket->have_blocked_pkt);
+	unit_assert(c->doq_socket->blocked_pkt_gso == 100);
+	unit_assert(sldns_buffer_limit(c->doq_socket->blocked_pkt) % 100 == 0);
+	sent = 6 - (int)sldns_buffer_limit(c->doq_socket->blocked_pkt)/100;
+	unit_assert(sent >= 1 && sent < 6);
+	unit_assert(sldns_buffer_read_u8_at(c->doq_socket->blocked_pkt, 0)
+		== sent);
+	doq_store_blocked_next(c, 0, next, sizeof(next));
+	unit_assert(c->doq_socket->have_blocked_next);
+	/* a second packet after the batch does not fit, it is dropped */
+	doq_store_blocked_next(c, 0, next, 10);
+	unit_assert(sldns_buffer_limit(c->doq_socket->blocked_next) ==
+		sizeof(next));
+	doq_test_drain(fds[1], num);
+	for(i=0; i<sent; i++)
+		doq_test_recv_pkt(fds[1], i, 100);
+	unit_assert(doq_write_blocked_pkt(c));
+	unit_assert(!c->doq_socket->have_blocked_pkt);
+	unit_assert(!c->doq_socket->have_blocked_next);
+	for(i=sent; i<6; i++)
+		doq_test_recv_pkt(fds[1], i, 100);
+	doq_test_recv_pkt(fds[1], 6, sizeof(next));
+	unit_assert(recv(fds[1], (void*)big, sizeof(big), MSG_DONTWAIT)
+		== -1);
+
+	/* with gso the batch is stored as a whole, with the segment size.
+	 * The unix socket ignores the UDP_SEGMENT data, the batch arrives
+	 * in one datagram. */
+	c->doq_socket->gso = 1;
+	num = doq_test_fill(fds[0]);
+	doq_test_batch(buf, 3, 100, 50);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	unit_assert(c->doq_socket->have_blocked_pkt);
+	unit_assert(c->doq_socket->blocked_pkt_gso == 100);
+	unit_assert(sldns_buffer_limit(c->doq_socket->blocked_pkt) == 250);
+	doq_store_blocked_next(c, 0, next, sizeof(next));
+	/* still blocked, it stays stored */
+	unit_assert(!doq_write_blocked_pkt(c));
+	unit_assert(c->doq_socket->have_blocked_pkt);
+	unit_assert(c->doq_socket->have_blocked_next);
+	doq_test_drain(fds[1], num);
+	unit_assert(doq_write_blocked_pkt(c));
+	unit_assert(!c->doq_socket->have_blocked_pkt &&
+		!c->doq_socket->have_blocked_next);
+	unit_assert(recv(fds[1], (void*)big, sizeof(big), MSG_DONTWAIT)
+		== 250);
+	unit_assert(big[0] == 0 && big[100] == 1 && big[249] == 2);
+	doq_test_recv_pkt(fds[1], 6, sizeof(next));
+
+	log_file(stderr);
+	doq_test_cp_delete(c);
+	sock_close(fds[1]);
+	sldns_buffer_free(buf);
+}
+
+/** check the receive of coalesced packets with UDP GRO, and the drop of
+ * a truncated receive */
+static void
+doq_gro_recv_check(void)
+{
+#if defined(UDP_GRO) && defined(UDP_SEGMENT)
+	struct comm_point* c, *rc;
+	struct doq_pkt_addr paddr;
+	struct ngtcp2_pkt_info pi;
+	struct sockaddr_in addr;
+	struct sldns_buffer* buf = sldns_buffer_new(DOQ_GSO_BUFFER_SIZE);
+	int sfd, rfd, i, on = 1, pkt_continue;
+	unit_assert(buf);
+	unit_assert(doq_test_udp_pair(0, &sfd, &rfd, &addr));
+	if(setsockopt(rfd, IPPROTO_UDP, UDP_GRO, (void*)&on,
+		(socklen_t)sizeof(on)) < 0) {
+		printf("doq gro receive not checked, no UDP_GRO\n");
+		sock_close(sfd);
+		sock_close(rfd);
+		sldns_buffer_free(buf);
+		return;
+	}
+	c = doq_test_cp_create(sfd);
+	c->doq_socket->gso = 1;
+	rc = doq_test_cp_create(rfd);
+	rc->doq_socket->gro = 1;
+	rc->doq_socket->gro_buf = sldns_buffer_new(DOQ_GRO_BUFFER_SIZE);
+	unit_assert(rc->doq_socket->gro_buf);
+	sldns_buffer_clear(rc->doq_socket->gro_buf);
+	sldns_buffer_flip(rc->doq_socket->gro_buf);
+	doq_test_paddr(&paddr, &addr);
+
+	/* the segmented send arrives coalesced, and is returned one by
+	 * one */
+	doq_test_batch(buf, 3, 100, 50);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	unit_assert(doq_test_wait(rfd));
+	for(i=0; i<3; i++) {
+		struct sldns_buffer* pkt = rc->doq_socket->pkt_buf;
+		doq_pkt_addr_init(&paddr);
+		pkt_continue = 0;
+		unit_assert(doq_recv(rc, &paddr, &pkt_continue, &pi));
+		unit_assert(sldns_buffer_limit(pkt) == (i==2?50:100));
+		unit_assert(sldns_buffer_read_u8_at(pkt, 0) == i);
+		unit_assert(paddr.addr.sockaddr.in.sin_family == AF_INET);
+	}
+	unit_assert(rc->doq_socket->gro_size == 100);
+	doq_pkt_addr_init(&paddr);
+	pkt_continue = 1;
+	unit_assert(!doq_recv(rc, &paddr, &pkt_continue, &pi));
+	unit_assert(!pkt_continue);
+
+	/* the coalesced packets do not fit, the truncated read is
+	 * dropped */
+	sldns_buffer_free(rc->doq_socket->gro_buf);
+	rc->doq_socket->gro_buf = sldns_buffer_new(200);
+	unit_assert(rc->doq_socket->gro_buf);
+	sldns_buffer_clear(rc->doq_socket->gro_buf);
+	sldns_buffer_flip(rc->doq_socket->gro_buf);
+	doq_test_paddr(&paddr, &addr);
+	doq_test_batch(buf, 3, 100, 50);
+	doq_send_pkts(c, &paddr, 0, buf, 100);
+	unit_assert(doq_test_wait(rfd));
+	doq_pkt_addr_init(&paddr);
+	pkt_continue = 0;
+	unit_assert(!doq_recv(rc, &paddr, &pkt_continue, &pi));
+	unit_assert(pkt_continue);
+	unit_assert(sldns_buffer_remaining(rc->doq_socket->gro_buf) == 0);
+	pkt_continue = 1;
+	unit_assert(!doq_recv(rc, &paddr, &pkt_continue, &pi));
+	unit_assert(!pkt_continue);
+
+	doq_test_cp_delete(c);
+	doq_test_cp_delete(rc);
+	sldns_buffer_free(buf);
+#endif /* UDP_GRO && UDP_SEGMENT */
+}
+
 void doq_test(void)
 {
 	unit_show_feature("doq");
 	doq_size_conn_check();
+	doq_table_owner_check();
+	doq_steer_check();
+	doq_gso_send_check();
+	doq_blocked_send_check();
+	doq_gro_recv_check();
 }
 #endif /* HAVE_NGTCP2 */
@@ -69,7 +69,9 @@
 /** number of tests done */
 int testcount = 0;
 
+#include <sys/time.h>
 #include "util/alloc.h"
+#include "util/data/packed_rrset.h"
 /** test alloc code */
 static void
 alloc_test(void) {
@@ -99,15 +101,187 @@ alloc_test(void) {
 		alloc_stats(&minor2);
 		alloc_stats(&major);
 	}
-	/* reuse happened */
-	unit_assert(minor1.num_quar + minor2.num_quar + major.num_quar == 11);
+	/* reuse happened, minor2 keeps up to twice the batch, so
+	 * minor1 allocated a second batch */
+	unit_assert(minor1.num_quar + minor2.num_quar + major.num_quar == 22);
 
 	alloc_clear(&minor1);
 	alloc_clear(&minor2);
-	unit_assert(major.num_quar == 11);
+	unit_assert(major.num_quar == 22);
 	alloc_clear(&major);
 }
 
+/** count the special types in the alloc cache lists */
+static size_t
+alloc_count_special(struct alloc_cache* alloc)
+{
+	alloc_special_type* p, *m;
+	size_t n = 0;
+	for(p = alloc->quar; p; p = alloc_special_next(p))
+		n++;
+	for(m = alloc->mags; m; m = alloc_special_nextmag(m)) {
+		size_t k = 0;
+		for(p = m; p; p = alloc_special_next(p))
+			k++;
+		unit_assert(k == alloc_special_magsize(m));
+		n += k;
+	}
+	return n;
+}
+
+/** test that alloc moves magazines between the thread and the super */
+static void
+alloc_batch_test(void)
+{
+	alloc_special_type* t[100];
+	struct alloc_cache major, minor;
+	int i;
+
+	unit_show_feature("alloc magazines");
+	alloc_init(&major, NULL, 0);
+	alloc_init(&minor, &major, 1);
+	alloc_set_special_batch(&minor, 8);
+	unit_assert(minor.special_batch == 8);
+
+	/* the first obtain allocates a batch, plus the one returned */
+	t[0] = alloc_special_obtain(&minor);
+	unit_assert(t[0] && t[0]->id != 0);
+	unit_assert(minor.num_quar == 8);
+	for(i=1; i<100; i++) {
+		t[i] = alloc_special_obtain(&minor);
+		unit_assert(t[i] && t[i] != t[i-1]);
+	}
+	/* the thread keeps up to twice the batch, the rest is in
+	 * magazines of the batch size */
+	for(i=0; i<100; i++)
+		alloc_special_release(&minor, t[i]);
+	unit_assert(minor.num_quar <= 16);
+	unit_assert(major.num_mags > 0 && major.quar == NULL);
+	unit_assert(major.num_quar == major.num_mags*8);
+	unit_assert(alloc_count_special(&major) == major.num_quar);
+	/* 12 times a batch of 8 plus the one returned */
+	unit_assert(minor.num_quar + major.num_quar == 108);
+
+	/* an empty thread cache takes a whole magazine */
+	for(i=0; i<100; i++)
+		t[i] = alloc_special_obtain(&minor);
+	unit_assert(minor.num_quar + major.num_quar == 8);
+	for(i=0; i<100; i++)
+		alloc_special_release(&minor, t[i]);
+	alloc_clear(&minor);
+	unit_assert(major.quar != NULL);
+	unit_assert(alloc_count_special(&major) == 108);
+	unit_assert(major.num_quar == 108);
+	alloc_clear(&major);
+	unit_assert(major.num_quar == 0 && major.num_mags == 0);
+
+	/* loose items from a cleared thread are taken in a batch */
+	alloc_init(&major, NULL, 0);
+	alloc_init(&minor, &major, 1);
+	alloc_set_special_batch(&minor, 20);
+	for(i=0; i<12; i++)
+		t[i] = alloc_special_obtain(&minor);
+	for(i=0; i<12; i++)
+		alloc_special_release(&minor, t[i]);
+	alloc_clear(&minor);
+	unit_assert(major.num_mags == 0 && major.num_quar == 21);
+	alloc_init(&minor, &major, 1);
+	alloc_set_special_batch(&minor, 8);
+	t[0] = alloc_special_obtain(&minor);
+	unit_assert(minor.num_quar == 7 && major.num_quar == 13);
+	alloc_special_release(&minor, t[0]);
+	alloc_clear(&minor);
+	unit_assert(alloc_count_special(&major) == 21);
+	alloc_clear(&major);
+}
+
+/** number of threads in the alloc contention test */
+#define ALLOC_THR_NUM 8
+/** number of special types that a thread holds at once */
+#define ALLOC_THR_HOLD 200
+/** number of rounds of obtain and release per thread */
+#define ALLOC_THR_ROUNDS 200
+
+/** thread for the alloc contention test */
+struct alloc_thr {
+	/** thread number */
+	int num;
+	/** thread id */
+	ub_thread_type id;
+	/** the thread alloc cache */
+	struct alloc_cache alloc;
+	/** number of items that were not obtained, or that were changed
+	 * by another thread while this thread held them. The thread does
+	 * not call unit_assert, the main thread checks this. */
+	int bad;
+};
+
+/** obtain and release special types, like cache misses and deletes */
+static void*
+alloc_thr_main(void* arg)
+{
+	struct alloc_thr* t = (struct alloc_thr*)arg;
+	alloc_special_type* h[ALLOC_THR_HOLD];
+	int r, i;
+	log_thread_set(&t->num);
+	for(r=0; r<ALLOC_THR_ROUNDS; r++) {
+		for(i=0; i<ALLOC_THR_HOLD; i++) {
+			h[i] = alloc_special_obtain(&t->alloc);
+			if(!h[i] || h[i]->id == 0) {
+				t->bad++;
+				return NULL;
+			}
+			h[i]->rk.type = (uint16_t)t->num;
+			h[i]->entry.hash = (uint32_t)i;
+		}
+		for(i=0; i<ALLOC_THR_HOLD; i++) {
+			/* not handed out to another thread as well */
+			if(h[i]->rk.type != (uint16_t)t->num ||
+				h[i]->entry.hash != (uint32_t)i)
+				t->bad++;
+			alloc_special_release(&t->alloc, h[i]);
+		}
+	}
+	return NULL;
+}
+
+/** run the alloc contention test with the batch size */
+static void
+alloc_contention_run(size_t batch)
+{
+	struct alloc_cache major;
+	struct alloc_thr t[ALLOC_THR_NUM];
+	int i;
+	alloc_init(&major, NULL, 0);
+	for(i=0; i<ALLOC_THR_NUM; i++) {
+		t[i].num = i+1;
+		t[i].bad = 0;
+		alloc_init(&t[i].alloc, &major, i+1);
+		alloc_set_special_batch(&t[i].alloc, batch);
+	}
+	for(i=0; i<ALLOC_THR_NUM; i++)
+		ub_thread_create(&t[i].id, alloc_thr_main, &t[i]);
+	for(i=0; i<ALLOC_THR_NUM; i++)
+		ub_thread_join(t[i].id);
+	for(i=0; i<ALLOC_THR_NUM; i++) {
+		unit_assert(t[i].bad == 0);
+		alloc_clear(&t[i].alloc);
+	}
+	/* every item is back in the super, and counted once */
+	unit_assert(alloc_count_special(&major) == major.num_quar);
+	unit_assert(major.num_quar >= ALLOC_THR_HOLD);
+	alloc_clear(&major);
+}
+
+/** test the threads that exchange items with the super at the same time */
+static void
+alloc_contention_test(void)
+{
+	unit_show_feature("alloc contention");
+	alloc_contention_run(1);
+	alloc_contention_run(64);
+}
+
 #include "util/net_help.h"
 /** test net code */
 static void 
@@ -404,6 +578,7 @@ config_tag_test(void)
 	
 #include "util/rtt.h"
 #include "util/timehist.h"
+#include "util/topk.h"
 #include "iterator/iterator.h"
 #include "libunbound/unbound.h"
 /** test RTT code */
@@ -429,10 +604,147 @@ rtt_test(void)
 		unit_assert( rtt_timeout(&r) > RTT_MIN_TIMEOUT-1);
 		unit_assert( rtt_timeout(&r) < RTT_MAX_TIMEOUT+1);
 	}
+	/* the percentile estimate is below the timeout, and above the
+	 * smoothed rtt once the server is steady */
+	rtt_init(&r);
+	for(i=0; i<100; i++)
+		rtt_update(&r, 100 + (i%2)*40);
+	unit_assert( rtt_p95(&r) > r.srtt );
+	unit_assert( rtt_p95(&r) < rtt_notimeout(&r) );
+	unit_assert( rtt_p95(&r) >= 120 && rtt_p95(&r) <= 200 );
+	unit_assert( rtt_p50(&r) >= 100 && rtt_p50(&r) <= 140 );
+	rtt_init(&r);
+	rtt_update(&r, 1);
+	rtt_update(&r, 1);
+	unit_assert( rtt_p95(&r) >= RTT_MIN_TIMEOUT );
+	unit_assert( rtt_p50(&r) == -1 );
+	/* a slow tail on one in ten replies moves the 95th percentile, but
+	 * not the median */
+	rtt_init(&r);
+	for(i=0; i<200; i++)
+		rtt_update(&r, (i%10==9)?500:20);
+	unit_assert( rtt_p50(&r) >= 20 && rtt_p50(&r) <= 40 );
+	unit_assert( rtt_p95(&r) >= 300 && rtt_p95(&r) <= 500 );
+	rtt_lost(&r, rtt_timeout(&r));
+	unit_assert( rtt_p50(&r) >= 20 && rtt_p50(&r) <= 40 );
 	/* must be the same, timehist bucket is used in stats */
 	unit_assert(UB_STATS_BUCKET_NUM == NUM_BUCKETS_HIST);
 }
 
+/** test the log-linear latency histogram */
+static void
+lathist_test(void)
+{
+	struct lathist h, h2;
+	struct latency_client lc;
+	struct timeval tv;
+	long long v;
+	size_t i;
+	double q;
+	unit_show_func("util/timehist.c", "lathist_quantile");
+	memset(&h, 0, sizeof(h));
+	unit_assert(lathist_quantile(&h, 0.5) == 0.);
+	/* the buckets are ascending, and adjacent */
+	unit_assert(lathist_bucket_lower(0) == 0);
+	for(i=1; i<LATHIST_NUM; i++) {
+		unit_assert(lathist_bucket_lower(i) > lathist_bucket_lower(i-1));
+		unit_assert(lathist_bucket_lower(i) - lathist_bucket_lower(i-1)
+			<= lathist_bucket_lower(i)/(LATHIST_SUB-1) + 1);
+	}
+	/* uniform 1 to 100000 usec, the quantiles are within the error */
+	for(v=1; v<=100000; v++)
+		lathist_insert(&h, v);
+	unit_assert(h.count == 100000);
+	unit_assert(h.sum == (long long)100000*100001/2);
+	q = lathist_quantile(&h, 0.5)*1000000.;
+	unit_assert(q > 50000.*(1.-1./LATHIST_SUB) &&
+		q < 50000.*(1.+1./LATHIST_SUB));
+	q = lathist_quantile(&h, 0.999)*1000000.;
+	unit_assert(q > 99900.*(1.-1./LATHIST_SUB) &&
+		q < 99900.*(1.+1./LATHIST_SUB));
+	/* small values are exact */
+	memset(&h2, 0, sizeof(h2));
+	for(i=0; i<100; i++)
+		lathist_insert(&h2, 3);
+	q = lathist_quantile(&h2, 0.99)*1000000.;
+	unit_assert(q >= 3. && q <= 4.);
+	/* huge values end in the last bucket */
+	lathist_insert(&h2, (long long)1000*1000000);
+	unit_assert(h2.bucket[LATHIST_NUM-1] == 1);
+	/* merge and subtract */
+	lathist_add(&h2, &h);
+	unit_assert(h2.count == 100101);
+	lathist_subtract(&h2, &h);
+	unit_assert(h2.count == 101);
+	unit_assert(h2.bucket[3] == 100);
+	/* a larger baseline is not subtracted */
+	lathist_subtract(&h2, &h);
+	unit_assert(h2.count == 101);
+
+	memset(&lc, 0, sizeof(lc));
+	tv.tv_sec = 0;
+	tv.tv_usec = 1500;
+	latency_client_insert(&lc, &tv, LDNS_RR_TYPE_AAAA, 3, 1);
+	latency_client_insert(&lc, &tv, 4321, 15, 0);
+	unit_assert(lc.recursion.count == 1 && lc.cache.count == 1);
+	unit_assert(lc.qtype[latency_qtype_index(LDNS_RR_TYPE_AAAA)].count
+		== 1);
+	unit_assert(latency_qtype_type(latency_qtype_index(
+		LDNS_RR_TYPE_AAAA)) == LDNS_RR_TYPE_AAAA);
+	unit_assert(lc.qtype[LATENCY_NUM_QTYPE-1].count == 1);
+	unit_assert(lc.rcode[3].count == 1);
+	unit_assert(lc.rcode[LATENCY_NUM_RCODE-1].count == 1);
+}
+
+/** test the heavy hitter sketch */
+static void
+topk_test(void)
+{
+	struct topk* t = topk_create(8), *t2 = topk_create(8);
+	struct topk_entry* list[8];
+	uint8_t key[4];
+	int i, n;
+	unit_show_func("util/topk.c", "topk_insert");
+	unit_assert(t && t2);
+	unit_assert(topk_sorted(t, list) == 0);
+	/* a frequent key among many infrequent keys */
+	for(i=0; i<1000; i++) {
+		key[0] = 'a';
+		topk_insert(t, key, 1);
+		memmove(key, &i, sizeof(i));
+		topk_insert(t, key, sizeof(i));
+	}
+	unit_assert(t->num == 8);
+	n = topk_sorted(t, list);
+	unit_assert(n == 8);
+	unit_assert(list[0]->keylen == 1 && list[0]->key[0] == 'a');
+	unit_assert(list[0]->count - list[0]->error <= 1000);
+	unit_assert(list[0]->count >= 1000);
+	for(i=1; i<n; i++)
+		unit_assert(list[i]->count <= list[i-1]->count);
+
+	/* merge the sketches */
+	key[0] = 'a';
+	topk_insert(t2, key, 1);
+	key[0] = 'b';
+	for(i=0; i<5; i++)
+		topk_insert(t2, key, 1);
+	topk_merge(t2, t);
+	n = topk_sorted(t2, list);
+	unit_assert(n == 8);
+	unit_assert(list[0]->key[0] == 'a' && list[0]->count >= 1001);
+
+	topk_clear(t);
+	unit_assert(t->num == 0);
+	unit_assert(topk_sorted(t, list) == 0);
+	key[0] = 'c';
+	topk_insert(t, key, 1);
+	unit_assert(topk_sorted(t, list) == 1 && list[0]->count == 1 &&
+		list[0]->error == 0);
+	topk_delete(t);
+	topk_delete(t2);
+}
+
 #include "services/cache/infra.h"
 
 /* lookup and get key and data structs easily */
@@ -1355,6 +1667,74 @@ static void localzone_test(void)
 	localzone_parents_test();
 }
 
+#ifdef USE_DNSCRYPT
+#include "dnscrypt/dnscrypt.h"
+
+/** make a test key and shared secret for the dnscrypt thread cache */
+static void
+dnsc_thread_key(uint8_t* key, uint8_t* nmkey, uint8_t n)
+{
+	memset(key, n, DNSCRYPT_SHARED_SECRET_KEY_LENGTH);
+	memset(nmkey, 0x80|n, crypto_box_BEFORENMBYTES);
+}
+
+/** test the dnscrypt shared secret cache of a thread */
+static void
+dnscrypt_thread_cache_test(void)
+{
+	struct dnsc_thread_cache* tc;
+	uint8_t key1[DNSCRYPT_SHARED_SECRET_KEY_LENGTH],
+		key2[DNSCRYPT_SHARED_SECRET_KEY_LENGTH],
+		key3[DNSCRYPT_SHARED_SECRET_KEY_LENGTH];
+	uint8_t nm1[crypto_box_BEFORENMBYTES], nm2[crypto_box_BEFORENMBYTES],
+		nm3[crypto_box_BEFORENMBYTES], out[crypto_box_BEFORENMBYTES];
+	/* key1 and key2 have the same slot, key3 another one */
+	uint32_t h1 = 5, h2 = 5 + DNSC_THREAD_SECRETS, h3 = 6;
+	unit_show_feature("dnscrypt thread cache");
+	dnsc_thread_key(key1, nm1, 1);
+	dnsc_thread_key(key2, nm2, 2);
+	dnsc_thread_key(key3, nm3, 3);
+
+	/* no cache, for a thread without dnscrypt */
+	dnsc_thread_secret_insert(NULL, key1, h1, nm1);
+	unit_assert(!dnsc_thread_secret_lookup(NULL, key1, h1, out));
+
+	tc = dnsc_thread_cache_create();
+	unit_assert(tc);
+	/* miss in the empty cache, also for the zero key of an empty slot */
+	unit_assert(!dnsc_thread_secret_lookup(tc, key1, h1, out));
+	memset(key3, 0, sizeof(key3));
+	unit_assert(!dnsc_thread_secret_lookup(tc, key3, h3, out));
+	dnsc_thread_key(key3, nm3, 3);
+
+	/* hit */
+	dnsc_thread_secret_insert(tc, key1, h1, nm1);
+	memset(out, 0, sizeof(out));
+	unit_assert(dnsc_thread_secret_lookup(tc, key1, h1, out));
+	unit_assert(memcmp(out, nm1, sizeof(out)) == 0);
+
+	/* collision, the other key in the slot is a miss, and replaces it */
+	unit_assert(!dnsc_thread_secret_lookup(tc, key2, h2, out));
+	dnsc_thread_secret_insert(tc, key2, h2, nm2);
+	unit_assert(dnsc_thread_secret_lookup(tc, key2, h2, out));
+	unit_assert(memcmp(out, nm2, sizeof(out)) == 0);
+	unit_assert(!dnsc_thread_secret_lookup(tc, key1, h1, out));
+
+	/* another slot is not touched */
+	dnsc_thread_secret_insert(tc, key3, h3, nm3);
+	unit_assert(dnsc_thread_secret_lookup(tc, key3, h3, out));
+	unit_assert(memcmp(out, nm3, sizeof(out)) == 0);
+	unit_assert(dnsc_thread_secret_lookup(tc, key2, h2, out));
+	unit_assert(memcmp(out, nm2, sizeof(out)) == 0);
+
+	/* a key that differs in the last byte only is a miss */
+	key2[DNSCRYPT_SHARED_SECRET_KEY_LENGTH-1] ^= 1;
+	unit_assert(!dnsc_thread_secret_lookup(tc, key2, h2, out));
+	dnsc_thread_cache_delete(tc);
+	dnsc_thread_cache_delete(NULL);
+}
+#endif /* USE_DNSCRYPT */
+
 void unit_show_func(const char* file, const char* func)
 {
 	printf("test %s:%s\n", file, func);
@@ -1416,8 +1796,12 @@ main(int argc, char* argv[])
 	config_tag_test();
 	dname_test();
 	rtt_test();
+	lathist_test();
+	topk_test();
 	anchors_test();
 	alloc_test();
+	alloc_batch_test();
+	alloc_contention_test();
 	regional_test();
 	lruhash_test();
 	slabhash_test();
@@ -1432,6 +1816,9 @@ main(int argc, char* argv[])
 #ifdef CLIENT_SUBNET
 	ecs_test();
 #endif /* CLIENT_SUBNET */
+#ifdef USE_DNSCRYPT
+	dnscrypt_thread_cache_test();
+#endif /* USE_DNSCRYPT */
 #ifdef HAVE_NGTCP2
 	doq_test();
 #endif /* HAVE_NGTCP2 */
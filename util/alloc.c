@@ -60,15 +60,15 @@ alloc_setup_special(alloc_special_type* t)
 }
 
 /** prealloc some entries in the cache. To minimize contention. 
- * Result is 1 lock per alloc_max newly created entries.
+ * Result is 1 lock per special_batch newly created entries.
  * @param alloc: the structure to fill up.
  */
 static void
 prealloc_setup(struct alloc_cache* alloc)
 {
 	alloc_special_type* p;
-	int i;
-	for(i=0; i<ALLOC_SPECIAL_MAX; i++) {
+	size_t i;
+	for(i=0; i<alloc->special_batch; i++) {
 		if(!(p = (alloc_special_type*)malloc(
 			sizeof(alloc_special_type)))) {
 			log_err("prealloc: out of memory");
@@ -113,6 +113,7 @@ alloc_init(struct alloc_cache* alloc, struct alloc_cache* super,
 	alloc->last_id -= 1; 			/* for compiler portability. */
 	alloc->last_id |= alloc->next_id;
 	alloc->next_id += 1;			/* because id=0 is special. */
+	alloc->special_batch = ALLOC_SPECIAL_MAX;
 	alloc->max_reg_blocks = 100;
 	alloc->num_reg_blocks = 0;
 	alloc->reg_list = NULL;
@@ -126,13 +127,11 @@ alloc_init(struct alloc_cache* alloc, struct alloc_cache* super,
 	}
 }
 
-/** free the special list */
+/** free a list of special types */
 static void
-alloc_clear_special_list(struct alloc_cache* alloc)
+alloc_free_special_list(alloc_special_type* p)
 {
-	alloc_special_type* p, *np;
-	/* free */
-	p = alloc->quar;
+	alloc_special_type* np;
 	while(p) {
 		np = alloc_special_next(p);
 		/* deinit special type */
@@ -142,6 +141,20 @@ alloc_clear_special_list(struct alloc_cache* alloc)
 	}
 }
 
+/** free the special list and the magazines */
+static void
+alloc_clear_special_list(struct alloc_cache* alloc)
+{
+	alloc_special_type* m, *nm;
+	alloc_free_special_list(alloc->quar);
+	m = alloc->mags;
+	while(m) {
+		nm = alloc_special_nextmag(m);
+		alloc_free_special_list(m);
+		m = nm;
+	}
+}
+
 void
 alloc_clear_special(struct alloc_cache* alloc)
 {
@@ -151,6 +164,8 @@ alloc_clear_special(struct alloc_cache* alloc)
 	alloc_clear_special_list(alloc);
 	alloc->quar = 0;
 	alloc->num_quar = 0;
+	alloc->mags = NULL;
+	alloc->num_mags = 0;
 	if(!alloc->super) {
 		lock_quick_unlock(&alloc->lock);
 	}
@@ -181,6 +196,8 @@ alloc_clear(struct alloc_cache* alloc)
 	}
 	alloc->quar = 0;
 	alloc->num_quar = 0;
+	alloc->mags = NULL;
+	alloc->num_mags = 0;
 	r = alloc->reg_list;
 	while(r) {
 		nr = (struct regional*)r->next;
@@ -210,34 +227,63 @@ alloc_get_id(struct alloc_cache* alloc)
 	return id;
 }
 
+void
+alloc_set_special_batch(struct alloc_cache* alloc, size_t num)
+{
+	if(num == 0)
+		num = ALLOC_SPECIAL_MAX;
+	alloc->special_batch = num;
+}
+
+/** take a magazine, or a batch of the loose items, from the super.
+ * @param alloc: the thread alloc, with an empty quarantine list.
+ * @return the list of items, or NULL if the super has none. */
+static alloc_special_type*
+takefromsuper(struct alloc_cache* alloc)
+{
+	alloc_special_type* p, *last;
+	size_t n = 0;
+	lock_quick_lock(&alloc->super->lock);
+	if((p = alloc->super->mags)) {
+		/* the whole magazine in one go */
+		alloc->super->mags = alloc_special_nextmag(p);
+		alloc->super->num_mags--;
+		n = alloc_special_magsize(p);
+	} else if((p = alloc->super->quar)) {
+		/* loose items, from alloc_clear of threads */
+		last = p;
+		n = 1;
+		while(n < alloc->special_batch && alloc_special_next(last)) {
+			last = alloc_special_next(last);
+			n++;
+		}
+		alloc->super->quar = alloc_special_next(last);
+		alloc_set_special_next(last, NULL);
+	}
+	alloc->super->num_quar -= n;
+	lock_quick_unlock(&alloc->super->lock);
+	if(p) {
+		alloc_set_special_nextmag(p, NULL);
+		alloc_special_magsize(p) = 0;
+		alloc->quar = p;
+		alloc->num_quar = n;
+	}
+	return p;
+}
+
 alloc_special_type* 
 alloc_special_obtain(struct alloc_cache* alloc)
 {
 	alloc_special_type* p;
 	log_assert(alloc);
-	/* see if in local cache */
-	if(alloc->quar) {
+	/* see if in local cache, or get a batch from the global cache */
+	if(alloc->quar || (alloc->super && takefromsuper(alloc))) {
 		p = alloc->quar;
 		alloc->quar = alloc_special_next(p);
 		alloc->num_quar--;
 		p->id = alloc_get_id(alloc);
 		return p;
 	}
-	/* see if in global cache */
-	if(alloc->super) {
-		/* could maybe grab alloc_max/2 entries in one go,
-		 * but really, isn't that just as fast as this code? */
-		lock_quick_lock(&alloc->super->lock);
-		if((p = alloc->super->quar)) {
-			alloc->super->quar = alloc_special_next(p);
-			alloc->super->num_quar--;
-		}
-		lock_quick_unlock(&alloc->super->lock);
-		if(p) {
-			p->id = alloc_get_id(alloc);
-			return p;
-		}
-	}
 	/* allocate new */
 	prealloc_setup(alloc);
 	if(!(p = (alloc_special_type*)malloc(sizeof(alloc_special_type)))) {
@@ -249,30 +295,32 @@ alloc_special_obtain(struct alloc_cache* alloc)
 	return p;
 }
 
-/** push mem and some more items to the super */
+/** push a magazine of special_batch items to the super */
 static void 
-pushintosuper(struct alloc_cache* alloc, alloc_special_type* mem)
+pushintosuper(struct alloc_cache* alloc)
 {
-	int i;
-	alloc_special_type *p = alloc->quar;
+	size_t i;
+	alloc_special_type *mag = alloc->quar, *p = alloc->quar;
 	log_assert(p);
-	log_assert(alloc && alloc->super && 
-		alloc->num_quar >= ALLOC_SPECIAL_MAX);
-	/* push ALLOC_SPECIAL_MAX/2 after mem */
-	alloc_set_special_next(mem, alloc->quar);
-	for(i=1; i<ALLOC_SPECIAL_MAX/2; i++) {
+	log_assert(alloc && alloc->super && alloc->special_batch > 0 &&
+		alloc->num_quar >= alloc->special_batch);
+	/* take the first special_batch items off the list, without lock */
+	for(i=1; i<alloc->special_batch; i++) {
 		p = alloc_special_next(p);
 	}
 	alloc->quar = alloc_special_next(p);
-	alloc->num_quar -= ALLOC_SPECIAL_MAX/2;
+	alloc->num_quar -= alloc->special_batch;
+	alloc_set_special_next(p, NULL);
+	alloc_special_magsize(mag) = alloc->special_batch;
 
-	/* dump mem+list into the super quar list */
+	/* put the magazine on the super mags list */
 	lock_quick_lock(&alloc->super->lock);
-	alloc_set_special_next(p, alloc->super->quar);
-	alloc->super->quar = mem;
-	alloc->super->num_quar += ALLOC_SPECIAL_MAX/2 + 1;
+	alloc_set_special_nextmag(mag, alloc->super->mags);
+	alloc->super->mags = mag;
+	alloc->super->num_mags++;
+	alloc->super->num_quar += alloc->special_batch;
 	lock_quick_unlock(&alloc->super->lock);
-	/* so 1 lock per mem+alloc/2 deletes */
+	/* so 1 lock per special_batch deletes */
 }
 
 void 
@@ -286,10 +334,10 @@ alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem)
 	}
 
 	alloc_special_clean(mem);
-	if(alloc->super && alloc->num_quar >= ALLOC_SPECIAL_MAX) {
-		/* push it to the super structure */
-		pushintosuper(alloc, mem);
-		return;
+	if(alloc->super && alloc->num_quar >= alloc->special_batch*2) {
+		/* push a magazine to the super structure, and keep
+		 * special_batch items for the next obtains */
+		pushintosuper(alloc);
 	}
 
 	alloc_set_special_next(mem, alloc->quar);
@@ -303,13 +351,14 @@ alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem)
 void 
 alloc_stats(struct alloc_cache* alloc)
 {
-	log_info("%salloc: %d in cache, %d blocks.", alloc->super?"":"sup",
-		(int)alloc->num_quar, (int)alloc->num_reg_blocks);
+	log_info("%salloc: %d in cache, %d magazines, %d blocks.",
+		alloc->super?"":"sup", (int)alloc->num_quar,
+		(int)alloc->num_mags, (int)alloc->num_reg_blocks);
 }
 
 size_t alloc_get_mem(struct alloc_cache* alloc)
 {
-	alloc_special_type* p;
+	alloc_special_type* p, *m;
 	size_t s = sizeof(*alloc);
 	if(!alloc->super) { 
 		lock_quick_lock(&alloc->lock); /* superalloc needs locking */
@@ -318,6 +367,11 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 	for(p = alloc->quar; p; p = alloc_special_next(p)) {
 		s += lock_get_mem(&p->entry.lock);
 	}
+	for(m = alloc->mags; m; m = alloc_special_nextmag(m)) {
+		for(p = m; p; p = alloc_special_next(p)) {
+			s += lock_get_mem(&p->entry.lock);
+		}
+	}
 	s += alloc->num_reg_blocks * ALLOC_REG_SIZE;
 	if(!alloc->super) {
 		lock_quick_unlock(&alloc->lock);
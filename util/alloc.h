@@ -42,6 +42,8 @@
  *	o Avoid locking costs of getting global lock to call malloc().
  *	o The packed rrset type needs to be kept on special freelists,
  *	  so that they are reused for other packet rrset allocations.
+ *	o The threads exchange the packed rrsets with the global freelist
+ *	  in magazines of a batch of items, with one lock operation.
  *
  */
 
@@ -61,8 +63,17 @@ typedef struct ub_packed_rrset_key alloc_special_type;
 /** set next pointer. (in available spot). Pass pointers. */
 #define alloc_set_special_next(x, y) \
 	((x)->entry.overflow_next) = (struct lruhash_entry*)(y);
-
-/** how many blocks to cache locally. */
+/** access next magazine pointer, of the first item of a magazine.
+ * (in available spot). Pass pointer. */
+#define alloc_special_nextmag(x) ((alloc_special_type*)((x)->entry.data))
+/** set next magazine pointer. (in available spot). Pass pointers. */
+#define alloc_set_special_nextmag(x, y) \
+	((x)->entry.data) = (void*)(y);
+/** access number of items in the magazine, of the first item of a
+ * magazine. (in available spot). Pass pointer. */
+#define alloc_special_magsize(x) ((x)->rk.dname_len)
+
+/** default number of blocks that move to and from the super at once. */
 #define ALLOC_SPECIAL_MAX 10
 
 /**
@@ -76,8 +87,19 @@ struct alloc_cache {
 	struct alloc_cache* super;
 	/** singly linked lists of special type. These are free for use. */
 	alloc_special_type* quar;
-	/** number of items in quarantine. */
+	/** number of items in quarantine, for the super also the items
+	 * in the magazines. */
 	size_t num_quar;
+	/** for the super, the full magazines that the threads have pushed.
+	 * A magazine is a list of special types, linked with the next
+	 * magazine pointer of the first item. A thread takes or puts a
+	 * whole magazine with one lock operation. */
+	alloc_special_type* mags;
+	/** number of magazines in the mags list */
+	size_t num_mags;
+	/** number of special types in a magazine that moves between this
+	 * thread and the super. The thread keeps up to twice this number. */
+	size_t special_batch;
 	/** thread number for id creation */
 	int thread_num;
 	/** next id number to pass out */
@@ -123,6 +145,14 @@ void alloc_clear(struct alloc_cache* alloc);
  */
 void alloc_clear_special(struct alloc_cache* alloc);
 
+/**
+ * Set the number of special types that move between the thread cache and
+ * the super in one go. The thread cache keeps up to twice that number.
+ * @param alloc: the thread alloc cache.
+ * @param num: the number of items, if 0 the default is used.
+ */
+void alloc_set_special_batch(struct alloc_cache* alloc, size_t num);
+
 /**
  * Get a new special_type element.
  * @param alloc: where to alloc it.
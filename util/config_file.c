@@ -105,6 +105,8 @@ config_create(void)
 	cfg->stat_cumulative = 0;
 	cfg->stat_extended = 0;
 	cfg->stat_inhibit_zero = 1;
+	cfg->stat_latency = 0;
+	cfg->stat_top_size = 0;
 	cfg->num_threads = 1;
 	cfg->port = UNBOUND_DNS_PORT;
 	cfg->do_ip4 = 1;
@@ -173,6 +175,8 @@ config_create(void)
 	cfg->jostle_time = 200;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
+	cfg->deleg_cache_size = 1024 * 1024;
+	cfg->rrset_alloc_batch = 64;
 	cfg->host_ttl = 900;
 	cfg->bogus_ttl = 60;
 	cfg->min_ttl = 0;
@@ -187,6 +191,7 @@ config_create(void)
 	cfg->infra_cache_min_rtt = 50;
 	cfg->infra_cache_max_rtt = 120000;
 	cfg->infra_keep_probing = 0;
+	cfg->infra_latency_selection = 0;
 	cfg->delay_close = 0;
 	cfg->udp_connect = 1;
 	if(!(cfg->outgoing_avail_ports = (int*)calloc(65536, sizeof(int))))
@@ -311,6 +316,10 @@ config_create(void)
 	cfg->control_ifs.last = NULL;
 	cfg->control_port = UNBOUND_CONTROL_PORT;
 	cfg->control_use_cert = 1;
+	cfg->metrics_enable = 0;
+	cfg->metrics_ifs.first = NULL;
+	cfg->metrics_ifs.last = NULL;
+	cfg->metrics_port = UNBOUND_METRICS_PORT;
 	cfg->minimal_responses = 1;
 	cfg->rrset_roundrobin = 1;
 	cfg->unknown_server_time_limit = 376;
@@ -319,6 +328,8 @@ config_create(void)
 	cfg->wait_limit_cookie = 10000;
 	cfg->wait_limit_netblock = NULL;
 	cfg->wait_limit_cookie_netblock = NULL;
+	cfg->fair_share = 0;
+	cfg->fair_share_weight = NULL;
 	cfg->max_udp_size = 1232; /* value taken from edns_buffer_size */
 	if(!(cfg->server_key_file = strdup(RUN_DIR"/unbound_server.key")))
 		goto error_exit;
@@ -359,6 +370,10 @@ config_create(void)
 	cfg->outbound_msg_retry = 5;
 	cfg->max_sent_count = 32;
 	cfg->max_query_restarts = 11;
+	cfg->hedge_queries = 0;
+	cfg->hedge_budget = 5;
+	cfg->resolve_worker_pool = 0;
+	cfg->resolve_async_threads = 1;
 	cfg->qname_minimisation = 1;
 	cfg->qname_minimisation_strict = 0;
 	cfg->shm_enable = 0;
@@ -438,6 +453,7 @@ struct config_file* config_create_forlib(void)
 	cfg->msg_cache_slabs = 1;
 	cfg->rrset_cache_size = 1024*1024;
 	cfg->rrset_cache_slabs = 1;
+	cfg->deleg_cache_size = 256*1024;
 	cfg->infra_cache_slabs = 1;
 	cfg->use_syslog = 0;
 	cfg->key_cache_size = 1024*1024;
@@ -559,6 +575,8 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("extended-statistics:", stat_extended)
 	else S_YNO("statistics-inhibit-zero:", stat_inhibit_zero)
 	else S_YNO("statistics-cumulative:", stat_cumulative)
+	else S_YNO("statistics-latency:", stat_latency)
+	else S_NUMBER_OR_ZERO("statistics-top-size:", stat_top_size)
 	else S_YNO("shm-enable:", shm_enable)
 	else S_NUMBER_OR_ZERO("shm-key:", shm_key)
 	else S_YNO("do-ip4:", do_ip4)
@@ -631,6 +649,8 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_OR_ZERO("ip-dscp:", ip_dscp)
 	else S_MEMSIZE("rrset-cache-size:", rrset_cache_size)
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
+	else S_MEMSIZE("delegation-cache-size:", deleg_cache_size)
+	else S_NUMBER_NONZERO("rrset-alloc-batch:", rrset_alloc_batch)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
 	else S_YNO("deny-any:", deny_any)
@@ -653,6 +673,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 		BLACKLIST_PENALTY = USEFUL_SERVER_TOP_TIMEOUT*4;
 	}
 	else S_YNO("infra-keep-probing:", infra_keep_probing)
+	else S_YNO("infra-latency-selection:", infra_latency_selection)
 	else S_NUMBER_OR_ZERO("infra-host-ttl:", host_ttl)
 	else S_POW2("infra-cache-slabs:", infra_cache_slabs)
 	else S_SIZET_NONZERO("infra-cache-numhosts:", infra_cache_numhosts)
@@ -756,12 +777,16 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_OR_ZERO("discard-timeout:", discard_timeout)
 	else S_NUMBER_OR_ZERO("wait-limit:", wait_limit)
 	else S_NUMBER_OR_ZERO("wait-limit-cookie:", wait_limit_cookie)
+	else S_YNO("fair-share:", fair_share)
 	else S_STRLIST("local-data:", local_data)
 	else S_YNO("unblock-lan-zones:", unblock_lan_zones)
 	else S_YNO("insecure-lan-zones:", insecure_lan_zones)
 	else S_YNO("control-enable:", remote_control_enable)
 	else S_STRLIST_APPEND("control-interface:", control_ifs)
 	else S_NUMBER_NONZERO("control-port:", control_port)
+	else S_YNO("metrics-enable:", metrics_enable)
+	else S_STRLIST_APPEND("metrics-interface:", metrics_ifs)
+	else S_NUMBER_NONZERO("metrics-port:", metrics_port)
 	else S_STR("server-key-file:", server_key_file)
 	else S_STR("server-cert-file:", server_cert_file)
 	else S_STR("control-key-file:", control_key_file)
@@ -844,6 +869,10 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_NONZERO("outbound-msg-retry:", outbound_msg_retry)
 	else S_NUMBER_NONZERO("max-sent-count:", max_sent_count)
 	else S_NUMBER_NONZERO("max-query-restarts:", max_query_restarts)
+	else S_YNO("hedge-queries:", hedge_queries)
+	else S_NUMBER_OR_ZERO("hedge-budget:", hedge_budget)
+	else S_NUMBER_OR_ZERO("resolve-worker-pool:", resolve_worker_pool)
+	else S_NUMBER_NONZERO("resolve-async-threads:", resolve_async_threads)
 	else S_SIZET_NONZERO("fast-server-num:", fast_server_num)
 	else S_NUMBER_OR_ZERO("fast-server-permil:", fast_server_permil)
 	else S_YNO("qname-minimisation:", qname_minimisation)
@@ -1069,6 +1098,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "statistics-cumulative", stat_cumulative)
 	else O_YNO(opt, "extended-statistics", stat_extended)
 	else O_YNO(opt, "statistics-inhibit-zero", stat_inhibit_zero)
+	else O_YNO(opt, "statistics-latency", stat_latency)
+	else O_DEC(opt, "statistics-top-size", stat_top_size)
 	else O_YNO(opt, "shm-enable", shm_enable)
 	else O_DEC(opt, "shm-key", shm_key)
 	else O_YNO(opt, "use-syslog", use_syslog)
@@ -1099,6 +1130,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "ip-dscp", ip_dscp)
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
+	else O_MEM(opt, "delegation-cache-size", deleg_cache_size)
+	else O_DEC(opt, "rrset-alloc-batch", rrset_alloc_batch)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
 	else O_YNO(opt, "prefetch", prefetch)
 	else O_YNO(opt, "deny-any", deny_any)
@@ -1111,6 +1144,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "infra-cache-min-rtt", infra_cache_min_rtt)
 	else O_UNS(opt, "infra-cache-max-rtt", infra_cache_max_rtt)
 	else O_YNO(opt, "infra-keep-probing", infra_keep_probing)
+	else O_YNO(opt, "infra-latency-selection", infra_latency_selection)
 	else O_MEM(opt, "infra-cache-numhosts", infra_cache_numhosts)
 	else O_UNS(opt, "delay-close", delay_close)
 	else O_YNO(opt, "udp-connect", udp_connect)
@@ -1225,6 +1259,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_MEM(opt, "neg-cache-size", neg_cache_size)
 	else O_YNO(opt, "control-enable", remote_control_enable)
 	else O_DEC(opt, "control-port", control_port)
+	else O_YNO(opt, "metrics-enable", metrics_enable)
+	else O_DEC(opt, "metrics-port", metrics_port)
 	else O_STR(opt, "server-key-file", server_key_file)
 	else O_STR(opt, "server-cert-file", server_cert_file)
 	else O_STR(opt, "control-key-file", control_key_file)
@@ -1242,6 +1278,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "trust-anchor-signaling", trust_anchor_signaling)
 	else O_YNO(opt, "root-key-sentinel", root_key_sentinel)
 	else O_LST(opt, "control-interface", control_ifs.first)
+	else O_LST(opt, "metrics-interface", metrics_ifs.first)
 	else O_LST(opt, "domain-insecure", domain_insecure)
 	else O_UNS(opt, "val-override-date", val_date_override)
 	else O_YNO(opt, "minimal-responses", minimal_responses)
@@ -1252,6 +1289,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "wait-limit-cookie", wait_limit_cookie)
 	else O_LS2(opt, "wait-limit-netblock", wait_limit_netblock)
 	else O_LS2(opt, "wait-limit-cookie-netblock", wait_limit_cookie_netblock)
+	else O_YNO(opt, "fair-share", fair_share)
+	else O_LS2(opt, "fair-share-weight", fair_share_weight)
 #ifdef CLIENT_SUBNET
 	else O_LST(opt, "send-client-subnet", client_subnet)
 	else O_LST(opt, "client-subnet-zone", client_subnet_zone)
@@ -1332,6 +1371,10 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_UNS(opt, "outbound-msg-retry", outbound_msg_retry)
 	else O_UNS(opt, "max-sent-count", max_sent_count)
 	else O_UNS(opt, "max-query-restarts", max_query_restarts)
+	else O_YNO(opt, "hedge-queries", hedge_queries)
+	else O_DEC(opt, "hedge-budget", hedge_budget)
+	else O_DEC(opt, "resolve-worker-pool", resolve_worker_pool)
+	else O_DEC(opt, "resolve-async-threads", resolve_async_threads)
 	else O_DEC(opt, "fast-server-num", fast_server_num)
 	else O_DEC(opt, "fast-server-permil", fast_server_permil)
 	else O_DEC(opt, "val-sig-skew-min", val_sig_skew_min)
@@ -1728,8 +1771,10 @@ config_delete(struct config_file* cfg)
 	config_deltrplstrlist(cfg->interface_tag_actions);
 	config_deltrplstrlist(cfg->interface_tag_datas);
 	config_delstrlist(cfg->control_ifs.first);
+	config_delstrlist(cfg->metrics_ifs.first);
 	config_deldblstrlist(cfg->wait_limit_netblock);
 	config_deldblstrlist(cfg->wait_limit_cookie_netblock);
+	config_deldblstrlist(cfg->fair_share_weight);
 	free(cfg->server_key_file);
 	free(cfg->server_cert_file);
 	free(cfg->control_key_file);
@@ -78,6 +78,11 @@ struct config_file {
 	int stat_extended;
 	/** if true, inhibits a lot of =0 lines from the extended stats output */
 	int stat_inhibit_zero;
+	/** if true, latency histograms are kept for response and upstream
+	 * round trip times */
+	int stat_latency;
+	/** number of counters in the heavy hitter sketches, 0 is off */
+	int stat_top_size;
 
 	/** number of threads to create */
 	int num_threads;
@@ -193,6 +198,11 @@ struct config_file {
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
 	size_t rrset_cache_slabs;
+	/** size of the delegation cache, 0 disables it */
+	size_t deleg_cache_size;
+	/** number of rrset keys that a thread exchanges with the global
+	 * freelist at once */
+	size_t rrset_alloc_batch;
 	/** host cache ttl in seconds */
 	int host_ttl;
 	/** number of slabs in the infra host cache */
@@ -205,6 +215,8 @@ struct config_file {
 	int infra_cache_max_rtt;
 	/** keep probing hosts that are down */
 	int infra_keep_probing;
+	/** select servers by median reply time, with two random choices */
+	int infra_latency_selection;
 	/** delay close of udp-timeouted ports, if 0 no delayclose. in msec */
 	int delay_close;
 	/** udp_connect enable uses UDP connect to mitigate ICMP side channel */
@@ -524,6 +536,12 @@ struct config_file {
 	char* control_key_file;
 	/** certificate file for unbound-control */
 	char* control_cert_file;
+	/** metrics http endpoint enable toggle */
+	int metrics_enable;
+	/** the interfaces the metrics endpoint should listen on */
+	struct config_strlist_head metrics_ifs;
+	/** port number for the metrics endpoint */
+	int metrics_port;
 
 	/** Python script file */
 	struct config_strlist* python_script;
@@ -561,6 +579,12 @@ struct config_file {
 	/** wait limit with cookie per netblock */
 	struct config_str2list* wait_limit_cookie_netblock;
 
+	/** if the mesh is shared fairly by the clients when it fills up */
+	int fair_share;
+
+	/** weight of the clients in a netblock for the fair share */
+	struct config_str2list* fair_share_weight;
+
 	/* maximum UDP response size */
 	size_t max_udp_size;
 
@@ -660,6 +684,16 @@ struct config_file {
 	int max_sent_count;
 	/** max number of query restarts; determines max length of CNAME chain */
 	int max_query_restarts;
+	/** send a hedged query to the next server if the reply is slow */
+	int hedge_queries;
+	/** percentage of the outgoing queries that can be hedged queries */
+	int hedge_budget;
+	/** number of idle workers that libunbound keeps for the
+	 * synchronous resolves, 0 creates a worker for every resolve */
+	int resolve_worker_pool;
+	/** number of threads that libunbound starts for the resolves in
+	 * the background, when it is threaded */
+	int resolve_async_threads;
 	/** minimise outgoing QNAME and hide original QTYPE if possible */
 	int qname_minimisation;
 	/** minimise QNAME in strict mode, minimise according to RFC.
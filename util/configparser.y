@@ -81,6 +81,7 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_CHROOT VAR_USERNAME VAR_DIRECTORY VAR_LOGFILE VAR_PIDFILE
 %token VAR_MSG_CACHE_SIZE VAR_MSG_CACHE_SLABS VAR_NUM_QUERIES_PER_THREAD
 %token VAR_RRSET_CACHE_SIZE VAR_RRSET_CACHE_SLABS VAR_OUTGOING_NUM_TCP
+%token VAR_DELEG_CACHE_SIZE
 %token VAR_INFRA_HOST_TTL VAR_INFRA_LAME_TTL VAR_INFRA_CACHE_SLABS
 %token VAR_INFRA_CACHE_NUMHOSTS VAR_INFRA_CACHE_LAME_SIZE VAR_NAME
 %token VAR_STUB_ZONE VAR_STUB_HOST VAR_STUB_ADDR VAR_TARGET_FETCH_POLICY
@@ -124,6 +125,7 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_MAX_UDP_SIZE VAR_DELAY_CLOSE VAR_UDP_CONNECT
 %token VAR_UNBLOCK_LAN_ZONES VAR_INSECURE_LAN_ZONES
 %token VAR_INFRA_CACHE_MIN_RTT VAR_INFRA_CACHE_MAX_RTT VAR_INFRA_KEEP_PROBING
+%token VAR_INFRA_LATENCY_SELECTION
 %token VAR_DNS64_PREFIX VAR_DNS64_SYNTHALL VAR_DNS64_IGNORE_AAAA
 %token VAR_NAT64_PREFIX
 %token VAR_DNSTAP VAR_DNSTAP_ENABLE VAR_DNSTAP_SOCKET_PATH VAR_DNSTAP_IP
@@ -209,6 +211,11 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_LOG_DESTADDR VAR_CACHEDB_CHECK_WHEN_SERVE_EXPIRED
 %token VAR_COOKIE_SECRET_FILE VAR_ITER_SCRUB_NS VAR_ITER_SCRUB_CNAME
 %token VAR_MAX_GLOBAL_QUOTA VAR_HARDEN_UNVERIFIED_GLUE VAR_LOG_TIME_ISO
+%token VAR_METRICS_ENABLE VAR_METRICS_INTERFACE VAR_METRICS_PORT
+%token VAR_STATISTICS_LATENCY VAR_STATISTICS_TOP_SIZE
+%token VAR_RRSET_ALLOC_BATCH VAR_FAIR_SHARE VAR_FAIR_SHARE_WEIGHT
+%token VAR_HEDGE_QUERIES VAR_HEDGE_BUDGET
+%token VAR_RESOLVE_WORKER_POOL VAR_RESOLVE_ASYNC_THREADS
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -247,6 +254,7 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_msg_cache_size | server_msg_cache_slabs |
 	server_num_queries_per_thread | server_rrset_cache_size |
 	server_rrset_cache_slabs | server_outgoing_num_tcp |
+	server_deleg_cache_size |
 	server_infra_host_ttl | server_infra_lame_ttl |
 	server_infra_cache_slabs | server_infra_cache_numhosts |
 	server_infra_cache_lame_size | server_target_fetch_policy |
@@ -270,6 +278,9 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_dlv_anchor_file | server_dlv_anchor | server_neg_cache_size |
 	server_harden_referral_path | server_private_address |
 	server_private_domain | server_extended_statistics |
+	server_statistics_latency | server_statistics_top_size |
+	server_rrset_alloc_batch | server_fair_share |
+	server_fair_share_weight |
 	server_local_data_ptr | server_jostle_timeout |
 	server_unwanted_reply_threshold | server_log_time_ascii |
 	server_domain_insecure | server_val_sig_skew_min |
@@ -293,6 +304,7 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_infra_cache_min_rtt | server_infra_cache_max_rtt | server_harden_algo_downgrade |
 	server_ip_transparent | server_ip_ratelimit | server_ratelimit |
 	server_ip_dscp | server_infra_keep_probing |
+	server_infra_latency_selection |
 	server_ip_ratelimit_slabs | server_ratelimit_slabs |
 	server_ip_ratelimit_size | server_ratelimit_size |
 	server_ratelimit_for_domain |
@@ -300,6 +312,8 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_ip_ratelimit_factor | server_ratelimit_backoff |
 	server_ip_ratelimit_backoff | server_outbound_msg_retry |
 	server_max_sent_count | server_max_query_restarts |
+	server_hedge_queries | server_hedge_budget |
+	server_resolve_worker_pool | server_resolve_async_threads |
 	server_send_client_subnet | server_client_subnet_zone |
 	server_client_subnet_always_forward | server_client_subnet_opcode |
 	server_max_client_subnet_ipv4 | server_max_client_subnet_ipv6 |
@@ -594,6 +608,24 @@ server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG
 		free($2);
 	}
 	;
+server_statistics_latency: VAR_STATISTICS_LATENCY STRING_ARG
+	{
+		OUTYY(("P(server_statistics_latency:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->stat_latency = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_statistics_top_size: VAR_STATISTICS_TOP_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_statistics_top_size:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->stat_top_size = atoi($2);
+		free($2);
+	}
+	;
 server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG
 	{
 		OUTYY(("P(server_extended_statistics:%s)\n", $2));
@@ -1734,6 +1766,23 @@ server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_deleg_cache_size: VAR_DELEG_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_deleg_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->deleg_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_rrset_alloc_batch: VAR_RRSET_ALLOC_BATCH STRING_ARG
+	{
+		OUTYY(("P(server_rrset_alloc_batch:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->rrset_alloc_batch = atoi($2);
+		free($2);
+	}
+	;
 server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG
 	{
 		OUTYY(("P(server_infra_host_ttl:%s)\n", $2));
@@ -1809,6 +1858,16 @@ server_infra_keep_probing: VAR_INFRA_KEEP_PROBING STRING_ARG
 		free($2);
 	}
 	;
+server_infra_latency_selection: VAR_INFRA_LATENCY_SELECTION STRING_ARG
+	{
+		OUTYY(("P(server_infra_latency_selection:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->infra_latency_selection =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG
 	{
 		OUTYY(("P(server_target_fetch_policy:%s)\n", $2));
@@ -2501,6 +2560,30 @@ server_wait_limit_cookie_netblock: VAR_WAIT_LIMIT_COOKIE_NETBLOCK STRING_ARG STR
 		}
 	}
 	;
+server_fair_share: VAR_FAIR_SHARE STRING_ARG
+	{
+		OUTYY(("P(server_fair_share:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->fair_share = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_fair_share_weight: VAR_FAIR_SHARE_WEIGHT STRING_ARG STRING_ARG
+	{
+		OUTYY(("P(server_fair_share_weight:%s %s)\n", $2, $3));
+		if(atoi($3) <= 0) {
+			yyerror("positive number expected");
+			free($2);
+			free($3);
+		} else {
+			if(!cfg_str2list_insert(&cfg_parser->cfg->
+				fair_share_weight, $2, $3))
+				fatal_exit("out of memory adding "
+					"fair-share-weight");
+		}
+	}
+	;
 server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_max_udp_size:%s)\n", $2));
@@ -2879,6 +2962,48 @@ server_max_query_restarts: VAR_MAX_QUERY_RESTARTS STRING_ARG
 		free($2);
 	}
 	;
+server_hedge_queries: VAR_HEDGE_QUERIES STRING_ARG
+	{
+		OUTYY(("P(server_hedge_queries:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->hedge_queries = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_hedge_budget: VAR_HEDGE_BUDGET STRING_ARG
+	{
+		OUTYY(("P(server_hedge_budget:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 100)
+			yyerror("expected a percentage from 0 to 100");
+		else cfg_parser->cfg->hedge_budget = atoi($2);
+		free($2);
+	}
+	;
+server_resolve_worker_pool: VAR_RESOLVE_WORKER_POOL STRING_ARG
+	{
+		OUTYY(("P(server_resolve_worker_pool:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->resolve_worker_pool = atoi($2);
+		free($2);
+	}
+	;
+server_resolve_async_threads: VAR_RESOLVE_ASYNC_THREADS STRING_ARG
+	{
+		OUTYY(("P(server_resolve_async_threads:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->resolve_async_threads = atoi($2);
+		free($2);
+	}
+	;
 server_low_rtt: VAR_LOW_RTT STRING_ARG
 	{
 		OUTYY(("P(low-rtt option is deprecated, use fast-server-num instead)\n"));
@@ -3424,7 +3549,8 @@ contents_rc: contents_rc content_rc
 	| ;
 content_rc: rc_control_enable | rc_control_interface | rc_control_port |
 	rc_server_key_file | rc_server_cert_file | rc_control_key_file |
-	rc_control_cert_file | rc_control_use_cert
+	rc_control_cert_file | rc_control_use_cert | rc_metrics_enable |
+	rc_metrics_interface | rc_metrics_port
 	;
 rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG
 	{
@@ -3459,6 +3585,32 @@ rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG
 		free($2);
 	}
 	;
+rc_metrics_enable: VAR_METRICS_ENABLE STRING_ARG
+	{
+		OUTYY(("P(metrics_enable:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->metrics_enable =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+rc_metrics_interface: VAR_METRICS_INTERFACE STRING_ARG
+	{
+		OUTYY(("P(metrics_interface:%s)\n", $2));
+		if(!cfg_strlist_append(&cfg_parser->cfg->metrics_ifs, $2))
+			yyerror("out of memory");
+	}
+	;
+rc_metrics_port: VAR_METRICS_PORT STRING_ARG
+	{
+		OUTYY(("P(metrics_port:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("metrics port number expected");
+		else cfg_parser->cfg->metrics_port = atoi($2);
+		free($2);
+	}
+	;
 rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG
 	{
 		OUTYY(("P(rc_server_key_file:%s)\n", $2));
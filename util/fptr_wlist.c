@@ -62,6 +62,7 @@
 #include "validator/val_nsec3.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/val_kentry.h"
+#include "services/cache/deleg.h"
 #include "validator/val_neg.h"
 #include "validator/autotrust.h"
 #include "util/data/msgreply.h"
@@ -121,6 +122,8 @@ fptr_whitelist_comm_point_raw(comm_point_callback_type *fptr)
 	else if(fptr == &tube_handle_write) return 1;
 	else if(fptr == &remote_accept_callback) return 1;
 	else if(fptr == &remote_control_callback) return 1;
+	else if(fptr == &metrics_accept_callback) return 1;
+	else if(fptr == &metrics_http_callback) return 1;
 	return 0;
 }
 
@@ -133,6 +136,7 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
 	else if(fptr == &validate_suspend_timer_cb) return 1;
+	else if(fptr == &iter_hedge_timer_cb) return 1;
 #ifdef HAVE_NGTCP2
 	else if(fptr == &doq_timer_cb) return 1;
 #endif
@@ -234,6 +238,7 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 {
 	if(fptr == &mesh_state_compare) return 1;
 	else if(fptr == &mesh_state_ref_compare) return 1;
+	else if(fptr == &mesh_client_compare) return 1;
 	else if(fptr == &addr_tree_compare) return 1;
 	else if(fptr == &addr_tree_addrport_compare) return 1;
 	else if(fptr == &local_zone_cmp) return 1;
@@ -275,6 +280,7 @@ fptr_whitelist_hash_sizefunc(lruhash_sizefunc_type fptr)
 	else if(fptr == &ub_rrset_sizefunc) return 1;
 	else if(fptr == &infra_sizefunc) return 1;
 	else if(fptr == &key_entry_sizefunc) return 1;
+	else if(fptr == &deleg_cache_sizefunc) return 1;
 	else if(fptr == &rate_sizefunc) return 1;
 	else if(fptr == &ip_rate_sizefunc) return 1;
 	else if(fptr == &test_slabhash_sizefunc) return 1;
@@ -295,6 +301,7 @@ fptr_whitelist_hash_compfunc(lruhash_compfunc_type fptr)
 	else if(fptr == &ub_rrset_compare) return 1;
 	else if(fptr == &infra_compfunc) return 1;
 	else if(fptr == &key_entry_compfunc) return 1;
+	else if(fptr == &deleg_cache_compfunc) return 1;
 	else if(fptr == &rate_compfunc) return 1;
 	else if(fptr == &ip_rate_compfunc) return 1;
 	else if(fptr == &test_slabhash_compfunc) return 1;
@@ -312,6 +319,7 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_type fptr)
 	else if(fptr == &ub_rrset_key_delete) return 1;
 	else if(fptr == &infra_delkeyfunc) return 1;
 	else if(fptr == &key_entry_delkeyfunc) return 1;
+	else if(fptr == &deleg_cache_delkeyfunc) return 1;
 	else if(fptr == &rate_delkeyfunc) return 1;
 	else if(fptr == &ip_rate_delkeyfunc) return 1;
 	else if(fptr == &test_slabhash_delkey) return 1;
@@ -329,6 +337,7 @@ fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_type fptr)
 	else if(fptr == &rrset_data_delete) return 1;
 	else if(fptr == &infra_deldatafunc) return 1;
 	else if(fptr == &key_entry_deldatafunc) return 1;
+	else if(fptr == &deleg_cache_deldatafunc) return 1;
 	else if(fptr == &rate_deldatafunc) return 1;
 	else if(fptr == &test_slabhash_deldata) return 1;
 #ifdef CLIENT_SUBNET
@@ -628,6 +637,12 @@ int fptr_whitelist_mesh_cb(mesh_cb_func_type fptr)
 	return 0;
 }
 
+int fptr_whitelist_mesh_retired_del(void (*fptr)(void*))
+{
+	if(fptr == &remote_fast_reload_retired_delete) return 1;
+	return 0;
+}
+
 int fptr_whitelist_print_func(void (*fptr)(char*,void*))
 {
 	if(fptr == &config_print_func) return 1;
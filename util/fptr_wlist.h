@@ -353,6 +353,15 @@ int fptr_whitelist_tube_listen(tube_callback_type* fptr);
  */
 int fptr_whitelist_mesh_cb(mesh_cb_func_type fptr);
 
+/**
+ * Check function pointer whitelist for the delete function of the
+ * structures that a fast reload replaced.
+ *
+ * @param fptr: function pointer to check.
+ * @return false if not in whitelist.
+ */
+int fptr_whitelist_mesh_retired_del(void (*fptr)(void*));
+
 /**
  * Check function pointer whitelist for config_get_option func values.
  * @param fptr: function pointer to check.
@@ -300,6 +300,53 @@ typedef void* ub_thread_key_type;
 #endif /* HAVE_PTHREAD */
 #endif /* USE_THREAD_DEBUG */
 
+/**
+ * Barriers for values that one thread writes and other threads read
+ * lockless, such as the sequence counter around per thread statistics.
+ * HAVE_UB_MEMORY_BARRIER is defined if the compiler offers them.
+ * ub_write_barrier: stores before it are not reordered with stores
+ *	after it. On x86 that only stops the compiler.
+ * ub_read_barrier: loads before it are not reordered with loads after it.
+ * ub_seq_write_begin, ub_seq_write_end: the writer makes the sequence
+ *	odd around its update, the end is a release store.
+ * ub_seq_read_begin, ub_seq_read_retry: the reader takes the sequence
+ *	before its copy, and retries if it was odd or changed after it.
+ * ub_cpu_relax: in the spin of a reader that waits for the writer.
+ */
+#if defined(__ATOMIC_RELEASE) && defined(__ATOMIC_ACQUIRE)
+#define HAVE_UB_MEMORY_BARRIER 1
+#define ub_write_barrier() __atomic_thread_fence(__ATOMIC_RELEASE)
+#define ub_read_barrier() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define ub_seq_write_begin(seq) do { \
+		__atomic_store_n((seq), *(seq)+1, __ATOMIC_RELAXED); \
+		__atomic_thread_fence(__ATOMIC_RELEASE); \
+	} while(0)
+#define ub_seq_write_end(seq) __atomic_store_n((seq), *(seq)+1, \
+	__ATOMIC_RELEASE)
+#define ub_seq_read_begin(seq) __atomic_load_n((seq), __ATOMIC_ACQUIRE)
+#define ub_seq_read_retry(seq, s) (((s)&1) || \
+	(__atomic_thread_fence(__ATOMIC_ACQUIRE), \
+	__atomic_load_n((seq), __ATOMIC_RELAXED) != (s)))
+#elif defined(HAVE_WINDOWS_THREADS)
+#define HAVE_UB_MEMORY_BARRIER 1
+#define ub_write_barrier() MemoryBarrier()
+#define ub_read_barrier() MemoryBarrier()
+#define ub_seq_write_begin(seq) do { (*(seq))++; MemoryBarrier(); } while(0)
+#define ub_seq_write_end(seq) do { MemoryBarrier(); (*(seq))++; } while(0)
+#define ub_seq_read_begin(seq) (*(seq))
+#define ub_seq_read_retry(seq, s) (((s)&1) || (MemoryBarrier(), \
+	*(seq) != (s)))
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define ub_cpu_relax() __builtin_ia32_pause()
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define ub_cpu_relax() __asm__ __volatile__("yield" ::: "memory")
+#elif defined(HAVE_WINDOWS_THREADS)
+#define ub_cpu_relax() YieldProcessor()
+#else
+#define ub_cpu_relax() /* nothing */
+#endif
+
 /**
  * Block all signals for this thread.
  * fatal exit on error.
@@ -159,6 +159,7 @@
 struct sldns_buffer;
 struct alloc_cache;
 struct rrset_cache;
+struct deleg_cache;
 struct key_cache;
 struct config_file;
 struct slabhash;
@@ -341,6 +342,8 @@ struct module_env {
 	struct slabhash* msg_cache;
 	/** shared rrset cache */
 	struct rrset_cache* rrset_cache;
+	/** shared delegation cache, glue of the zone cuts, or NULL */
+	struct deleg_cache* deleg_cache;
 	/** shared infrastructure cache (edns, lameness) */
 	struct infra_cache* infra_cache;
 	/** shared key cache */
@@ -548,6 +551,9 @@ struct module_env {
 #endif
 	/* Make every mesh state unique, do not aggregate mesh states. */
 	int unique_mesh;
+	/** the hedged query budget credit of this thread, in percent of a
+	 * query. Used by the iterator, per thread so it needs no lock. */
+	size_t hedge_credit;
 };
 
 /**
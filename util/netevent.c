@@ -82,6 +82,9 @@
 #ifdef HAVE_LINUX_NET_TSTAMP_H
 #include <linux/net_tstamp.h>
 #endif
+#ifdef HAVE_NETINET_UDP_H
+#include <netinet/udp.h>
+#endif
 
 /* -------- Start of local definitions -------- */
 /** if CMSG_ALIGN is not defined on this platform, a workaround */
@@ -1292,31 +1295,58 @@ doq_print_addr_port(struct doq_addr_storage* addr, socklen_t addrlen,
 	return 1;
 }
 
-/** doq store the blocked packet when write has blocked */
+/** doq store the blocked packets when write has blocked. The data can
+ * be from the blocked_pkt buffer itself. */
 static void
 doq_store_blocked_pkt(struct comm_point* c, struct doq_pkt_addr* paddr,
-	uint32_t ecn)
+	uint32_t ecn, uint8_t* data, size_t len, size_t gso_size)
 {
 	if(c->doq_socket->have_blocked_pkt)
 		return; /* should not happen that we write when there is
 		already a blocked write, but if so, drop it. */
-	if(sldns_buffer_limit(c->doq_socket->pkt_buf) >
-		sldns_buffer_capacity(c->doq_socket->blocked_pkt))
+	if(len > sldns_buffer_capacity(c->doq_socket->blocked_pkt))
 		return; /* impossibly large, drop packet. impossible because
-		pkt_buf and blocked_pkt are the same size. */
+		gso_buf and blocked_pkt are the same size. */
 	c->doq_socket->have_blocked_pkt = 1;
 	c->doq_socket->blocked_pkt_pi.ecn = ecn;
-	memcpy(c->doq_socket->blocked_paddr, paddr,
-		sizeof(*c->doq_socket->blocked_paddr));
+	c->doq_socket->blocked_pkt_gso = gso_size;
+	if(paddr != c->doq_socket->blocked_paddr)
+		memcpy(c->doq_socket->blocked_paddr, paddr,
+			sizeof(*c->doq_socket->blocked_paddr));
 	sldns_buffer_clear(c->doq_socket->blocked_pkt);
-	sldns_buffer_write(c->doq_socket->blocked_pkt,
-		sldns_buffer_begin(c->doq_socket->pkt_buf),
-		sldns_buffer_limit(c->doq_socket->pkt_buf));
+	memmove(sldns_buffer_begin(c->doq_socket->blocked_pkt), data, len);
+	sldns_buffer_set_position(c->doq_socket->blocked_pkt, len);
 	sldns_buffer_flip(c->doq_socket->blocked_pkt);
 }
 
 void
-doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn)
+doq_store_blocked_next(struct comm_point* c, uint32_t ecn, uint8_t* data,
+	size_t len)
+{
+	if(!c->doq_socket->have_blocked_pkt ||
+		c->doq_socket->have_blocked_next)
+		return; /* should not happen, but if so, drop it. */
+	if(len > sldns_buffer_capacity(c->doq_socket->blocked_next))
+		return; /* impossibly large, it is a packet from pkt_buf
+		size, drop packet. */
+	c->doq_socket->have_blocked_next = 1;
+	c->doq_socket->blocked_next_ecn = ecn;
+	sldns_buffer_clear(c->doq_socket->blocked_next);
+	sldns_buffer_write(c->doq_socket->blocked_next, data, len);
+	sldns_buffer_flip(c->doq_socket->blocked_next);
+}
+
+/** result of doq_sendmsg, the packets are sent, or logged and dropped */
+#define DOQ_SEND_DONE 0
+/** result of doq_sendmsg, the send has blocked */
+#define DOQ_SEND_BLOCKED 1
+/** result of doq_sendmsg, UDP GSO is not possible */
+#define DOQ_SEND_NO_GSO 2
+
+/** send the data with sendmsg, with the UDP GSO segment size if not 0 */
+static int
+doq_sendmsg(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn,
+	uint8_t* data, size_t len, size_t gso_size)
 {
 	struct msghdr msg;
 	struct iovec iov[1];
@@ -1325,8 +1355,8 @@ doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn)
 		char buf[256];
 	} control;
 	ssize_t ret;
-	iov[0].iov_base = sldns_buffer_begin(c->doq_socket->pkt_buf);
-	iov[0].iov_len = sldns_buffer_limit(c->doq_socket->pkt_buf);
+	iov[0].iov_base = data;
+	iov[0].iov_len = len;
 	memset(&msg, 0, sizeof(msg));
 	msg.msg_name = (void*)&paddr->addr;
 	msg.msg_namelen = paddr->addrlen;
@@ -1340,6 +1370,24 @@ doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn)
 
 	doq_set_localaddr_cmsg(&msg, sizeof(control.buf), &paddr->localaddr,
 		paddr->localaddrlen, paddr->ifindex);
+#if defined(UDP_SEGMENT) && !defined(S_SPLINT_S)
+	if(gso_size != 0) {
+		/* the segment size goes after the pktinfo */
+		uint16_t segment = (uint16_t)gso_size;
+		struct cmsghdr* cmsg = (struct cmsghdr*)(control.buf +
+			msg.msg_controllen);
+		log_assert(msg.msg_controllen + CMSG_SPACE(sizeof(segment))
+			<= sizeof(control.buf));
+		memset(cmsg, 0, CMSG_SPACE(sizeof(segment)));
+		cmsg->cmsg_level = IPPROTO_UDP;
+		cmsg->cmsg_type = UDP_SEGMENT;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(segment));
+		memmove(CMSG_DATA(cmsg), &segment, sizeof(segment));
+		msg.msg_controllen += CMSG_SPACE(sizeof(segment));
+	}
+#else
+	(void)gso_size;
+#endif
 	doq_set_ecn(c->fd, paddr->addr.sockaddr.in.sin_family, ecn);
 
 	for(;;) {
@@ -1362,12 +1410,22 @@ doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn)
 #endif
 		{
 			/* udp send has blocked */
-			doq_store_blocked_pkt(c, paddr, ecn);
-			return;
+			return DOQ_SEND_BLOCKED;
+		}
+#ifdef UDP_SEGMENT
+		/* the kernel does not support it, or the device does not
+		 * have checksum offload. EINVAL can be a bad packet, and
+		 * not a lack of support, so that does not turn it off. */
+		if(gso_size != 0 && (errno == EIO || errno == ENOPROTOOPT)) {
+			verbose(VERB_ALGO, "doq sendmsg with UDP_SEGMENT "
+				"failed: %s, packets are sent one by one",
+				strerror(errno));
+			return DOQ_SEND_NO_GSO;
 		}
+#endif
 		if(!udp_send_errno_needs_log((void*)&paddr->addr,
 			paddr->addrlen))
-			return;
+			return DOQ_SEND_DONE;
 		if(verbosity >= VERB_OPS) {
 			char host[256], port[32];
 			if(doq_print_addr_port(&paddr->addr, paddr->addrlen,
@@ -1380,22 +1438,59 @@ doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn)
 					strerror(errno));
 			}
 		}
-		return;
-	} else if(ret != (ssize_t)sldns_buffer_limit(c->doq_socket->pkt_buf)) {
+		return DOQ_SEND_DONE;
+	} else if(ret != (ssize_t)len) {
 		char host[256], port[32];
 		if(doq_print_addr_port(&paddr->addr, paddr->addrlen, host,
 			sizeof(host), port, sizeof(port))) {
 			log_err("doq sendmsg to %s %s failed: "
 				"sent %d in place of %d bytes", 
-				host, port, (int)ret,
-				(int)sldns_buffer_limit(c->doq_socket->pkt_buf));
+				host, port, (int)ret, (int)len);
 		} else {
 			log_err("doq sendmsg failed: "
 				"sent %d in place of %d bytes", 
-				(int)ret, (int)sldns_buffer_limit(c->doq_socket->pkt_buf));
+				(int)ret, (int)len);
 		}
-		return;
+		return DOQ_SEND_DONE;
 	}
+	return DOQ_SEND_DONE;
+}
+
+void
+doq_send_pkts(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn,
+	struct sldns_buffer* buf, size_t gso_size)
+{
+	uint8_t* data = sldns_buffer_begin(buf);
+	size_t len = sldns_buffer_limit(buf);
+	if(gso_size >= len)
+		gso_size = 0; /* it is one packet */
+	if(gso_size != 0 && c->doq_socket->gso) {
+		int r = doq_sendmsg(c, paddr, ecn, data, len, gso_size);
+		if(r == DOQ_SEND_BLOCKED)
+			doq_store_blocked_pkt(c, paddr, ecn, data, len,
+				gso_size);
+		if(r != DOQ_SEND_NO_GSO)
+			return;
+		c->doq_socket->gso = 0;
+	}
+	/* send the packets one by one */
+	while(len > 0) {
+		size_t n = (gso_size != 0 && gso_size < len)?gso_size:len;
+		if(doq_sendmsg(c, paddr, ecn, data, n, 0) == DOQ_SEND_BLOCKED) {
+			/* store this one and the rest for later */
+			doq_store_blocked_pkt(c, paddr, ecn, data, len,
+				gso_size);
+			return;
+		}
+		data += n;
+		len -= n;
+	}
+}
+
+void
+doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr, uint32_t ecn)
+{
+	doq_send_pkts(c, paddr, ecn, c->doq_socket->pkt_buf, 0);
 }
 
 /** fetch port number */
@@ -1527,10 +1622,65 @@ msghdr_get_ecn(struct msghdr* msg, int family)
 	return 0;
 }
 
-/** receive packet for DoQ on UDP. get ancillary data for addresses,
- * return false if failed and the callback can stop receiving UDP packets
- * if pkt_continue is false. */
+/** get the UDP GRO segment size, or 0 if the packet is not coalesced */
+static size_t
+msghdr_get_gro_size(struct msghdr* msg)
+{
+#if defined(UDP_GRO) && !defined(S_SPLINT_S)
+	struct cmsghdr* cmsg;
+	for(cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL;
+		cmsg = CMSG_NXTHDR(msg, cmsg)) {
+		if(cmsg->cmsg_level == IPPROTO_UDP &&
+			cmsg->cmsg_type == UDP_GRO &&
+			cmsg->cmsg_len >= CMSG_LEN(sizeof(int))) {
+			int gro_size;
+			memmove(&gro_size, CMSG_DATA(cmsg), sizeof(gro_size));
+			if(gro_size <= 0)
+				return 0;
+			return (size_t)gro_size;
+		}
+	}
+#else
+	(void)msg;
+#endif
+	return 0;
+}
+
+/** see if there are received packets left in the gro buffer */
 static int
+doq_gro_pending(struct comm_point* c)
+{
+	return c->doq_socket->gro &&
+		sldns_buffer_remaining(c->doq_socket->gro_buf) > 0;
+}
+
+/** take the next packet from the gro buffer into the pkt_buf.
+ * return false if there is none. */
+static int
+doq_gro_next(struct comm_point* c, struct doq_pkt_addr* paddr,
+	struct ngtcp2_pkt_info* pi)
+{
+	struct sldns_buffer* gro_buf = c->doq_socket->gro_buf;
+	size_t len;
+	if(!doq_gro_pending(c))
+		return 0;
+	len = sldns_buffer_remaining(gro_buf);
+	if(c->doq_socket->gro_size != 0 && len > c->doq_socket->gro_size)
+		len = c->doq_socket->gro_size;
+	sldns_buffer_clear(c->doq_socket->pkt_buf);
+	/* larger than a packet, it is truncated, like recv would */
+	sldns_buffer_write(c->doq_socket->pkt_buf,
+		sldns_buffer_current(gro_buf),
+		(len < sldns_buffer_capacity(c->doq_socket->pkt_buf)?len:
+		sldns_buffer_capacity(c->doq_socket->pkt_buf)));
+	sldns_buffer_flip(c->doq_socket->pkt_buf);
+	sldns_buffer_skip(gro_buf, (ssize_t)len);
+	memcpy(paddr, c->doq_socket->gro_paddr, sizeof(*paddr));
+	pi->ecn = c->doq_socket->gro_ecn;
+	return 1;
+}
+
+int
 doq_recv(struct comm_point* c, struct doq_pkt_addr* paddr, int* pkt_continue,
 	struct ngtcp2_pkt_info* pi)
 {
@@ -1541,11 +1691,19 @@ doq_recv(struct comm_point* c, struct doq_pkt_addr* paddr, int* pkt_continue,
 		struct cmsghdr hdr;
 		char buf[256];
 	} ancil;
+	struct sldns_buffer* buf = c->doq_socket->pkt_buf;
+
+	if(doq_gro_next(c, paddr, pi))
+		return 1;
+	if(c->doq_socket->gro) {
+		buf = c->doq_socket->gro_buf;
+		sldns_buffer_clear(buf);
+	}
 
 	msg.msg_name = &paddr->addr;
 	msg.msg_namelen = (socklen_t)sizeof(paddr->addr);
-	iov[0].iov_base = sldns_buffer_begin(c->doq_socket->pkt_buf);
-	iov[0].iov_len = sldns_buffer_remaining(c->doq_socket->pkt_buf);
+	iov[0].iov_base = sldns_buffer_begin(buf);
+	iov[0].iov_len = sldns_buffer_remaining(buf);
 	msg.msg_iov = iov;
 	msg.msg_iovlen = 1;
 	msg.msg_control = ancil.buf;
@@ -1560,16 +1718,44 @@ doq_recv(struct comm_point* c, struct doq_pkt_addr* paddr, int* pkt_continue,
 			&& udp_recv_needs_log(errno)) {
 			log_err("recvmsg failed for doq: %s", strerror(errno));
 		}
+		if(c->doq_socket->gro)
+			sldns_buffer_flip(buf); /* nothing pending */
 		*pkt_continue = 0;
 		return 0;
 	}
+#ifdef MSG_TRUNC
+	if((msg.msg_flags&MSG_TRUNC)) {
+		/* the datagram, or the coalesced packets, did not fit, and
+		 * the rest is lost. Drop it, the sender resends. */
+		verbose(VERB_ALGO, "doq: recvmsg truncated, dropped");
+		if(c->doq_socket->gro) {
+			sldns_buffer_clear(buf);
+			sldns_buffer_flip(buf); /* nothing pending */
+		}
+		*pkt_continue = 1;
+		return 0;
+	}
+#endif
 
 	paddr->addrlen = msg.msg_namelen;
-	sldns_buffer_skip(c->doq_socket->pkt_buf, rcv);
-	sldns_buffer_flip(c->doq_socket->pkt_buf);
-	if(!doq_get_localaddr_cmsg(c, paddr, pkt_continue, &msg))
+	sldns_buffer_skip(buf, rcv);
+	sldns_buffer_flip(buf);
+	if(!doq_get_localaddr_cmsg(c, paddr, pkt_continue, &msg)) {
+		if(c->doq_socket->gro)
+			sldns_buffer_set_position(buf, sldns_buffer_limit(buf));
 		return 0;
+	}
 	pi->ecn = msghdr_get_ecn(&msg, paddr->addr.sockaddr.in.sin_family);
+	if(c->doq_socket->gro) {
+		/* the packets are taken out of the gro_buf one by one */
+		c->doq_socket->gro_size = msghdr_get_gro_size(&msg);
+		c->doq_socket->gro_ecn = pi->ecn;
+		memcpy(c->doq_socket->gro_paddr, paddr, sizeof(*paddr));
+		if(!doq_gro_next(c, paddr, pi)) {
+			*pkt_continue = 1;
+			return 0;
+		}
+	}
 	return 1;
 }
 
@@ -1809,6 +1995,9 @@ doq_send_retry(struct comm_point* c, struct doq_pkt_addr* paddr,
 	/* the server chosen source connection ID */
 	scid.datalen = c->doq_socket->sv_scidlen;
 	doq_cid_randfill(&scid, scid.datalen, c->doq_socket->rnd);
+	/* the initial that answers the retry comes back to this thread */
+	if(c->doq_socket->table->owner != -1)
+		scid.data[0] = (uint8_t)c->doq_socket->table->owner;
 
 	ts = doq_get_timestamp_nanosec();
 
@@ -2374,27 +2563,29 @@ doq_socket_write_disable(struct comm_point* c)
 	c->doq_socket->event_has_write = 0;
 }
 
-/** write blocked packet, if possible. returns false if failed, again. */
-static int
+int
 doq_write_blocked_pkt(struct comm_point* c)
 {
 	struct doq_pkt_addr paddr;
 	if(!c->doq_socket->have_blocked_pkt)
 		return 1;
 	c->doq_socket->have_blocked_pkt = 0;
-	if(sldns_buffer_limit(c->doq_socket->blocked_pkt) >
-		sldns_buffer_remaining(c->doq_socket->pkt_buf))
-		return 1; /* impossibly large, drop it.
-		impossible since pkt_buf is same size as blocked_pkt buf. */
-	sldns_buffer_clear(c->doq_socket->pkt_buf);
-	sldns_buffer_write(c->doq_socket->pkt_buf,
-		sldns_buffer_begin(c->doq_socket->blocked_pkt),
-		sldns_buffer_limit(c->doq_socket->blocked_pkt));
-	sldns_buffer_flip(c->doq_socket->pkt_buf);
+	/* send from the blocked_pkt buffer, if it blocks again, the
+	 * packets are kept there. */
 	memcpy(&paddr, c->doq_socket->blocked_paddr, sizeof(paddr));
-	doq_send_pkt(c, &paddr, c->doq_socket->blocked_pkt_pi.ecn);
+	doq_send_pkts(c, &paddr, c->doq_socket->blocked_pkt_pi.ecn,
+		c->doq_socket->blocked_pkt, c->doq_socket->blocked_pkt_gso);
 	if(c->doq_socket->have_blocked_pkt)
 		return 0;
+	if(c->doq_socket->have_blocked_next) {
+		/* the packet after the batch, if it blocks it is stored
+		 * in blocked_pkt. */
+		c->doq_socket->have_blocked_next = 0;
+		doq_send_pkts(c, &paddr, c->doq_socket->blocked_next_ecn,
+			c->doq_socket->blocked_next, 0);
+		if(c->doq_socket->have_blocked_pkt)
+			return 0;
+	}
 	return 1;
 }
 
@@ -2572,9 +2763,10 @@ comm_point_doq_callback(int fd, short event, void* arg)
 			break;
 	}
 
-	/* check for data to read */
-	if((event&UB_EV_READ)!=0)
-	  for(i=0; i<NUM_UDP_PER_SELECT; i++) {
+	/* check for data to read, also packets left over from the
+	 * received GRO batch */
+	if((event&UB_EV_READ)!=0 || doq_gro_pending(c))
+	  for(i=0; i<NUM_UDP_PER_SELECT || doq_gro_pending(c); i++) {
 		/* there may be a blocked write packet and if so, stop
 		 * reading because the reply cannot get written. The
 		 * blocked packet could be written during the conn_recv
@@ -2754,9 +2946,9 @@ doq_server_socket_create(struct doq_table* table, struct ub_randstate* rnd,
 		free(doq_socket);
 		return NULL;
 	}
-	doq_socket->blocked_pkt = sldns_buffer_new(
-		sldns_buffer_capacity(doq_socket->pkt_buf));
-	if(!doq_socket->pkt_buf) {
+	/* the blocked packet can hold a segmented batch of packets */
+	doq_socket->blocked_pkt = sldns_buffer_new(DOQ_GSO_BUFFER_SIZE);
+	if(!doq_socket->blocked_pkt) {
 		free(doq_socket->ssl_service_key);
 		free(doq_socket->ssl_service_pem);
 		free(doq_socket->ssl_verify_pem);
@@ -2779,6 +2971,53 @@ doq_server_socket_create(struct doq_table* table, struct ub_randstate* rnd,
 		free(doq_socket);
 		return NULL;
 	}
+	doq_socket->gso_buf = sldns_buffer_new(DOQ_GSO_BUFFER_SIZE);
+	doq_socket->gro_paddr = calloc(1, sizeof(*doq_socket->gro_paddr));
+	doq_socket->blocked_next = sldns_buffer_new(doq_buffer_size);
+	if(!doq_socket->gso_buf || !doq_socket->gro_paddr ||
+		!doq_socket->blocked_next) {
+		free(doq_socket->ssl_service_key);
+		free(doq_socket->ssl_service_pem);
+		free(doq_socket->ssl_verify_pem);
+		free(doq_socket->static_secret);
+		SSL_CTX_free(doq_socket->ctx);
+		sldns_buffer_free(doq_socket->pkt_buf);
+		sldns_buffer_free(doq_socket->blocked_pkt);
+		free(doq_socket->blocked_paddr);
+		sldns_buffer_free(doq_socket->gso_buf);
+		free(doq_socket->gro_paddr);
+		sldns_buffer_free(doq_socket->blocked_next);
+		free(doq_socket);
+		return NULL;
+	}
+#ifdef UDP_SEGMENT
+	/* turned off when a segmented send fails as not supported */
+	doq_socket->gso = 1;
+#endif
+#if defined(UDP_GRO) && !defined(S_SPLINT_S)
+	if(c->fd != -1) {
+		int on = 1;
+		if(setsockopt(c->fd, IPPROTO_UDP, UDP_GRO, (void*)&on,
+			(socklen_t)sizeof(on)) < 0) {
+			verbose(VERB_ALGO, "doq: setsockopt(.. UDP_GRO ..) "
+				"failed: %s", sock_strerror(errno));
+		} else {
+			doq_socket->gro_buf = sldns_buffer_new(
+				DOQ_GRO_BUFFER_SIZE);
+			if(doq_socket->gro_buf) {
+				/* empty, no packets pending */
+				sldns_buffer_clear(doq_socket->gro_buf);
+				sldns_buffer_flip(doq_socket->gro_buf);
+				doq_socket->gro = 1;
+			} else {
+				/* receive without the larger buffer */
+				on = 0;
+				(void)setsockopt(c->fd, IPPROTO_UDP, UDP_GRO,
+					(void*)&on, (socklen_t)sizeof(on));
+			}
+		}
+	}
+#endif
 	doq_socket->timer = comm_timer_create(base, doq_timer_cb, doq_socket);
 	if(!doq_socket->timer) {
 		free(doq_socket->ssl_service_key);
@@ -2789,6 +3028,10 @@ doq_server_socket_create(struct doq_table* table, struct ub_randstate* rnd,
 		sldns_buffer_free(doq_socket->pkt_buf);
 		sldns_buffer_free(doq_socket->blocked_pkt);
 		free(doq_socket->blocked_paddr);
+		sldns_buffer_free(doq_socket->gso_buf);
+		sldns_buffer_free(doq_socket->gro_buf);
+		free(doq_socket->gro_paddr);
+		sldns_buffer_free(doq_socket->blocked_next);
 		free(doq_socket);
 		return NULL;
 	}
@@ -2815,6 +3058,10 @@ doq_server_socket_delete(struct doq_server_socket* doq_socket)
 	sldns_buffer_free(doq_socket->pkt_buf);
 	sldns_buffer_free(doq_socket->blocked_pkt);
 	free(doq_socket->blocked_paddr);
+	sldns_buffer_free(doq_socket->gso_buf);
+	sldns_buffer_free(doq_socket->gro_buf);
+	free(doq_socket->gro_paddr);
+	sldns_buffer_free(doq_socket->blocked_next);
 	comm_timer_delete(doq_socket->timer);
 	free(doq_socket);
 }
@@ -5045,6 +5292,7 @@ static void http2_session_delete(struct http2_session* h2_session)
 #ifdef HAVE_NGHTTP2
 	if(h2_session->callbacks)
 		nghttp2_session_callbacks_del(h2_session->callbacks);
+	http2_session_wbuf_delete(h2_session);
 	free(h2_session);
 #else
 	(void)h2_session;
@@ -5104,6 +5352,7 @@ static void http2_session_server_delete(struct http2_session* h2_session)
 		h2_stream = next;
 	}
 	h2_session->first_stream = NULL;
+	http2_session_wbuf_delete(h2_session);
 	h2_session->is_drop = 0;
 	h2_session->postpone_drop = 0;
 	h2_session->c->h2_stream = NULL;
@@ -5478,13 +5727,12 @@ http_write_more(int fd, struct comm_point* c)
 }
 
 #ifdef HAVE_NGHTTP2
-ssize_t http2_send_cb(nghttp2_session* ATTR_UNUSED(session), const uint8_t* buf,
-	size_t len, int ATTR_UNUSED(flags), void* cb_arg)
+/** Write to the http2 connection, with SSL or plain.
+ * @return number of bytes written, or nghttp2 error code. */
+static ssize_t http2_write_raw(struct http2_session* h2_session,
+	const uint8_t* buf, size_t len)
 {
 	ssize_t ret;
-	struct http2_session* h2_session = (struct http2_session*)cb_arg;
-	log_assert(h2_session->c->type == comm_http);
-	log_assert(h2_session->c->h2_session);
 
 #ifdef HAVE_SSL
 	if(h2_session->c->ssl) {
@@ -5557,6 +5805,87 @@ ssize_t http2_send_cb(nghttp2_session* ATTR_UNUSED(session), const uint8_t* buf,
 	}
 	return ret;
 }
+
+/**
+ * Write the http2 session write buffer to the connection.
+ * @param h2_session: http2 session.
+ * @return 1 when all is written, 0 if the write blocks, -1 on failure.
+ */
+static int http2_write_flush(struct http2_session* h2_session)
+{
+	struct sldns_buffer* wbuf = h2_session->wbuf;
+	if(!wbuf)
+		return 1;
+	while(h2_session->wbuf_sent < sldns_buffer_position(wbuf)) {
+		/* if blocked, this is the same write again, SSL_write
+		 * needs that */
+		ssize_t r = http2_write_raw(h2_session,
+			sldns_buffer_at(wbuf, h2_session->wbuf_sent),
+			sldns_buffer_position(wbuf) - h2_session->wbuf_sent);
+		if(r == NGHTTP2_ERR_WOULDBLOCK) {
+			h2_session->wbuf_blocked = 1;
+			return 0;
+		} else if(r < 0) {
+			return -1;
+		}
+		h2_session->wbuf_sent += (size_t)r;
+	}
+	sldns_buffer_clear(wbuf);
+	h2_session->wbuf_sent = 0;
+	h2_session->wbuf_blocked = 0;
+	return 1;
+}
+
+int http2_write_reserve(struct http2_session* h2_session, size_t len)
+{
+	int r;
+	if(!h2_session->wbuf && !http2_session_wbuf_create(h2_session))
+		return -1;
+	if(h2_session->wbuf_blocked)
+		return 0;
+	if(sldns_buffer_remaining(h2_session->wbuf) >= len)
+		return 1;
+	if((r = http2_write_flush(h2_session)) != 1)
+		return r;
+	if(sldns_buffer_remaining(h2_session->wbuf) < len) {
+		verbose(VERB_QUERY, "http2: frame of %d bytes does not fit "
+			"in the write buffer", (int)len);
+		return -1;
+	}
+	return 1;
+}
+
+ssize_t http2_send_cb(nghttp2_session* ATTR_UNUSED(session), const uint8_t* buf,
+	size_t len, int ATTR_UNUSED(flags), void* cb_arg)
+{
+	struct http2_session* h2_session = (struct http2_session*)cb_arg;
+	struct sldns_buffer* wbuf;
+	log_assert(h2_session->c->type == comm_http);
+	log_assert(h2_session->c->h2_session);
+
+	/* without space for the write buffer, write the frame directly */
+	if(!http2_session_wbuf_create(h2_session))
+		return http2_write_raw(h2_session, buf, len);
+	wbuf = h2_session->wbuf;
+
+	/* The frames are collected in the wbuf, and written out after the
+	 * session send is done, so that the frames of the streams that
+	 * completed during this event loop iteration go out together. */
+	if(h2_session->wbuf_blocked)
+		return NGHTTP2_ERR_WOULDBLOCK;
+	if(sldns_buffer_remaining(wbuf) == 0) {
+		int r = http2_write_flush(h2_session);
+		if(r == 0)
+			return NGHTTP2_ERR_WOULDBLOCK;
+		else if(r < 0)
+			return NGHTTP2_ERR_CALLBACK_FAILURE;
+	}
+	/* nghttp2 sends the rest of the frame in the next call */
+	if(len > sldns_buffer_remaining(wbuf))
+		len = sldns_buffer_remaining(wbuf);
+	sldns_buffer_write(wbuf, buf, len);
+	return (ssize_t)len;
+}
 #endif /* HAVE_NGHTTP2 */
 
 /** Handle http2 writing */
@@ -5567,12 +5896,21 @@ comm_point_http2_handle_write(int ATTR_UNUSED(fd), struct comm_point* c)
 	int ret;
 	log_assert(c->h2_session);
 
+	/* first the output that blocked the previous time */
+	if((ret = http2_write_flush(c->h2_session)) != 1)
+		return ret == 0;
 	ret = nghttp2_session_send(c->h2_session->session);
 	if(ret) {
 		verbose(VERB_QUERY, "http2: session_send failed, "
 			"error: %s", nghttp2_strerror(ret));
 		return 0;
 	}
+	/* write the collected frames, if it blocks wait for write again */
+	if((ret = http2_write_flush(c->h2_session)) != 1)
+		return ret == 0;
+	/* the write buffer is counted in the response buffer memory, it is
+	 * allocated again for the next write */
+	http2_session_wbuf_delete(c->h2_session);
 
 	if(nghttp2_session_want_read(c->h2_session->session)) {
 		c->tcp_is_reading = 1;
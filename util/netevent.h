@@ -115,6 +115,17 @@ typedef int comm_point_callback_type(struct comm_point*, void*, int,
 #define SLOW_LOG_TIME 10
 /** for doq, the maximum dcid length, in ngtcp2 it is 20. */
 #define DOQ_MAX_CIDLEN 24
+/** for doq, size of the buffers with several packets, for UDP
+ * segmentation offload on send, below the UDP maximum. */
+#define DOQ_GSO_BUFFER_SIZE 65000
+/** for doq, size of the receive buffer with UDP GRO, the kernel can
+ * coalesce packets up to the maximum UDP datagram size. */
+#define DOQ_GRO_BUFFER_SIZE 65535
+/** for doq, the maximum number of packets in one UDP GSO send. */
+#define DOQ_GSO_MAX_SEGMENTS 64
+/** size of the http2 session write buffer, holds a DATA frame of the
+ * maximum default size with its header, plus the frames around it. */
+#define HTTP2_WRITE_BUFFER_SIZE (16384+1024)
 
 /**
  * A communication point dispatcher. Thread specific.
@@ -926,6 +937,15 @@ struct http2_session {
 	nghttp2_session *session;
 	/** store nghttp2 callbacks for easy reuse */
 	nghttp2_session_callbacks* callbacks;
+	/** output of the session, the frames of all the streams are
+	 * collected here and written to the connection at once. Allocated
+	 * when there is output, and counted in the http2 response buffer
+	 * size. NULL if there is nothing to write. */
+	struct sldns_buffer* wbuf;
+	/** number of bytes at the start of wbuf that are written */
+	size_t wbuf_sent;
+	/** the write of wbuf blocked, nothing is added until it is done */
+	int wbuf_blocked;
 #endif
 	/** comm point containing buffer used to build answer in worker or
 	 * module */
@@ -997,6 +1017,16 @@ ssize_t http2_send_cb(nghttp2_session* session, const uint8_t* buf,
 /** nghttp2 callback on closing stream */
 int http2_stream_close_cb(nghttp2_session* session, int32_t stream_id,
 	uint32_t error_code, void* cb_arg);
+
+/**
+ * Make room in the http2 session write buffer, writes the buffered
+ * output to the connection if the space is not available.
+ * @param h2_session: http2 session.
+ * @param len: number of bytes that are going to be added.
+ * @return 1 if len bytes can be added to the wbuf, 0 if the write would
+ *	block, -1 on failure.
+ */
+int http2_write_reserve(struct http2_session* h2_session, size_t len);
 #endif
 
 /**
@@ -1069,6 +1099,24 @@ struct doq_server_socket {
 	struct comm_point* cp;
 	/** the buffer for packets, doq in and out */
 	struct sldns_buffer* pkt_buf;
+	/** the buffer with the outgoing packets for one connection, that
+	 * are sent together, with UDP GSO if possible. */
+	struct sldns_buffer* gso_buf;
+	/** if UDP segmentation offload (UDP_SEGMENT) is used on send. */
+	int gso;
+	/** if UDP generic receive offload (UDP_GRO) is enabled, then
+	 * received packets are stored in gro_buf, and taken out one by one
+	 * for processing in pkt_buf. */
+	int gro;
+	/** the buffer with received packets, of gro_size each. The
+	 * remaining part is not processed yet. */
+	struct sldns_buffer* gro_buf;
+	/** the size of the packets in gro_buf, the last can be smaller. */
+	size_t gro_size;
+	/** the ecn info of the packets in gro_buf. */
+	uint32_t gro_ecn;
+	/** the packet source and destination of the packets in gro_buf. */
+	struct doq_pkt_addr* gro_paddr;
 	/** the current doq connection when we are in callbacks to worker,
 	 * so that we have the already locked structure at our disposal. */
 	struct doq_conn* current_conn;
@@ -1078,8 +1126,19 @@ struct doq_server_socket {
 	int have_blocked_pkt;
 	/** store blocked packet, a packet that could not be send on the
 	 * nonblocking socket. It has to be sent later, when the write on
-	 * the udp socket unblocks. */
+	 * the udp socket unblocks. It can hold several packets of
+	 * blocked_pkt_gso size. */
 	struct sldns_buffer* blocked_pkt;
+	/** the size of the packets in blocked_pkt, 0 if it is one packet. */
+	size_t blocked_pkt_gso;
+	/** if there is a packet in blocked_next, it goes out after the
+	 * packets in blocked_pkt, to the same destination. */
+	int have_blocked_next;
+	/** the packet that did not fit in the segmented batch that was
+	 * blocked, it is kept so it is not lost. */
+	struct sldns_buffer* blocked_next;
+	/** the ecn info for the blocked_next packet. */
+	uint32_t blocked_next_ecn;
 #ifdef HAVE_NGTCP2
 	/** the ecn info for the blocked packet, congestion information. */
 	struct ngtcp2_pkt_info blocked_pkt_pi;
@@ -1119,6 +1178,54 @@ void doq_pkt_addr_init(struct doq_pkt_addr* paddr);
 void doq_send_pkt(struct comm_point* c, struct doq_pkt_addr* paddr,
 	uint32_t ecn);
 
+/**
+ * Store a doq packet to be sent after the blocked packets, when the write
+ * of a batch of packets has blocked and the packet is not part of the
+ * batch. It goes to the destination of the blocked packets.
+ * @param c: the comm point.
+ * @param ecn: the ecn info for the packet.
+ * @param data: the packet.
+ * @param len: length of the packet.
+ */
+void doq_store_blocked_next(struct comm_point* c, uint32_t ecn,
+	uint8_t* data, size_t len);
+
+/**
+ * Send several doq packets over UDP, to the same destination. With UDP
+ * GSO this is one sendmsg, without it the packets are sent one by one.
+ * @param c: the comm point.
+ * @param paddr: destination and source address.
+ * @param ecn: the ecn info for the packets.
+ * @param buf: the packets, each gso_size long, the last can be shorter.
+ * @param gso_size: the size of the packets, or 0 if buf has one packet.
+ */
+void doq_send_pkts(struct comm_point* c, struct doq_pkt_addr* paddr,
+	uint32_t ecn, struct sldns_buffer* buf, size_t gso_size);
+
+#ifdef HAVE_NGTCP2
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * Receive packet for DoQ on UDP. With UDP GRO, several packets are
+ * received at once, and returned one by one.
+ * @param c: the comm point.
+ * @param paddr: returns the packet source and destination.
+ * @param pkt_continue: set false if the callback can stop receiving UDP
+ *	packets, when it returns false.
+ * @param pi: returns the packet ecn info.
+ * @return false if failed. On success the packet is in pkt_buf.
+ */
+int doq_recv(struct comm_point* c, struct doq_pkt_addr* paddr,
+	int* pkt_continue, struct ngtcp2_pkt_info* pi);
+#endif
+
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * Write the blocked packets, and the packet after them, if possible.
+ * @param c: the comm point.
+ * @return false if the write has blocked again.
+ */
+int doq_write_blocked_pkt(struct comm_point* c);
+
 /** doq timer callback function. */
 void doq_timer_cb(void* arg);
 
@@ -67,6 +67,10 @@ rtt_init(struct rtt_info* rtt)
 	rtt->srtt = 0;
 	rtt->rttvar = UNKNOWN_SERVER_NICENESS/4;
 	rtt->rto = calc_rto(rtt);
+	rtt->p50 = 0;
+	rtt->p95 = 0;
+	rtt->pdev = 0;
+	rtt->pnum = 0;
 	/* default value from the book is 0 + 4*0.75 = 3 seconds */
 	/* first RTO is 0 + 4*0.094 = 0.376 seconds */
 }
@@ -88,6 +92,62 @@ rtt_unclamped(const struct rtt_info* rtt)
 	return rtt->srtt + 4*rtt->rttvar;
 }
 
+/**
+ * Move a percentile estimate towards the reply time. The steps up and
+ * down are weighted so that they balance when the fraction q of the
+ * reply times is below the estimate. The step size follows the spread
+ * of the reply times, so it adapts to fast and slow servers, and old
+ * reply times decay from the estimate.
+ * @param est: the estimate to update.
+ * @param ms: the reply time.
+ * @param q: the percentile.
+ * @param scale: the deviation of the reply times.
+ */
+static void
+pct_step(int* est, int ms, int q, int scale)
+{
+	int step;
+	if(ms > *est) {
+		step = scale*q/400;
+		if(step < 1)
+			step = 1;
+		*est += step;
+		if(*est > ms)
+			*est = ms;
+	} else if(ms < *est) {
+		step = scale*(100-q)/400;
+		if(step < 1)
+			step = 1;
+		*est -= step;
+		if(*est < ms)
+			*est = ms;
+	}
+}
+
+/** update the percentile estimates with a reply time */
+static void
+pct_update(struct rtt_info* rtt, int ms)
+{
+	int delta;
+	if(rtt->pnum == 0) {
+		rtt->p50 = ms;
+		rtt->p95 = ms;
+		rtt->pdev = ms/2;
+		rtt->pnum = 1;
+		return;
+	}
+	if(rtt->pnum < RTT_PCT_MAX_SAMPLES)
+		rtt->pnum++;
+	delta = ms - rtt->p50;
+	if(delta < 0)
+		delta = -delta;
+	rtt->pdev += (delta - rtt->pdev) / 4;
+	pct_step(&rtt->p50, ms, 50, rtt->pdev);
+	pct_step(&rtt->p95, ms, 95, rtt->pdev);
+	if(rtt->p95 < rtt->p50)
+		rtt->p95 = rtt->p50;
+}
+
 void 
 rtt_update(struct rtt_info* rtt, int ms)
 {
@@ -97,6 +157,7 @@ rtt_update(struct rtt_info* rtt, int ms)
 		delta = -delta; /* |delta| */
 	rtt->rttvar += (delta - rtt->rttvar) / 4; /* h = 1/4 */
 	rtt->rto = calc_rto(rtt);
+	pct_update(rtt, ms);
 }
 
 void 
@@ -123,3 +184,23 @@ int rtt_notimeout(const struct rtt_info* rtt)
 {
 	return calc_rto(rtt);
 }
+
+int rtt_p95(const struct rtt_info* rtt)
+{
+	int p;
+	if(rtt->pnum >= RTT_PCT_MIN_SAMPLES)
+		p = rtt->p95;
+	else	p = rtt->srtt + 2*rtt->rttvar;
+	if(p < RTT_MIN_TIMEOUT)
+		p = RTT_MIN_TIMEOUT;
+	if(p > RTT_MAX_TIMEOUT)
+		p = RTT_MAX_TIMEOUT;
+	return p;
+}
+
+int rtt_p50(const struct rtt_info* rtt)
+{
+	if(rtt->pnum < RTT_PCT_MIN_SAMPLES)
+		return -1;
+	return rtt->p50;
+}
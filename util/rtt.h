@@ -53,8 +53,22 @@ struct rtt_info {
 	int rttvar;
 	/** current RTO in use, in milliseconds */
 	int rto;
+	/** estimated median of the reply times, in milliseconds */
+	int p50;
+	/** estimated 95th percentile of the reply times, in milliseconds */
+	int p95;
+	/** smoothed deviation of the reply times from the median, it sets
+	 * the step size of the percentile estimates, in milliseconds */
+	int pdev;
+	/** number of reply times in the percentile estimates, capped */
+	int pnum;
 };
 
+/** number of reply times before the percentile estimates are used */
+#define RTT_PCT_MIN_SAMPLES 8
+/** cap on the sample count of the percentile estimates */
+#define RTT_PCT_MAX_SAMPLES 1000
+
 /** min retransmit timeout value, in milliseconds */
 extern int RTT_MIN_TIMEOUT;
 /** max retransmit timeout value, in milliseconds */
@@ -88,6 +102,25 @@ int rtt_unclamped(const struct rtt_info* rtt);
  */
 int rtt_notimeout(const struct rtt_info* rtt);
 
+/**
+ * Estimate of the 95th percentile of the round trip time, for valid
+ * responses. If there are too few reply times for the percentile
+ * estimate, it is derived from the smoothed rtt. The mean deviation is
+ * about 0.8 times the standard deviation, and the 95th percentile is
+ * 1.65 standard deviations above the mean, srtt + 2*rttvar.
+ * @param rtt: round trip statistics structure.
+ * @return: value in msec, at least RTT_MIN_TIMEOUT.
+ */
+int rtt_p95(const struct rtt_info* rtt);
+
+/**
+ * Estimate of the median round trip time, for valid responses.
+ * @param rtt: round trip statistics structure.
+ * @return: value in msec, or -1 if there are too few reply times for
+ *	the estimate.
+ */
+int rtt_p50(const struct rtt_info* rtt);
+
 /**
  * Update the statistics with a new roundtrip estimate observation.
  * @param rtt: round trip statistics structure.
@@ -56,6 +56,7 @@
 #include "daemon/stats.h"
 #include "services/mesh.h"
 #include "services/cache/rrset.h"
+#include "services/cache/deleg.h"
 #include "services/cache/infra.h"
 #include "validator/validator.h"
 #include "util/config_file.h"
@@ -238,6 +239,12 @@ void shm_main_run(struct worker *worker)
 	stat_total = worker->daemon->shm_info->ptr_arr;
 	stat_info = worker->daemon->shm_info->ptr_arr + offset;
 
+#ifdef STATS_LOCKFREE
+	/* the first thread reads the stats of all the threads, without
+	 * interrupting them, the others do not have to do anything */
+	if(worker->thread_num != 0)
+		return;
+#endif
 	/* Copy data to the current position */
 	server_stats_compile(worker, stat_info, 0);
 
@@ -258,7 +265,8 @@ void shm_main_run(struct worker *worker)
 		stat_timeval_subtract(&shm_stat->time.elapsed_sec, &shm_stat->time.elapsed_usec, worker->env.now_tv, &worker->daemon->time_last_stat);
 
 		shm_stat->mem.msg = (long long)slabhash_get_mem(worker->env.msg_cache);
-		shm_stat->mem.rrset = (long long)slabhash_get_mem(&worker->env.rrset_cache->table);
+		shm_stat->mem.rrset = (long long)slabhash_get_mem(&worker->env.rrset_cache->table)
+			+ (long long)deleg_cache_get_mem(worker->env.deleg_cache);
 		shm_stat->mem.dnscrypt_shared_secret = 0;
 #ifdef USE_DNSCRYPT
 		if(worker->daemon->dnscenv) {
@@ -298,6 +306,14 @@ void shm_main_run(struct worker *worker)
 	}
 
 	server_stats_add(stat_total, stat_info);
+#ifdef STATS_LOCKFREE
+	for(offset = 1; offset < worker->daemon->num; offset++) {
+		stat_info = worker->daemon->shm_info->ptr_arr + offset + 1;
+		server_stats_obtain(worker, worker->daemon->workers[offset],
+			stat_info, 0);
+		server_stats_add(stat_total, stat_info);
+	}
+#endif
 
 	/* print the thread statistics */
 	stat_total->mesh_time_median /= (double)worker->daemon->num;
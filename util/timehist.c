@@ -47,6 +47,7 @@
 #include "util/timehist.h"
 #include "util/log.h"
 #include "util/timeval_func.h"
+#include "sldns/rrdef.h"
 
 /** special timestwo operation for time values in histogram setup */
 static void
@@ -229,3 +230,161 @@ timehist_import(struct timehist* hist, long long* array, size_t sz)
 	for(i=0; i<sz; i++)
 		hist->buckets[i].count = (size_t)array[i];
 }
+
+/** the query types with a latency histogram of their own */
+static const uint16_t latency_qtypes[LATENCY_NUM_QTYPE-1] = {
+	LDNS_RR_TYPE_A, LDNS_RR_TYPE_AAAA, LDNS_RR_TYPE_PTR,
+	LDNS_RR_TYPE_CNAME, LDNS_RR_TYPE_MX, LDNS_RR_TYPE_NS,
+	LDNS_RR_TYPE_SOA, LDNS_RR_TYPE_SRV, LDNS_RR_TYPE_TXT,
+	LDNS_RR_TYPE_HTTPS, LDNS_RR_TYPE_SVCB, LDNS_RR_TYPE_DS,
+	LDNS_RR_TYPE_DNSKEY, LDNS_RR_TYPE_ANY
+};
+
+/** bucket index for a value in the latency histogram */
+static size_t
+lathist_index(long long usec)
+{
+	int shift = 0;
+	long long v;
+	if(usec < LATHIST_SUB) {
+		if(usec < 0)
+			return 0;
+		return (size_t)usec;
+	}
+	/* find the power of two, shift the value until it is a sub bucket */
+	v = usec;
+	while(v >= 2*LATHIST_SUB) {
+		v >>= 1;
+		shift++;
+	}
+	if(shift > LATHIST_MAX_BITS - LATHIST_SUB_BITS)
+		return LATHIST_NUM-1;
+	return (size_t)(shift+1)*LATHIST_SUB + (size_t)(v - LATHIST_SUB);
+}
+
+long long
+lathist_bucket_lower(size_t i)
+{
+	size_t shift;
+	if(i < LATHIST_SUB)
+		return (long long)i;
+	shift = i/LATHIST_SUB - 1;
+	return ((long long)LATHIST_SUB + (long long)(i%LATHIST_SUB)) << shift;
+}
+
+/** width of a bucket in the latency histogram, in usec */
+static long long
+lathist_bucket_width(size_t i)
+{
+	if(i < LATHIST_SUB)
+		return 1;
+	return ((long long)1) << (i/LATHIST_SUB - 1);
+}
+
+void
+lathist_insert(struct lathist* hist, long long usec)
+{
+	hist->bucket[lathist_index(usec)]++;
+	hist->count++;
+	hist->sum += usec;
+}
+
+void
+lathist_add(struct lathist* to, struct lathist* from)
+{
+	size_t i;
+	if(from->count == 0)
+		return;
+	for(i=0; i<LATHIST_NUM; i++)
+		to->bucket[i] += from->bucket[i];
+	to->count += from->count;
+	to->sum += from->sum;
+}
+
+void
+lathist_subtract(struct lathist* to, struct lathist* base)
+{
+	size_t i;
+	if(base->count == 0 || base->count > to->count)
+		return;
+	for(i=0; i<LATHIST_NUM; i++)
+		to->bucket[i] -= base->bucket[i];
+	to->count -= base->count;
+	to->sum -= base->sum;
+}
+
+double
+lathist_quantile(struct lathist* hist, double q)
+{
+	double lookfor, passed = 0;
+	size_t i = 0;
+	if(hist->count == 0)
+		return 0.;
+	lookfor = (double)hist->count * q;
+	while(i+1 < LATHIST_NUM &&
+		passed+(double)hist->bucket[i] < lookfor) {
+		passed += (double)hist->bucket[i++];
+	}
+	if(hist->bucket[i] == 0)
+		return (double)lathist_bucket_lower(i)/1000000.;
+	/* interpolate within the bucket */
+	return ((double)lathist_bucket_lower(i) + (lookfor - passed) *
+		(double)lathist_bucket_width(i) / (double)hist->bucket[i])
+		/ 1000000.;
+}
+
+int
+latency_qtype_index(uint16_t qtype)
+{
+	int i;
+	for(i=0; i<LATENCY_NUM_QTYPE-1; i++)
+		if(latency_qtypes[i] == qtype)
+			return i;
+	return LATENCY_NUM_QTYPE-1;
+}
+
+uint16_t
+latency_qtype_type(int i)
+{
+	if(i < 0 || i >= LATENCY_NUM_QTYPE-1)
+		return 0;
+	return latency_qtypes[i];
+}
+
+void
+latency_client_insert(struct latency_client* lat, struct timeval* tv,
+	uint16_t qtype, int rcode, int recursion)
+{
+	long long usec = ((long long)tv->tv_sec)*1000000 +
+		(long long)tv->tv_usec;
+	if(rcode < 0 || rcode >= LATENCY_NUM_RCODE-1)
+		rcode = LATENCY_NUM_RCODE-1;
+	lathist_insert(recursion?&lat->recursion:&lat->cache, usec);
+	lathist_insert(&lat->qtype[latency_qtype_index(qtype)], usec);
+	lathist_insert(&lat->rcode[rcode], usec);
+}
+
+void
+latency_client_add(struct latency_client* to, struct latency_client* from)
+{
+	int i;
+	lathist_add(&to->cache, &from->cache);
+	lathist_add(&to->recursion, &from->recursion);
+	for(i=0; i<LATENCY_NUM_QTYPE; i++)
+		lathist_add(&to->qtype[i], &from->qtype[i]);
+	for(i=0; i<LATENCY_NUM_RCODE; i++)
+		lathist_add(&to->rcode[i], &from->rcode[i]);
+}
+
+void
+latency_client_subtract(struct latency_client* to,
+	struct latency_client* base)
+{
+	int i;
+	lathist_subtract(&to->cache, &base->cache);
+	lathist_subtract(&to->recursion, &base->recursion);
+	for(i=0; i<LATENCY_NUM_QTYPE; i++)
+		lathist_subtract(&to->qtype[i], &base->qtype[i]);
+	for(i=0; i<LATENCY_NUM_RCODE; i++)
+		lathist_subtract(&to->rcode[i], &base->rcode[i]);
+}
@@ -131,4 +131,135 @@ void timehist_export(struct timehist* hist, long long* array, size_t sz);
  */
 void timehist_import(struct timehist* hist, long long* array, size_t sz);
 
+/**
+ * Latency histogram, log-linear (HDR style) buckets of microseconds.
+ * Below LATHIST_SUB usec the buckets are 1 usec wide, after that every
+ * power of two is split in LATHIST_SUB linear buckets, so the error of a
+ * value is less than 1/LATHIST_SUB, at any magnitude.
+ */
+/** number of bits of sub buckets per power of two */
+#define LATHIST_SUB_BITS 4
+/** number of sub buckets per power of two */
+#define LATHIST_SUB (1<<LATHIST_SUB_BITS)
+/** highest power of two of usec that is bucketed, 2^26 usec is 67 sec,
+ * values of 2^27 usec or larger are counted in the last bucket */
+#define LATHIST_MAX_BITS 26
+/** number of buckets in a latency histogram */
+#define LATHIST_NUM ((LATHIST_MAX_BITS - LATHIST_SUB_BITS + 2) * LATHIST_SUB)
+
+/**
+ * Latency histogram. Written by one thread, without locks, and read
+ * (merged) by the statistics code.
+ */
+struct lathist {
+	/** number of values */
+	long long count;
+	/** sum of the values, in usec */
+	long long sum;
+	/** the counts per bucket */
+	long long bucket[LATHIST_NUM];
+};
+
+/** number of query types with a latency histogram of their own, other
+ * types are counted together in the last one */
+#define LATENCY_NUM_QTYPE 15
+/** number of rcodes with a latency histogram of their own, the last one
+ * counts all the other rcodes */
+#define LATENCY_NUM_RCODE 7
+
+/**
+ * Response time latency histograms for queries from clients.
+ */
+struct latency_client {
+	/** answered directly, from the cache or local data */
+	struct lathist cache;
+	/** answered after recursion */
+	struct lathist recursion;
+	/** per query type, see latency_qtype_index */
+	struct lathist qtype[LATENCY_NUM_QTYPE];
+	/** per rcode of the reply */
+	struct lathist rcode[LATENCY_NUM_RCODE];
+};
+
+/**
+ * Add time value to the latency histogram.
+ * @param hist: latency histogram
+ * @param usec: time value in microseconds
+ */
+void lathist_insert(struct lathist* hist, long long usec);
+
+/**
+ * Add the counts of one latency histogram to another.
+ * @param to: the total is added to this histogram.
+ * @param from: added to the total.
+ */
+void lathist_add(struct lathist* to, struct lathist* from);
+
+/**
+ * Subtract the counts of a baseline histogram, that was taken earlier
+ * from the same counts.
+ * @param to: histogram that is changed.
+ * @param base: the baseline. If it has larger values, the histogram
+ *	was restarted, and it is not subtracted.
+ */
+void lathist_subtract(struct lathist* to, struct lathist* base);
+
+/**
+ * Lower bound of a bucket in the latency histogram.
+ * @param i: bucket index.
+ * @return the lowest value in usec that is counted in the bucket.
+ */
+long long lathist_bucket_lower(size_t i);
+
+/**
+ * Find the time value for a quantile, such as 0.5, 0.99 and 0.999.
+ * Interpolated within the bucket.
+ * @param hist: latency histogram.
+ * @param q: quantile, must be >0 and <1.
+ * @return the time in seconds, or 0 if there are no values.
+ */
+double lathist_quantile(struct lathist* hist, double q);
+
+/**
+ * Get the index of a query type for the latency_client qtype array.
+ * @param qtype: the query type.
+ * @return index, the last one is for the types that are not counted
+ *	separately.
+ */
+int latency_qtype_index(uint16_t qtype);
+
+/**
+ * Get the query type for an index in the latency_client qtype array.
+ * @param i: index
+ * @return query type, or 0 for the last entry with the other types.
+ */
+uint16_t latency_qtype_type(int i);
+
+/**
+ * Add a client response time to the latency histograms.
+ * @param lat: the latency histograms of the thread.
+ * @param tv: the response time.
+ * @param qtype: query type.
+ * @param rcode: the rcode of the reply.
+ * @param recursion: if the answer needed recursion.
+ */
+void latency_client_insert(struct latency_client* lat, struct timeval* tv,
+	uint16_t qtype, int rcode, int recursion);
+
+/**
+ * Add the counts of client latency histograms to another.
+ * @param to: the total is added to this.
+ * @param from: added to the total.
+ */
+void latency_client_add(struct latency_client* to,
+	struct latency_client* from);
+
+/**
+ * Subtract baseline counts of client latency histograms.
+ * @param to: histograms that are changed.
+ * @param base: the baseline.
+ */
+void latency_client_subtract(struct latency_client* to,
+	struct latency_client* base);
+
 #endif /* UTIL_TIMEHIST_H */
@@ -0,0 +1,299 @@
+/*
+ * util/topk.c - heavy hitter sketch, top-k counts of keys.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a heavy hitter sketch, with the Space-Saving algorithm.
+ */
+#include "config.h"
+#include "util/topk.h"
+#include "util/storage/lookup3.h"
+
+struct topk*
+topk_create(int size)
+{
+	struct topk* t;
+	uint32_t nb = 1;
+	if(size < 1)
+		size = 1;
+	t = (struct topk*)calloc(1, sizeof(*t));
+	if(!t)
+		return NULL;
+	while(nb < (uint32_t)size*2)
+		nb *= 2;
+	t->size = size;
+	t->mask = nb-1;
+	t->entries = (struct topk_entry*)calloc((size_t)size,
+		sizeof(struct topk_entry));
+	t->heap = (int*)calloc((size_t)size, sizeof(int));
+	t->buckets = (int*)malloc(sizeof(int)*nb);
+	if(!t->entries || !t->heap || !t->buckets) {
+		topk_delete(t);
+		return NULL;
+	}
+	topk_clear(t);
+	return t;
+}
+
+void
+topk_delete(struct topk* t)
+{
+	if(!t)
+		return;
+	free(t->entries);
+	free(t->heap);
+	free(t->buckets);
+	free(t);
+}
+
+void
+topk_clear(struct topk* t)
+{
+	uint32_t i;
+	t->num = 0;
+	for(i=0; i<=t->mask; i++)
+		t->buckets[i] = -1;
+}
+
+/** swap two positions in the heap */
+static void
+topk_heap_swap(struct topk* t, int a, int b)
+{
+	int e = t->heap[a];
+	t->heap[a] = t->heap[b];
+	t->heap[b] = e;
+	t->entries[t->heap[a]].heap = a;
+	t->entries[t->heap[b]].heap = b;
+}
+
+/** move entry at heap position down, after its count increased */
+static void
+topk_heap_down(struct topk* t, int pos)
+{
+	for(;;) {
+		int l = pos*2+1, r = pos*2+2, m = pos;
+		if(l < t->num && t->entries[t->heap[l]].count <
+			t->entries[t->heap[m]].count)
+			m = l;
+		if(r < t->num && t->entries[t->heap[r]].count <
+			t->entries[t->heap[m]].count)
+			m = r;
+		if(m == pos)
+			return;
+		topk_heap_swap(t, pos, m);
+		pos = m;
+	}
+}
+
+/** move entry at heap position up, for a new entry */
+static void
+topk_heap_up(struct topk* t, int pos)
+{
+	while(pos > 0) {
+		int p = (pos-1)/2;
+		if(t->entries[t->heap[p]].count <=
+			t->entries[t->heap[pos]].count)
+			return;
+		topk_heap_swap(t, pos, p);
+		pos = p;
+	}
+}
+
+/** find the entry for a key, or -1 */
+static int
+topk_find(struct topk* t, uint8_t* key, size_t keylen, uint32_t h)
+{
+	int i = t->buckets[h&t->mask];
+	while(i != -1) {
+		struct topk_entry* e = &t->entries[i];
+		if(e->hash == h && e->keylen == keylen &&
+			memcmp(e->key, key, keylen) == 0)
+			return i;
+		i = e->next;
+	}
+	return -1;
+}
+
+/** remove entry from its hash bucket */
+static void
+topk_unhash(struct topk* t, int i)
+{
+	int* p = &t->buckets[t->entries[i].hash&t->mask];
+	while(*p != -1) {
+		if(*p == i) {
+			*p = t->entries[i].next;
+			return;
+		}
+		p = &t->entries[*p].next;
+	}
+}
+
+/** add count to a key */
+static void
+topk_add(struct topk* t, uint8_t* key, size_t keylen, long long count,
+	long long error)
+{
+	uint32_t h;
+	int i, fresh = 0;
+	struct topk_entry* e;
+	if(keylen > TOPK_KEY_MAX)
+		keylen = TOPK_KEY_MAX;
+	h = hashlittle(key, keylen, 0xab);
+	if((i = topk_find(t, key, keylen, h)) != -1) {
+		t->entries[i].count += count;
+		t->entries[i].error += error;
+		topk_heap_down(t, t->entries[i].heap);
+		return;
+	}
+	if(t->num < t->size) {
+		/* a free counter */
+		i = t->num++;
+		e = &t->entries[i];
+		e->count = count;
+		e->error = error;
+		e->heap = i;
+		t->heap[i] = i;
+		fresh = 1;
+	} else {
+		/* replace the key with the lowest count */
+		i = t->heap[0];
+		e = &t->entries[i];
+		topk_unhash(t, i);
+		e->error = e->count + error;
+		e->count += count;
+	}
+	e->hash = h;
+	e->keylen = (uint16_t)keylen;
+	memmove(e->key, key, keylen);
+	e->next = t->buckets[h&t->mask];
+	t->buckets[h&t->mask] = i;
+	if(fresh)
+		topk_heap_up(t, e->heap);
+	else	topk_heap_down(t, e->heap);
+}
+
+void
+topk_insert(struct topk* t, uint8_t* key, size_t keylen)
+{
+	topk_add(t, key, keylen, 1, 0);
+}
+
+void
+topk_merge(struct topk* to, struct topk* from)
+{
+	int i;
+	for(i=0; i<from->num; i++)
+		topk_add(to, from->entries[i].key, from->entries[i].keylen,
+			from->entries[i].count, from->entries[i].error);
+}
+
+/** compare entries for qsort, highest count first */
+static int
+topk_cmp(const void* a, const void* b)
+{
+	const struct topk_entry* x = *(struct topk_entry* const*)a;
+	const struct topk_entry* y = *(struct topk_entry* const*)b;
+	if(x->count > y->count)
+		return -1;
+	if(x->count < y->count)
+		return 1;
+	return 0;
+}
+
+int
+topk_sorted(struct topk* t, struct topk_entry** list)
+{
+	int i;
+	for(i=0; i<t->num; i++)
+		list[i] = &t->entries[i];
+	qsort(list, (size_t)t->num, sizeof(*list), topk_cmp);
+	return t->num;
+}
+
+size_t
+topk_get_mem(struct topk* t)
+{
+	if(!t)
+		return 0;
+	return sizeof(*t) + sizeof(struct topk_entry)*(size_t)t->size +
+		sizeof(int)*(size_t)t->size + sizeof(int)*(size_t)(t->mask+1);
+}
+
+struct topk_set*
+topk_set_create(int size)
+{
+	int i;
+	struct topk_set* set = (struct topk_set*)calloc(1, sizeof(*set));
+	if(!set)
+		return NULL;
+	for(i=0; i<TOPK_NUM; i++) {
+		if(!(set->t[i] = topk_create(size))) {
+			while(--i >= 0)
+				topk_delete(set->t[i]);
+			free(set);
+			return NULL;
+		}
+	}
+	lock_basic_init(&set->lock);
+	lock_protect(&set->lock, set->t, sizeof(set->t));
+	return set;
+}
+
+void
+topk_set_delete(struct topk_set* set)
+{
+	int i;
+	if(!set)
+		return;
+	lock_basic_destroy(&set->lock);
+	for(i=0; i<TOPK_NUM; i++)
+		topk_delete(set->t[i]);
+	free(set);
+}
+
+const char*
+topk_kind_name(enum topk_kind kind)
+{
+	switch(kind) {
+	case topk_client: return "client";
+	case topk_qname: return "qname";
+	case topk_zone: return "zone";
+	case topk_upstream: return "upstream";
+	case topk_servfail: return "servfail";
+	default: break;
+	}
+	return "unknown";
+}
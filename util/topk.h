@@ -0,0 +1,197 @@
+/*
+ * util/topk.h - heavy hitter sketch, top-k counts of keys.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a heavy hitter sketch. It counts the keys with the
+ * Space-Saving algorithm, that keeps a fixed number of counters. A key that
+ * is not counted replaces the key with the lowest count, and it inherits
+ * that count as its error. Every key that occurs more than N/size times in
+ * a stream of N items is in the sketch. The update is O(1) for a key that
+ * is counted, and O(log size) worst case with the min-heap otherwise.
+ */
+
+#ifndef UTIL_TOPK_H
+#define UTIL_TOPK_H
+#include "util/locks.h"
+
+/** max length of a key in the sketch, a domain name fits */
+#define TOPK_KEY_MAX 256
+
+/**
+ * A counted key in the sketch.
+ */
+struct topk_entry {
+	/** the count, this is an overestimate by at most error */
+	long long count;
+	/** the count the key inherited when it replaced another key */
+	long long error;
+	/** position in the min-heap */
+	int heap;
+	/** next entry in the hash bucket, or -1 */
+	int next;
+	/** the hash value of the key */
+	uint32_t hash;
+	/** length of the key */
+	uint16_t keylen;
+	/** the key */
+	uint8_t key[TOPK_KEY_MAX];
+};
+
+/**
+ * Heavy hitter sketch. Not locked, the caller locks it if it is shared.
+ */
+struct topk {
+	/** number of counters */
+	int size;
+	/** number of entries in use */
+	int num;
+	/** array of size entries */
+	struct topk_entry* entries;
+	/** min-heap of the entries in use, by count, index into entries */
+	int* heap;
+	/** hash buckets, index of the first entry, or -1. */
+	int* buckets;
+	/** number of buckets - 1, the number of buckets is a power of 2 */
+	uint32_t mask;
+};
+
+/**
+ * Create a heavy hitter sketch.
+ * @param size: the number of counters, the sketch finds the keys that
+ *	occur more than 1/size of the time.
+ * @return new sketch or NULL on alloc failure.
+ */
+struct topk* topk_create(int size);
+
+/**
+ * Delete the sketch.
+ * @param t: to delete, can be NULL.
+ */
+void topk_delete(struct topk* t);
+
+/**
+ * Remove all the counts from the sketch.
+ * @param t: the sketch.
+ */
+void topk_clear(struct topk* t);
+
+/**
+ * Count one occurrence of a key.
+ * @param t: the sketch.
+ * @param key: the key.
+ * @param keylen: length of the key, at most TOPK_KEY_MAX.
+ */
+void topk_insert(struct topk* t, uint8_t* key, size_t keylen);
+
+/**
+ * Add the counts of a sketch to another, to merge the sketches of
+ * the threads. If the total sketch is full, keys are replaced like in
+ * the insert.
+ * @param to: the total sketch.
+ * @param from: the sketch to add to the total.
+ */
+void topk_merge(struct topk* to, struct topk* from);
+
+/**
+ * Get the entries, sorted by count, highest first.
+ * @param t: the sketch.
+ * @param list: array of t->num entry pointers that is filled in.
+ * @return the number of entries in the list.
+ */
+int topk_sorted(struct topk* t, struct topk_entry** list);
+
+/**
+ * Get the memory in use by the sketch.
+ * @param t: the sketch.
+ * @return bytes.
+ */
+size_t topk_get_mem(struct topk* t);
+
+/** the kinds of heavy hitters that a thread tracks */
+enum topk_kind {
+	/** clients, by address prefix */
+	topk_client = 0,
+	/** query names */
+	topk_qname,
+	/** zones, the last two labels of the query name */
+	topk_zone,
+	/** upstream servers, by queries sent */
+	topk_upstream,
+	/** upstream servers, by SERVFAIL replies */
+	topk_servfail,
+	/** number of kinds */
+	TOPK_NUM
+};
+
+/** prefix length of IPv4 client addresses in the heavy hitters */
+#define TOPK_CLIENT_PREFIX4 24
+/** prefix length of IPv6 client addresses in the heavy hitters */
+#define TOPK_CLIENT_PREFIX6 56
+
+/**
+ * The heavy hitter sketches of a thread. The thread updates them, and the
+ * remote control reads them, under the lock. The lock is not contended
+ * unless the sketches are read.
+ */
+struct topk_set {
+	/** lock on the sketches */
+	lock_basic_type lock;
+	/** the sketches, per kind */
+	struct topk* t[TOPK_NUM];
+};
+
+/**
+ * Create the heavy hitter sketches for a thread.
+ * @param size: the number of counters per sketch.
+ * @return new set or NULL on alloc failure.
+ */
+struct topk_set* topk_set_create(int size);
+
+/**
+ * Delete the heavy hitter sketches.
+ * @param set: to delete, can be NULL.
+ */
+void topk_set_delete(struct topk_set* set);
+
+/**
+ * Get the name of a kind of heavy hitter.
+ * @param kind: the kind.
+ * @return static string, like "client".
+ */
+const char* topk_kind_name(enum topk_kind kind);
+
+#endif /* UTIL_TOPK_H */
@@ -838,11 +838,11 @@ validate_suspend_setup_timer(struct module_qstate* qstate,
 	 * is taking long, to keep around cpu time for ordinary queries. */
 	usec = 50000; /* 50 msec */
 	slack = 0;
-	if(qstate->env->mesh->all.count >= qstate->env->mesh->max_reply_states)
+	if(qstate->env->mesh->all_count >= qstate->env->mesh->max_reply_states)
 		slack += 3;
-	else if(qstate->env->mesh->all.count >= qstate->env->mesh->max_reply_states/2)
+	else if(qstate->env->mesh->all_count >= qstate->env->mesh->max_reply_states/2)
 		slack += 2;
-	else if(qstate->env->mesh->all.count >= qstate->env->mesh->max_reply_states/4)
+	else if(qstate->env->mesh->all_count >= qstate->env->mesh->max_reply_states/4)
 		slack += 1;
 	if(vq->suspend_count > 3)
 		slack += 3;
@@ -49,6 +49,7 @@
 #include "daemon/daemon.h"
 #include "daemon/worker.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "util/config_file.h"
 #include "util/netevent.h"
 #include "util/ub_event.h"
@@ -362,6 +363,12 @@ service_init(int r, struct daemon** d, struct config_file** c)
 		config_delete(cfg);
 		return 0;
 	}
+	if(!(daemon->metrics = daemon_metrics_create(cfg))) {
+		log_err("could not set up metrics");
+		daemon_delete(daemon);
+		config_delete(cfg);
+		return 0;
+	}
 	if(cfg->ssl_service_key && cfg->ssl_service_key[0]) {
 		if(!(daemon->listen_sslctx = listen_sslctx_create(
 			cfg->ssl_service_key, cfg->ssl_service_pem, NULL)))